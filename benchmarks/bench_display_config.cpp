@@ -0,0 +1,103 @@
+// system includes
+#include <benchmark/benchmark.h>
+
+// local includes
+#include "display_device/display_config_utils.h"
+#include "utils.h"
+
+namespace {
+  /**
+   * @brief Number of source ids (and thus paths per device) an adapter exposes.
+   */
+  constexpr std::uint32_t SOURCES_PER_ADAPTER {4};
+
+  /**
+   * @brief Synthetic configuration resembling docks and MST hubs with many inactive paths.
+   */
+  struct SyntheticConfig {
+    std::vector<display_device::DisplayPath> m_paths; /**< Active paths in the front, followed by the inactive ones. */
+    std::vector<std::optional<display_device::ValidatedDeviceInfo>> m_device_info; /**< Device info for every path. */
+    std::size_t m_devices; /**< Number of distinct devices. */
+  };
+
+  /**
+   * @brief Make a configuration with the requested number of paths.
+   *
+   * Every adapter drives SOURCES_PER_ADAPTER devices and every device has a path for each
+   * of the adapter's source ids. The first device of every adapter is active.
+   */
+  SyntheticConfig makeConfig(const std::size_t path_count) {
+    SyntheticConfig config {{}, {}, std::max<std::size_t>(path_count / SOURCES_PER_ADAPTER, 1)};
+
+    const auto add_path = [&config](const std::size_t device, const std::uint32_t source_id, const bool active) {
+      const auto adapter {static_cast<std::uint32_t>(device / SOURCES_PER_ADAPTER)};
+      config.m_paths.push_back({{adapter, 0}, source_id, static_cast<std::uint32_t>(device), true, active, std::nullopt});
+      config.m_device_info.emplace_back(display_device::ValidatedDeviceInfo {"\\\\?\\DISPLAY#DEV" + std::to_string(device), bench_utils::makeDeviceId(device)});
+    };
+
+    for (std::size_t device = 0; device < config.m_devices; device += SOURCES_PER_ADAPTER) {
+      add_path(device, 0, true);
+    }
+    for (std::size_t device = 0; device < config.m_devices; ++device) {
+      const bool active {device % SOURCES_PER_ADAPTER == 0};
+      for (std::uint32_t source_id = active ? 1 : 0; source_id < SOURCES_PER_ADAPTER; ++source_id) {
+        add_path(device, source_id, false);
+      }
+    }
+
+    return config;
+  }
+
+  /**
+   * @brief Collect the source data for all of the paths.
+   */
+  void BM_CollectSourceData(benchmark::State &state) {
+    const auto config {makeConfig(static_cast<std::size_t>(state.range(0)))};
+    const display_device::DeviceInfoResolver resolver {[&config](const std::size_t path_index) {
+      return config.m_device_info[path_index];
+    }};
+
+    for (auto _ : state) {
+      auto data {display_device::config_utils::collectSourceDataForMatchingPaths(config.m_paths, resolver)};
+      benchmark::DoNotOptimize(data);
+    }
+
+    state.SetComplexityN(static_cast<std::int64_t>(config.m_paths.size()));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * config.m_paths.size()));
+  }
+
+  /**
+   * @brief Make the paths for a topology with the devices extended, or duplicated in pairs of the same adapter.
+   */
+  void BM_MakePathsForNewTopology(benchmark::State &state) {
+    const auto config {makeConfig(static_cast<std::size_t>(state.range(0)))};
+    const bool duplicated {state.range(1) != 0};
+    const auto path_source_data {display_device::config_utils::collectSourceDataForMatchingPaths(config.m_paths, [&config](const std::size_t path_index) {
+      return config.m_device_info[path_index];
+    })};
+
+    display_device::ActiveTopology topology;
+    for (std::size_t device = 0; device < config.m_devices; ++device) {
+      if (!duplicated || device % 2 == 0) {
+        topology.emplace_back();
+      }
+      topology.back().emplace_back(bench_utils::makeDeviceId(device));
+    }
+
+    if (display_device::config_utils::makePathsForNewTopology(topology, path_source_data, config.m_paths.size()).size() != config.m_devices) {
+      state.SkipWithError("Failed to make the paths for the topology!");
+      return;
+    }
+
+    for (auto _ : state) {
+      auto paths {display_device::config_utils::makePathsForNewTopology(topology, path_source_data, config.m_paths.size())};
+      benchmark::DoNotOptimize(paths);
+    }
+
+    state.SetComplexityN(static_cast<std::int64_t>(config.m_paths.size()));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * config.m_devices));
+  }
+}  // namespace
+
+BENCHMARK(BM_CollectSourceData)->ArgName("paths")->RangeMultiplier(4)->Range(16, 1024)->Complexity();
+BENCHMARK(BM_MakePathsForNewTopology)->ArgNames({"paths", "duplicated"})->ArgsProduct({benchmark::CreateRange(16, 1024, 4), {0, 1}});
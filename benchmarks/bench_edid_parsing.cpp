@@ -0,0 +1,92 @@
+// system includes
+#include <benchmark/benchmark.h>
+
+// local includes
+#include "display_device/edid_cache.h"
+#include "display_device/types.h"
+#include "utils.h"
+
+namespace {
+  // Additional convenience global const(s)
+  constexpr std::size_t CORPUS_SIZE {4096};
+
+  /**
+   * @brief Parse every EDID of the corpus, reporting the number of parsed EDIDs per second.
+   */
+  void BM_ParseEdid(benchmark::State &state) {
+    const auto corpus {bench_utils::makeEdidCorpus(CORPUS_SIZE, state.range(0) != 0)};
+
+    for (auto _ : state) {
+      for (const auto &edid : corpus) {
+        auto data {display_device::EdidData::parse(edid)};
+        benchmark::DoNotOptimize(data);
+      }
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * corpus.size()));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * corpus.size() * corpus.front().size()));
+  }
+
+  /**
+   * @brief Parse every EDID of the corpus stored in a single contiguous buffer, without owning a vector per EDID.
+   */
+  void BM_ParseEdidSpan(benchmark::State &state) {
+    const auto corpus {bench_utils::makeEdidCorpus(CORPUS_SIZE, state.range(0) != 0)};
+    const auto edid_size {corpus.front().size()};
+
+    std::vector<std::byte> buffer;
+    buffer.reserve(corpus.size() * edid_size);
+    for (const auto &edid : corpus) {
+      buffer.insert(std::end(buffer), std::begin(edid), std::end(edid));
+    }
+
+    for (auto _ : state) {
+      for (std::size_t offset = 0; offset < buffer.size(); offset += edid_size) {
+        auto data {display_device::EdidData::parse(std::span<const std::byte> {buffer}.subspan(offset, edid_size))};
+        benchmark::DoNotOptimize(data);
+      }
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * corpus.size()));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+  }
+
+  /**
+   * @brief Parse a batch of EDIDs (with the CTA-861 extension) using the batch API.
+   * @note Measured in the real time as large batches are parsed in parallel.
+   */
+  void BM_ParseEdidMany(benchmark::State &state) {
+    const auto corpus {bench_utils::makeEdidCorpus(static_cast<std::size_t>(state.range(0)), true)};
+    const std::vector<std::span<const std::byte>> views(std::begin(corpus), std::end(corpus));
+
+    for (auto _ : state) {
+      auto data {display_device::EdidData::parseMany(views)};
+      benchmark::DoNotOptimize(data);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * corpus.size()));
+  }
+
+  /**
+   * @brief Repeatedly parse the EDIDs of the same few monitors via the cache, as done by the repeated enumerations.
+   */
+  void BM_ParseEdidCached(benchmark::State &state) {
+    const auto corpus {bench_utils::makeEdidCorpus(static_cast<std::size_t>(state.range(0)), true)};
+    display_device::EdidCache cache;
+
+    for (auto _ : state) {
+      for (const auto &edid : corpus) {
+        auto data {cache.parse(edid)};
+        benchmark::DoNotOptimize(data);
+      }
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * corpus.size()));
+    state.counters["hits"] = static_cast<double>(cache.getStats().m_hits);
+  }
+}  // namespace
+
+BENCHMARK(BM_ParseEdidCached)->ArgName("monitors")->Arg(1)->Arg(4)->Arg(8);
+BENCHMARK(BM_ParseEdid)->ArgName("extension")->Arg(0)->Arg(1);
+BENCHMARK(BM_ParseEdidSpan)->ArgName("extension")->Arg(0)->Arg(1);
+BENCHMARK(BM_ParseEdidMany)->ArgName("batch")->Arg(64)->Arg(256)->Arg(4096)->UseRealTime();
@@ -0,0 +1,47 @@
+// system includes
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+
+// local includes
+#include "display_device/file_settings_persistence.h"
+
+namespace {
+  // Additional convenience global const(s)
+  const std::filesystem::path BENCHMARK_FILEPATH {std::filesystem::temp_directory_path() / "dd_benchmark_settings.json"};
+
+  std::vector<std::uint8_t> makePayload(const std::size_t size) {
+    return std::vector<std::uint8_t>(size, 'X');
+  }
+
+  /**
+   * @brief The non-atomic truncate + overwrite for comparison with the atomic store.
+   */
+  void BM_PlainOverwrite(benchmark::State &state) {
+    const auto payload {makePayload(static_cast<std::size_t>(state.range(0)))};
+    for (auto _ : state) {
+      std::ofstream stream {BENCHMARK_FILEPATH, std::ios::binary | std::ios::trunc};
+      stream.write(reinterpret_cast<const char *>(payload.data()), static_cast<std::streamsize>(payload.size()));
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    std::filesystem::remove(BENCHMARK_FILEPATH);
+  }
+
+  void BM_AtomicStore(benchmark::State &state) {
+    const auto payload {makePayload(static_cast<std::size_t>(state.range(0)))};
+    display_device::FileSettingsPersistence persistence {BENCHMARK_FILEPATH};
+    for (auto _ : state) {
+      if (!persistence.store(payload)) {
+        state.SkipWithError("Failed to store data!");
+        break;
+      }
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    static_cast<void>(persistence.clear());
+  }
+}  // namespace
+
+BENCHMARK(BM_PlainOverwrite)->RangeMultiplier(8)->Range(1 << 10, 1 << 20)->UseRealTime();
+BENCHMARK(BM_AtomicStore)->RangeMultiplier(8)->Range(1 << 10, 1 << 20)->UseRealTime();
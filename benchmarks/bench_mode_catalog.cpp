@@ -0,0 +1,44 @@
+// system includes
+#include <array>
+#include <benchmark/benchmark.h>
+
+// local includes
+#include "display_device/mode_catalog.h"
+
+namespace {
+  /**
+   * @brief Make a catalog with the requested number of modes, spread over a few refresh rates per resolution.
+   */
+  display_device::ModeCatalog makeCatalog(const std::size_t count) {
+    constexpr std::array<unsigned int, 4> refresh_rates_mhz {59940, 60000, 119982, 143998};
+
+    std::vector<display_device::ModeCatalog::Mode> modes;
+    for (std::size_t i = 0; modes.size() < count; ++i) {
+      const display_device::Resolution resolution {static_cast<unsigned int>(640 + (i % 64) * 32), static_cast<unsigned int>(480 + (i / 64) * 16)};
+      for (std::size_t j = 0; j < refresh_rates_mhz.size() && modes.size() < count; ++j) {
+        modes.push_back({resolution, {refresh_rates_mhz[j], 1000}});
+      }
+    }
+
+    return display_device::ModeCatalog {modes};
+  }
+
+  /**
+   * @brief Look up the closest supported mode for every cataloged resolution with a slightly off refresh rate.
+   */
+  void BM_FindNearestMode(benchmark::State &state) {
+    const auto catalog {makeCatalog(static_cast<std::size_t>(state.range(0)))};
+    const auto modes {catalog.getModes()};
+
+    for (auto _ : state) {
+      for (const auto &mode : modes) {
+        auto nearest {catalog.findNearest(mode.m_resolution, {mode.m_refresh_rate.m_numerator + 7, mode.m_refresh_rate.m_denominator}, 900)};
+        benchmark::DoNotOptimize(nearest);
+      }
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * modes.size()));
+  }
+}  // namespace
+
+BENCHMARK(BM_FindNearestMode)->ArgName("modes")->Arg(16)->Arg(256)->Arg(4096);
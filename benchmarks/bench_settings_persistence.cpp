@@ -0,0 +1,223 @@
+// system includes
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <memory>
+
+// local includes
+#include "display_device/async_settings_persistence.h"
+#include "display_device/compressed_settings_persistence.h"
+#include "display_device/deduplicating_settings_persistence.h"
+#include "display_device/file_keyed_settings_persistence.h"
+#include "display_device/file_settings_persistence.h"
+#include "display_device/generational_settings_persistence.h"
+#include "display_device/journal_settings_persistence.h"
+#include "display_device/memory_settings_persistence.h"
+#include "display_device/shared_memory_settings_persistence.h"
+#include "utils.h"
+
+namespace {
+  /**
+   * @brief Adapter for benchmarking the keyed persistence as a single record store.
+   */
+  class KeyedPersistenceAdapter: public display_device::SettingsPersistenceInterface {
+  public:
+    explicit KeyedPersistenceAdapter(const std::filesystem::path &filepath):
+        m_persistence {filepath} {
+    }
+
+    bool store(const std::vector<std::uint8_t> &data) override {
+      return m_persistence.store("state", data);
+    }
+
+    std::optional<std::vector<std::uint8_t>> load() const override {
+      return m_persistence.load("state");
+    }
+
+    bool clear() override {
+      return m_persistence.clear();
+    }
+
+  private:
+    display_device::FileKeyedSettingsPersistence m_persistence;
+  };
+
+  /**
+   * @brief Persistence backend to be benchmarked.
+   */
+  struct Backend {
+    std::string m_name; /**< Name used in the benchmark name. */
+    bool m_file_based; /**< Specifies whether the backend should be benchmarked in every benchmark directory. */
+    std::function<std::shared_ptr<display_device::SettingsPersistenceInterface>(const std::filesystem::path &base_path)> m_make; /**< Backend factory. */
+  };
+
+  std::vector<Backend> getBackends() {
+    std::vector<Backend> backends {
+      {"File", true, [](const auto &base_path) {
+         return std::make_shared<display_device::FileSettingsPersistence>(base_path);
+       }},
+      {"Journal", true, [](const auto &base_path) {
+         return std::make_shared<display_device::JournalSettingsPersistence>(base_path);
+       }},
+      {"Generational", true, [](const auto &base_path) {
+         return std::make_shared<display_device::GenerationalSettingsPersistence>(base_path);
+       }},
+      {"Keyed", true, [](const auto &base_path) {
+         return std::make_shared<KeyedPersistenceAdapter>(base_path);
+       }},
+      // Stores the same payload in every iteration, therefore only the first store reaches the file
+      {"DeduplicatingFile", true, [](const auto &base_path) {
+         return std::make_shared<display_device::DeduplicatingSettingsPersistence>(std::make_shared<display_device::FileSettingsPersistence>(base_path));
+       }},
+      // The stores and clears only measure the caller side, the writes are coalesced in the background
+      {"AsyncFile", true, [](const auto &base_path) {
+         return std::make_shared<display_device::AsyncSettingsPersistence>(std::make_shared<display_device::FileSettingsPersistence>(base_path));
+       }},
+      {"CompressedFile", true, [](const auto &base_path) {
+         return std::make_shared<display_device::CompressedSettingsPersistence>(std::make_shared<display_device::FileSettingsPersistence>(base_path));
+       }},
+      {"Memory", false, [](const auto &) {
+         return std::make_shared<display_device::MemorySettingsPersistence>();
+       }},
+    };
+
+#ifndef _WIN32
+    backends.push_back({"SharedMemory", false, [](const auto &) {
+                          static const std::string name {"/dd_benchmark_settings"};
+                          // The shared memory object outlives the process unless removed
+                          return std::shared_ptr<display_device::SharedMemorySettingsPersistence>(new display_device::SharedMemorySettingsPersistence {name, 1024 * 1024}, [](const auto *persistence) {
+                            delete persistence;
+                            static_cast<void>(display_device::SharedMemorySettingsPersistence::unlink(name));
+                          });
+                        }});
+#endif
+
+    return backends;
+  }
+
+  void setPayloadCounters(benchmark::State &state, const std::vector<std::uint8_t> &payload) {
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * payload.size()));
+    state.counters["payload_bytes"] = static_cast<double>(payload.size());
+  }
+
+  /**
+   * @brief Forward the operations left pending by the asynchronous backend, so that they do not leak into the next benchmark.
+   */
+  void flushPending(benchmark::State &state, const std::shared_ptr<display_device::SettingsPersistenceInterface> &persistence) {
+    if (const auto async_persistence {std::dynamic_pointer_cast<display_device::AsyncSettingsPersistence>(persistence)}; async_persistence && !async_persistence->flush()) {
+      state.SkipWithError("Failed to flush data!");
+    }
+  }
+
+  void BM_Store(benchmark::State &state, const std::shared_ptr<display_device::SettingsPersistenceInterface> &persistence, const std::vector<std::uint8_t> &payload) {
+    for (auto _ : state) {
+      if (!persistence->store(payload)) {
+        state.SkipWithError("Failed to store data!");
+        break;
+      }
+    }
+
+    setPayloadCounters(state, payload);
+    static_cast<void>(persistence->clear());
+    flushPending(state, persistence);
+  }
+
+  void BM_Load(benchmark::State &state, const std::shared_ptr<display_device::SettingsPersistenceInterface> &persistence, const std::vector<std::uint8_t> &payload) {
+    if (!persistence->store(payload)) {
+      state.SkipWithError("Failed to store data!");
+      return;
+    }
+
+    // Otherwise the asynchronous backend would load the pending data from memory
+    flushPending(state, persistence);
+
+    for (auto _ : state) {
+      auto data {persistence->load()};
+      if (!data || data->size() != payload.size()) {
+        state.SkipWithError("Failed to load data!");
+        break;
+      }
+      benchmark::DoNotOptimize(data);
+    }
+
+    setPayloadCounters(state, payload);
+    static_cast<void>(persistence->clear());
+    flushPending(state, persistence);
+  }
+
+  void BM_Clear(benchmark::State &state, const std::shared_ptr<display_device::SettingsPersistenceInterface> &persistence, const std::vector<std::uint8_t> &payload) {
+    for (auto _ : state) {
+      state.PauseTiming();
+      const bool stored {persistence->store(payload)};
+      state.ResumeTiming();
+
+      if (!stored || !persistence->clear()) {
+        state.SkipWithError("Failed to store or clear data!");
+        break;
+      }
+    }
+
+    setPayloadCounters(state, payload);
+    flushPending(state, persistence);
+  }
+
+  /**
+   * @brief Measure the compression alone, reporting the size of the data that actually gets stored.
+   */
+  void BM_Compress(benchmark::State &state, const std::vector<std::uint8_t> &payload) {
+    const auto memory_persistence {std::make_shared<display_device::MemorySettingsPersistence>()};
+    display_device::CompressedSettingsPersistence persistence {memory_persistence};
+
+    for (auto _ : state) {
+      if (!persistence.store(payload)) {
+        state.SkipWithError("Failed to store data!");
+        break;
+      }
+    }
+
+    setPayloadCounters(state, payload);
+    if (const auto stored_data {memory_persistence->load()}) {
+      state.counters["stored_bytes"] = static_cast<double>(stored_data->size());
+    }
+  }
+
+  /**
+   * @brief Register the benchmarks for every backend, directory, payload size and format.
+   */
+  [[maybe_unused]] const bool REGISTERED {[]() {
+    const std::vector<std::pair<std::string, decltype(&BM_Store)>> operations {
+      {"Store", &BM_Store},
+      {"Load", &BM_Load},
+      {"Clear", &BM_Clear},
+    };
+
+    for (const auto &backend : getBackends()) {
+      std::vector<bench_utils::BenchmarkDirectory> directories {{"memory", {}}};
+      if (backend.m_file_based) {
+        directories = bench_utils::getBenchmarkDirectories();
+      }
+
+      for (const auto &directory : directories) {
+        // Every backend gets its own file, so that the leftovers of one backend cannot affect the other
+        const auto persistence {backend.m_make(directory.m_path / ("dd_benchmark_" + backend.m_name + ".json"))};
+        for (const auto displays : bench_utils::DISPLAY_COUNTS) {
+          for (const bool pretty : {true, false}) {
+            const auto payload {bench_utils::makeStatePayload(displays, pretty)};
+            for (const auto &[operation_name, operation] : operations) {
+              const auto name {"Persistence/" + operation_name + "/" + backend.m_name + "/" + directory.m_name + "/displays:" + std::to_string(displays) + "/" + (pretty ? "pretty" : "compact")};
+              benchmark::RegisterBenchmark(name.c_str(), operation, persistence, payload)->UseRealTime();
+            }
+          }
+        }
+      }
+    }
+
+    for (const auto displays : bench_utils::DISPLAY_COUNTS) {
+      for (const bool pretty : {true, false}) {
+        const auto name {"Persistence/Compress/displays:" + std::to_string(displays) + "/" + (pretty ? "pretty" : "compact")};
+        benchmark::RegisterBenchmark(name.c_str(), &BM_Compress, bench_utils::makeStatePayload(displays, pretty));
+      }
+    }
+
+    return true;
+  }()};
+}  // namespace
@@ -0,0 +1,126 @@
+// header include
+#include "utils.h"
+
+// system includes
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <nlohmann/json.hpp>
+
+namespace bench_utils {
+  namespace {
+    /**
+     * @brief Base block of a real monitor EDID. Product code, serial number and checksum are overwritten.
+     */
+    constexpr std::array<std::uint8_t, 128> EDID_BASE_BLOCK {
+      // clang-format off
+      0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x69, 0xEC, 0x27, 0xAA, 0x55, 0x00, 0x00,
+      0x13, 0x1D, 0x01, 0x04, 0xA5, 0x3C, 0x22, 0x78, 0x06, 0xEE, 0x91, 0xA3, 0x54, 0x4C, 0x99, 0x26,
+      0x0F, 0x50, 0x54, 0x21, 0x08, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x56, 0x5E, 0x00, 0xA0, 0xA0, 0xA0, 0x29, 0x50, 0x30, 0x20,
+      0x35, 0x00, 0x56, 0x50, 0x21, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x23, 0x41, 0x53,
+      0x4E, 0x39, 0x4A, 0x36, 0x6E, 0x4E, 0x49, 0x54, 0x62, 0x64, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x1E,
+      0x90, 0x22, 0xDE, 0x3B, 0x01, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0xFC,
+      0x00, 0x52, 0x4F, 0x47, 0x20, 0x50, 0x47, 0x32, 0x37, 0x39, 0x51, 0x0A, 0x20, 0x20, 0x01, 0x00
+      // clang-format on
+    };
+
+    /**
+     * @brief CTA-861 extension block with HDR static metadata, HDMI Forum VRR range and two detailed timings.
+     */
+    constexpr std::array<std::uint8_t, 128> EDID_CTA_BLOCK {
+      // clang-format off
+      0x02, 0x03, 0x1F, 0xF0, 0x44, 0x90, 0x04, 0x10, 0x61, 0x6A, 0xD8, 0x5D, 0xC4, 0x01, 0x78, 0x80,
+      0x00, 0x20, 0x28, 0x78, 0xE6, 0x06, 0x0D, 0x01, 0x60, 0x40, 0x20, 0xE3, 0x05, 0xC0, 0x00, 0x02,
+      0x3A, 0x80, 0x18, 0x71, 0x38, 0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00, 0x40, 0x84, 0x63, 0x00, 0x00,
+      0x1E, 0x01, 0x1D, 0x80, 0x18, 0x71, 0x1C, 0x16, 0x20, 0x58, 0x2C, 0x45, 0x00, 0x40, 0x84, 0x63,
+      0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26
+      // clang-format on
+    };
+  }  // namespace
+
+  std::vector<BenchmarkDirectory> getBenchmarkDirectories() {
+    std::vector<BenchmarkDirectory> directories;
+
+    const char *fs_dir {std::getenv("DD_BENCHMARK_DIR")};
+    directories.push_back({"fs", fs_dir ? std::filesystem::path {fs_dir} : std::filesystem::temp_directory_path()});
+
+    const char *tmpfs_dir {std::getenv("DD_BENCHMARK_TMPFS_DIR")};
+    if (tmpfs_dir) {
+      directories.push_back({"tmpfs", tmpfs_dir});
+    } else if (std::error_code error_code; std::filesystem::is_directory("/dev/shm", error_code)) {
+      directories.push_back({"tmpfs", "/dev/shm"});
+    }
+
+    return directories;
+  }
+
+  std::vector<std::uint8_t> makeStatePayload(const std::size_t displays, const bool pretty) {
+    nlohmann::json topology = nlohmann::json::array();
+    nlohmann::json modes = nlohmann::json::object();
+    nlohmann::json hdr_states = nlohmann::json::object();
+    for (std::size_t i = 0; i < displays; ++i) {
+      const auto device_id {makeDeviceId(i)};
+      topology.push_back({device_id});
+      modes[device_id] = {
+        {"refresh_rate", {{"denominator", 1000}, {"numerator", 59940 + i}}},
+        {"resolution", {{"height", 1080 + i}, {"width", 1920 + i}}}
+      };
+      hdr_states[device_id] = i % 2 == 0 ? "Enabled" : "Disabled";
+    }
+
+    const nlohmann::json json {
+      {"data", {
+        {"initial", {{"primary_devices", {makeDeviceId(0)}}, {"topology", topology}}},
+        {"modified", {{"original_hdr_states", hdr_states}, {"original_modes", modes}, {"original_primary_device", makeDeviceId(0)}, {"topology", topology}}},
+      }},
+      {"version", 1}
+    };
+
+    const auto json_string {json.dump(pretty ? 2 : -1)};
+    return {std::begin(json_string), std::end(json_string)};
+  }
+
+  std::string makeDeviceId(const std::size_t index) {
+    std::array<char, 39> buffer {};
+    std::snprintf(buffer.data(), buffer.size(), "{77f67f3e-754f-5d31-af64-%012zx}", index);
+    return buffer.data();
+  }
+
+  std::vector<std::vector<std::byte>> makeEdidCorpus(const std::size_t count, const bool with_extension) {
+    std::vector<std::vector<std::byte>> corpus;
+    corpus.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+      std::vector<std::byte> edid;
+      edid.reserve(with_extension ? 256 : 128);
+      for (const auto byte : EDID_BASE_BLOCK) {
+        edid.push_back(std::byte {byte});
+      }
+      if (with_extension) {
+        for (const auto byte : EDID_CTA_BLOCK) {
+          edid.push_back(std::byte {byte});
+        }
+      }
+
+      // Product code and serial number
+      for (std::size_t byte = 0; byte < 6; ++byte) {
+        edid[10 + byte] = std::byte {static_cast<std::uint8_t>((static_cast<std::uint64_t>(i) * 2654435761u) >> (8 * byte))};
+      }
+      edid[126] = std::byte {static_cast<std::uint8_t>(with_extension ? 1 : 0)};
+
+      unsigned int sum {0};
+      for (std::size_t byte = 0; byte < 127; ++byte) {
+        sum += std::to_integer<unsigned int>(edid[byte]);
+      }
+      edid[127] = std::byte {static_cast<std::uint8_t>((256 - sum % 256) % 256)};
+
+      corpus.push_back(std::move(edid));
+    }
+
+    return corpus;
+  }
+}  // namespace bench_utils
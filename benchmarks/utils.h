@@ -0,0 +1,51 @@
+#pragma once
+
+// system includes
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace bench_utils {
+  /**
+   * @brief Directory to run the file based benchmarks in.
+   */
+  struct BenchmarkDirectory {
+    std::string m_name; /**< Short name used in the benchmark name. */
+    std::filesystem::path m_path; /**< Directory path. */
+  };
+
+  /**
+   * @brief Display counts to generate the payloads for.
+   */
+  inline const std::vector<std::size_t> DISPLAY_COUNTS {1, 2, 4, 8, 16, 32};
+
+  /**
+   * @brief Get the directories to run the file based benchmarks in.
+   *
+   * The "fs" directory defaults to the system temp directory and can be overridden with the
+   * `DD_BENCHMARK_DIR` environment variable. The "tmpfs" directory defaults to "/dev/shm" (if it exists)
+   * and can be overridden with the `DD_BENCHMARK_TMPFS_DIR` environment variable.
+   */
+  std::vector<BenchmarkDirectory> getBenchmarkDirectories();
+
+  /**
+   * @brief Generate a JSON payload resembling the persistent state of the specified number of displays.
+   * @param displays Number of displays in the state.
+   * @param pretty Specify whether the JSON should be pretty-printed or compact.
+   */
+  std::vector<std::uint8_t> makeStatePayload(std::size_t displays, bool pretty);
+
+  /**
+   * @brief Generate a device id for the display index.
+   */
+  std::string makeDeviceId(std::size_t index);
+
+  /**
+   * @brief Generate a corpus of valid EDIDs with unique product codes and serial numbers.
+   * @param count Number of EDIDs to generate.
+   * @param with_extension Specify whether the EDIDs should contain a CTA-861 extension block.
+   */
+  std::vector<std::vector<std::byte>> makeEdidCorpus(std::size_t count, bool with_extension);
+}  // namespace bench_utils
@@ -0,0 +1,96 @@
+// system includes
+#include <benchmark/benchmark.h>
+
+// local includes
+#include "display_device/compressed_settings_persistence.h"
+#include "display_device/file_settings_persistence.h"
+#include "display_device/memory_settings_persistence.h"
+#include "display_device/windows/json.h"
+#include "display_device/windows/persistent_state.h"
+#include "utils.h"
+
+namespace {
+  /**
+   * @brief Make a fully modified state for the specified number of displays.
+   * @param refresh_rate_offset Offset for the refresh rates, allowing to make different states of the same size.
+   */
+  display_device::SingleDisplayConfigState makeState(const std::size_t displays, const unsigned int refresh_rate_offset) {
+    display_device::SingleDisplayConfigState state;
+    for (std::size_t i = 0; i < displays; ++i) {
+      const display_device::DeviceId device_id {bench_utils::makeDeviceId(i)};
+      const auto index {static_cast<unsigned int>(i)};
+
+      state.m_initial.m_topology.push_back({device_id});
+      state.m_modified.m_topology.push_back({device_id});
+      state.m_modified.m_original_modes[device_id] = {{1920 + index, 1080 + index}, {59940 + refresh_rate_offset, 1000}};
+      state.m_modified.m_original_hdr_states[device_id] = i % 2 == 0 ? display_device::HdrState::Enabled : display_device::HdrState::Disabled;
+    }
+    state.m_initial.m_primary_devices = {bench_utils::makeDeviceId(0)};
+    state.m_modified.m_original_primary_device = bench_utils::makeDeviceId(0);
+    return state;
+  }
+
+  /**
+   * @brief Persist two alternating states, so that every call serializes and stores the state.
+   */
+  void BM_PersistState(benchmark::State &state, const std::shared_ptr<display_device::SettingsPersistenceInterface> &persistence, const std::size_t displays, const std::optional<unsigned int> &json_indent) {
+    const std::array<std::optional<display_device::SingleDisplayConfigState>, 2> states {makeState(displays, 0), makeState(displays, 1)};
+    display_device::PersistentState persistent_state {persistence, false, json_indent};
+
+    std::size_t index {0};
+    for (auto _ : state) {
+      if (!persistent_state.persistState(states[index])) {
+        state.SkipWithError("Failed to persist state!");
+        break;
+      }
+      index = (index + 1) % states.size();
+    }
+
+    state.counters["payload_bytes"] = static_cast<double>(persistence->load().value_or(std::vector<std::uint8_t> {}).size());
+    static_cast<void>(persistent_state.persistState(std::nullopt));
+  }
+
+  /**
+   * @brief Load and parse the persisted state.
+   */
+  void BM_LoadState(benchmark::State &state, const std::shared_ptr<display_device::SettingsPersistenceInterface> &persistence, const std::size_t displays, const std::optional<unsigned int> &json_indent) {
+    const auto json_string {display_device::toVersionedJson(makeState(displays, 0), json_indent)};
+    if (!persistence->store({std::begin(json_string), std::end(json_string)})) {
+      state.SkipWithError("Failed to store state!");
+      return;
+    }
+
+    for (auto _ : state) {
+      const display_device::PersistentState persistent_state {persistence, true};
+      benchmark::DoNotOptimize(persistent_state.getState());
+    }
+
+    state.counters["payload_bytes"] = static_cast<double>(json_string.size());
+    static_cast<void>(persistence->clear());
+  }
+
+  /**
+   * @brief Register the benchmarks for every directory, display count and JSON format.
+   */
+  [[maybe_unused]] const bool REGISTERED {[]() {
+    std::vector<std::pair<std::string, std::shared_ptr<display_device::SettingsPersistenceInterface>>> backends {
+      {"Memory/memory", std::make_shared<display_device::MemorySettingsPersistence>()},
+      {"CompressedMemory/memory", std::make_shared<display_device::CompressedSettingsPersistence>(std::make_shared<display_device::MemorySettingsPersistence>())}
+    };
+    for (const auto &directory : bench_utils::getBenchmarkDirectories()) {
+      backends.emplace_back("File/" + directory.m_name, std::make_shared<display_device::FileSettingsPersistence>(directory.m_path / "dd_benchmark_state.json"));
+    }
+
+    for (const auto &[backend_name, persistence] : backends) {
+      for (const auto displays : bench_utils::DISPLAY_COUNTS) {
+        for (const std::optional<unsigned int> json_indent : {std::optional<unsigned int> {2u}, std::optional<unsigned int> {}}) {
+          const auto suffix {"/" + backend_name + "/displays:" + std::to_string(displays) + "/" + (json_indent ? "pretty" : "compact")};
+          benchmark::RegisterBenchmark(("PersistentState/PersistState" + suffix).c_str(), BM_PersistState, persistence, displays, json_indent)->UseRealTime();
+          benchmark::RegisterBenchmark(("PersistentState/Load" + suffix).c_str(), BM_LoadState, persistence, displays, json_indent)->UseRealTime();
+        }
+      }
+    }
+
+    return true;
+  }()};
+}  // namespace
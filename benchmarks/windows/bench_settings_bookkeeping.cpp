@@ -0,0 +1,74 @@
+// system includes
+#include <benchmark/benchmark.h>
+#include <map>
+
+// local includes
+#include "display_device/windows/types.h"
+#include "utils.h"
+
+namespace {
+  /**
+   * @brief The node-based maps that were used before the flat maps, kept as a baseline.
+   */
+  using NodeDisplayModeMap = std::map<std::string, display_device::DisplayMode>;
+  using NodeHdrStateMap = std::map<std::string, std::optional<display_device::HdrState>>;
+
+  /**
+   * @brief Mimic the bookkeeping done by the settings manager while applying and reverting the settings.
+   *
+   * The original modes and HDR states are copied, the configured display is overridden, the result is
+   * compared against the current state and every display of the topology is looked up. Reverting copies
+   * the modified state again, restores the original entries and verifies that nothing else has changed.
+   */
+  template<class ModeMap, class HdrMap>
+  void BM_ApplyRevertBookkeeping(benchmark::State &state) {
+    const auto displays {static_cast<std::size_t>(state.range(0))};
+
+    std::vector<typename ModeMap::key_type> device_ids;
+    ModeMap original_modes;
+    HdrMap original_hdr_states;
+    for (std::size_t i = 0; i < displays; ++i) {
+      const auto index {static_cast<unsigned int>(i)};
+      device_ids.emplace_back(bench_utils::makeDeviceId(i));
+      original_modes[device_ids.back()] = {{1920 + index, 1080 + index}, {59940, 1000}};
+      original_hdr_states[device_ids.back()] = display_device::HdrState::Disabled;
+    }
+
+    for (auto _ : state) {
+      ModeMap new_modes {original_modes};
+      HdrMap new_hdr_states {original_hdr_states};
+      new_modes[device_ids.front()] = {{3840, 2160}, {120, 1}};
+      new_hdr_states[device_ids.front()] = display_device::HdrState::Enabled;
+
+      bool all_devices_found {new_modes != original_modes && new_hdr_states != original_hdr_states};
+      for (const auto &device_id : device_ids) {
+        all_devices_found = all_devices_found && new_modes.contains(device_id) && new_hdr_states.contains(device_id);
+      }
+
+      ModeMap reverted_modes {new_modes};
+      HdrMap reverted_hdr_states {new_hdr_states};
+      for (const auto &[device_id, mode] : original_modes) {
+        reverted_modes.insert_or_assign(device_id, mode);
+      }
+      for (const auto &[device_id, hdr_state] : original_hdr_states) {
+        reverted_hdr_states.insert_or_assign(device_id, hdr_state);
+      }
+
+      benchmark::DoNotOptimize(all_devices_found);
+      benchmark::DoNotOptimize(reverted_modes == original_modes && reverted_hdr_states == original_hdr_states);
+    }
+  }
+
+  /**
+   * @brief Register the display counts for the benchmark.
+   */
+  void applyDisplayCounts(benchmark::internal::Benchmark *benchmark) {
+    benchmark->ArgName("displays");
+    for (const auto displays : bench_utils::DISPLAY_COUNTS) {
+      benchmark->Arg(static_cast<std::int64_t>(displays));
+    }
+  }
+}  // namespace
+
+BENCHMARK(BM_ApplyRevertBookkeeping<NodeDisplayModeMap, NodeHdrStateMap>)->Name("SettingsBookkeeping/StdMap")->Apply(applyDisplayCounts);
+BENCHMARK(BM_ApplyRevertBookkeeping<display_device::DeviceDisplayModeMap, display_device::HdrStateMap>)->Name("SettingsBookkeeping/FlatMap")->Apply(applyDisplayCounts);
@@ -0,0 +1,21 @@
+#
+# Loads the google benchmark library giving the priority to the system package first, with a fallback
+# to the FetchContent.
+#
+include_guard(GLOBAL)
+
+find_package(benchmark 1.7 QUIET GLOBAL)
+if(NOT benchmark_FOUND)
+    message(STATUS "benchmark v1.7+ package not found in the system. Falling back to FetchContent.")
+    include(FetchContent)
+
+    set(BENCHMARK_ENABLE_TESTING OFF)
+    set(BENCHMARK_ENABLE_INSTALL OFF)
+    FetchContent_Declare(
+            benchmark
+            URL      https://github.com/google/benchmark/archive/refs/tags/v1.8.3.tar.gz
+            URL_HASH SHA256=6bc180a57d23d4d9515519f92b0c83d61b05b5bab188961f36ac7b06b0d9e9ce
+            DOWNLOAD_EXTRACT_TIMESTAMP
+    )
+    FetchContent_MakeAvailable(benchmark)
+endif()
@@ -0,0 +1,13 @@
+#
+# Loads the optional TBB library from the system. It is used as the backend for the parallel standard
+# algorithms by libstdc++. The parallel execution is disabled if it is not available.
+#
+include_guard(GLOBAL)
+
+find_package(TBB CONFIG QUIET)
+if(TARGET TBB::tbb)
+    set(DD_TBB_TARGET TBB::tbb)
+    message(STATUS "TBB package found in the system. Parallel algorithms are enabled.")
+else()
+    message(STATUS "TBB package not found in the system. Parallel algorithms are disabled.")
+endif()
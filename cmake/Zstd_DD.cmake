@@ -0,0 +1,19 @@
+#
+# Loads the optional zstd library from the system. The compression support is disabled if it is not available.
+#
+include_guard(GLOBAL)
+
+find_package(zstd CONFIG QUIET)
+if(TARGET zstd::libzstd)
+    set(DD_ZSTD_TARGET zstd::libzstd)
+elseif(TARGET zstd::libzstd_shared)
+    set(DD_ZSTD_TARGET zstd::libzstd_shared)
+elseif(TARGET zstd::libzstd_static)
+    set(DD_ZSTD_TARGET zstd::libzstd_static)
+endif()
+
+if(DD_ZSTD_TARGET)
+    message(STATUS "zstd package found in the system. Compression support is enabled.")
+else()
+    message(STATUS "zstd package not found in the system. Compression support is disabled.")
+endif()
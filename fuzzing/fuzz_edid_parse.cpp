@@ -0,0 +1,37 @@
+// system includes
+#include <cstdint>
+#include <cstdlib>
+#include <span>
+
+// local includes
+#include "display_device/json.h"
+#include "display_device/logging.h"
+#include "display_device/mode_catalog.h"
+
+extern "C" int LLVMFuzzerInitialize(int *, char ***) {
+  // Rejected inputs are logged as warnings, which would flood the output and skew the throughput
+  display_device::Logger::get().setLogLevel(display_device::Logger::LogLevel::fatal);
+  return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, const std::size_t size) {
+  const std::span<const std::byte> bytes {reinterpret_cast<const std::byte *>(data), size};
+  const auto edid {display_device::EdidData::parse(bytes)};
+  if (!edid) {
+    return 0;
+  }
+
+  // The parsed data is logged and persisted as JSON, so it must always be serializable
+  bool success {false};
+  static_cast<void>(display_device::toJson(*edid, std::nullopt, &success));
+  if (!success) {
+    std::abort();
+  }
+
+  const auto catalog {display_device::ModeCatalog::fromEdid(*edid)};
+  if (catalog.size() > edid->m_detailed_timings.size() + 1) {
+    std::abort();
+  }
+
+  return 0;
+}
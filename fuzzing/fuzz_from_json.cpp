@@ -0,0 +1,45 @@
+// system includes
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+// local includes
+#include "display_device/json.h"
+#include "display_device/logging.h"
+
+namespace {
+  /**
+   * @brief Parse the input as the specified type and verify that the accepted data can be serialized back.
+   */
+  template<typename Type>
+  void parseAs(const std::string &string) {
+    Type obj {};
+    if (!display_device::fromJson(string, obj)) {
+      return;
+    }
+
+    bool success {false};
+    static_cast<void>(display_device::toJson(obj, std::nullopt, &success));
+    if (!success) {
+      std::abort();
+    }
+  }
+}  // namespace
+
+extern "C" int LLVMFuzzerInitialize(int *, char ***) {
+  display_device::Logger::get().setLogLevel(display_device::Logger::LogLevel::fatal);
+  return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, const std::size_t size) {
+  // Every input is tried against every converter, so that the seeds do not need to encode the type
+  const std::string string {reinterpret_cast<const char *>(data), size};
+  parseAs<display_device::EdidData>(string);
+  parseAs<display_device::EnumeratedDevice>(string);
+  parseAs<display_device::EnumeratedDeviceList>(string);
+  parseAs<display_device::SingleDisplayConfiguration>(string);
+  parseAs<std::set<std::string>>(string);
+  parseAs<std::string>(string);
+  parseAs<bool>(string);
+  return 0;
+}
@@ -0,0 +1,92 @@
+# standard imports
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+# variables
+fuzzing_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'fuzzing')
+targets = {
+    'fuzz_edid_parse': {
+        'corpus': 'edid',
+        'args': ['-max_len=1024'],
+    },
+    'fuzz_from_json': {
+        'corpus': 'json',
+        'args': [f'-dict={os.path.join(fuzzing_dir, "json.dict")}'],
+    },
+}
+stats = {
+    'execs': r'stat::number_of_executed_units:\s+(\d+)',
+    'execs_per_sec': r'stat::average_exec_per_sec:\s+(\d+)',
+    'peak_rss_mb': r'stat::peak_rss_mb:\s+(\d+)',
+}
+
+
+def run_fuzzer(binary: str, target: dict, max_total_time: int, rss_limit_mb: int) -> dict:
+    """
+    Run the fuzzer on a scratch copy of the corpus and collect the final stats.
+    """
+    # New inputs are written to the first corpus directory, keeping the seed corpus untouched
+    with tempfile.TemporaryDirectory() as work_dir:
+        command = [
+            binary,
+            f'-max_total_time={max_total_time}',
+            f'-rss_limit_mb={rss_limit_mb}',
+            '-print_final_stats=1',
+            *target['args'],
+            work_dir,
+            os.path.join(fuzzing_dir, 'corpus', target['corpus']),
+        ]
+        result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True, errors='replace')
+
+    output = result.stdout
+    coverage = re.findall(r'cov: (\d+)', output)
+    data = {
+        'crashed': result.returncode != 0,
+        'coverage': int(coverage[-1]) if coverage else None,
+    }
+    for name, pattern in stats.items():
+        match = re.search(pattern, output)
+        data[name] = int(match.group(1)) if match else None
+
+    if data['crashed']:
+        print(output[-4000:], file=sys.stderr)
+
+    return data
+
+
+def main():
+    """
+    Main entry point.
+    """
+    parser = argparse.ArgumentParser(description='Run the fuzzers and record their throughput and peak memory usage.')
+    parser.add_argument('--build-dir', default='build-fuzz', help='CMake build directory with the fuzzers.')
+    parser.add_argument('--time', type=int, default=60, help='Seconds to run each fuzzer for.')
+    parser.add_argument('--rss-limit-mb', type=int, default=2048, help='Memory limit, exceeding it counts as a crash.')
+    parser.add_argument('--output', default='fuzz_results.json', help='File to write the results to.')
+    args = parser.parse_args()
+
+    results = {}
+    for name, target in targets.items():
+        binary = os.path.join(args.build_dir, 'fuzzing', name)
+        print(f'Running {name} for {args.time}s ...')
+        results[name] = run_fuzzer(binary=binary, target=target, max_total_time=args.time, rss_limit_mb=args.rss_limit_mb)
+
+    print(f'{"target":<20}{"execs/s":>12}{"peak rss MB":>14}{"coverage":>10}  status')
+    for name, data in results.items():
+        status = 'CRASHED' if data['crashed'] else 'ok'
+        print(f'{name:<20}{data["execs_per_sec"] or "-":>12}{data["peak_rss_mb"] or "-":>14}{data["coverage"] or "-":>10}  {status}')
+
+    with open(args.output, 'w') as file:
+        json.dump(results, file, indent=2)
+
+    if any(data['crashed'] for data in results.values()):
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,126 @@
+/**
+ * @file src/common/async_settings_persistence.cpp
+ * @brief Definitions for the AsyncSettingsPersistence.
+ */
+// class header include
+#include "display_device/async_settings_persistence.h"
+
+// system includes
+#include <stdexcept>
+
+// local includes
+#include "display_device/logging.h"
+
+namespace display_device {
+  AsyncSettingsPersistence::AsyncSettingsPersistence(std::shared_ptr<SettingsPersistenceInterface> settings_persistence_api, const std::chrono::milliseconds flush_delay):
+      m_settings_persistence_api {settings_persistence_api ? std::move(settings_persistence_api) : throw std::logic_error {"Nullptr provided for SettingsPersistenceInterface in AsyncSettingsPersistence!"}},
+      m_flush_delay {flush_delay > std::chrono::milliseconds::zero() ? flush_delay : throw std::logic_error {"Flush delay provided in AsyncSettingsPersistence must be larger than a 0!"}},
+      m_thread {[this]() {
+        std::unique_lock lock {m_mutex};
+        while (m_keep_alive) {
+          m_sleep_cv.wait(lock, [this]() {
+            return m_pending || !m_keep_alive;
+          });
+
+          // Either the deadline is reached, the operation is forwarded by someone else or we are stopping.
+          m_sleep_cv.wait_until(lock, m_deadline, [this]() {
+            return !m_pending || !m_keep_alive;
+          });
+
+          if (m_pending && m_keep_alive) {
+            static_cast<void>(forwardPending(lock));
+          }
+        }
+      }} {
+  }
+
+  AsyncSettingsPersistence::~AsyncSettingsPersistence() {
+    {
+      std::lock_guard lock {m_mutex};
+      m_keep_alive = false;
+      m_sleep_cv.notify_one();
+    }
+
+    m_thread.join();
+
+    std::unique_lock lock {m_mutex};
+    if (m_pending && !forwardPending(lock)) {
+      DD_LOG(error) << "Pending persistence operation was lost in AsyncSettingsPersistence!";
+    }
+  }
+
+  bool AsyncSettingsPersistence::store(const std::vector<std::uint8_t> &data) {
+    schedule({data});
+    return true;
+  }
+
+  std::optional<std::vector<std::uint8_t>> AsyncSettingsPersistence::load() const {
+    std::unique_lock lock {m_mutex};
+    if (m_pending) {
+      return m_pending->m_data ? *m_pending->m_data : std::vector<std::uint8_t> {};
+    }
+
+    // The main lock is not held during the load so that the new operations can still be accepted.
+    // An operation taken before this point already holds the api lock, so the load waits for it.
+    lock.unlock();
+    std::lock_guard api_lock {m_api_mutex};
+    return m_settings_persistence_api->load();
+  }
+
+  bool AsyncSettingsPersistence::clear() {
+    schedule({std::nullopt});
+    return true;
+  }
+
+  bool AsyncSettingsPersistence::flush() {
+    std::unique_lock lock {m_mutex};
+
+    // Wait for the operations in progress, a failed one is rescheduled before it is no longer counted
+    m_forward_cv.wait(lock, [this]() {
+      return m_forwards_in_progress == 0;
+    });
+
+    return !m_pending || forwardPending(lock);
+  }
+
+  void AsyncSettingsPersistence::schedule(PendingOperation operation) {
+    std::lock_guard lock {m_mutex};
+    if (!m_pending) {
+      // The deadline is not postponed by the subsequent operations, otherwise it could be postponed indefinitely.
+      m_deadline = std::chrono::steady_clock::now() + m_flush_delay;
+    }
+
+    operation.m_generation = ++m_last_generation;
+    m_pending = std::move(operation);
+    m_sleep_cv.notify_one();
+  }
+
+  bool AsyncSettingsPersistence::forwardPending(std::unique_lock<std::mutex> &lock) {
+    auto operation {std::move(*m_pending)};
+    m_pending = std::nullopt;
+    ++m_forwards_in_progress;
+
+    // The api lock is acquired before releasing the main lock so that nobody can observe
+    // the state where the operation is neither pending nor forwarded.
+    std::unique_lock api_lock {m_api_mutex};
+    lock.unlock();
+
+    const bool success {operation.m_data ? m_settings_persistence_api->store(*operation.m_data) : m_settings_persistence_api->clear()};
+
+    api_lock.unlock();
+    lock.lock();
+
+    if (!success) {
+      DD_LOG(error) << "Failed to forward persistence operation in AsyncSettingsPersistence!";
+      // A newer operation might have already been taken by someone else (e.g. `flush`) and must not be overwritten later
+      if (!m_pending && operation.m_generation == m_last_generation) {
+        m_pending = std::move(operation);
+        m_deadline = std::chrono::steady_clock::now() + m_flush_delay;
+      }
+    }
+
+    --m_forwards_in_progress;
+    m_forward_cv.notify_all();
+    return success;
+  }
+}  // namespace display_device
@@ -0,0 +1,201 @@
+/**
+ * @file src/common/checksum.cpp
+ * @brief Definitions for private checksum helpers.
+ */
+// header include
+#include "display_device/detail/checksum.h"
+
+// system includes
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+  #define DD_CRC32C_HW_X86
+  #include <nmmintrin.h>
+  #ifdef _MSC_VER
+    #include <intrin.h>
+    #define DD_CRC32C_HW_TARGET
+  #else
+    #define DD_CRC32C_HW_TARGET __attribute__((target("sse4.2")))
+  #endif
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+  #define DD_CRC32C_HW_ARM
+  #include <arm_acle.h>
+#endif
+
+// SSE2 and NEON are part of the x86-64 and AArch64 baselines, no runtime detection is needed
+#if defined(__x86_64__) || defined(_M_X64)
+  #define DD_BYTE_SUM_SSE2
+  #include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  #define DD_BYTE_SUM_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace display_device::detail {
+  namespace {
+    /**
+     * @brief Reflected CRC-32C polynomial.
+     */
+    constexpr std::uint32_t CRC32C_POLYNOMIAL {0x82F63B78};
+
+    /**
+     * @brief Make the byte lookup table for the CRC-32C computation.
+     */
+    constexpr std::array<std::uint32_t, 256> makeCrc32cTable() {
+      std::array<std::uint32_t, 256> table {};
+      for (std::uint32_t i = 0; i < table.size(); ++i) {
+        std::uint32_t value {i};
+        for (int bit = 0; bit < 8; ++bit) {
+          value = (value & 1) ? (value >> 1) ^ CRC32C_POLYNOMIAL : value >> 1;
+        }
+        table[i] = value;
+      }
+      return table;
+    }
+
+    constexpr auto CRC32C_TABLE {makeCrc32cTable()};
+
+    /**
+     * @brief Compute the CRC-32C checksum using the lookup table.
+     * @note The checksum is neither pre- nor post-inverted.
+     */
+    std::uint32_t crc32cSoftware(const std::span<const std::uint8_t> data, std::uint32_t crc) {
+      for (const auto byte : data) {
+        crc = CRC32C_TABLE[(crc ^ byte) & 0xFF] ^ (crc >> 8);
+      }
+      return crc;
+    }
+
+#if defined(DD_CRC32C_HW_X86)
+    /**
+     * @brief Check whether the CPU supports the SSE4.2 CRC32 instruction.
+     */
+    bool hasHardwareCrc32c() {
+      static const bool supported {[]() {
+  #ifdef _MSC_VER
+        std::array<int, 4> info {};
+        __cpuid(info.data(), 1);
+        return ((info[2] >> 20) & 1) != 0;
+  #else
+        return __builtin_cpu_supports("sse4.2") != 0;
+  #endif
+      }()};
+      return supported;
+    }
+
+    /**
+     * @brief Compute the CRC-32C checksum using the SSE4.2 CRC32 instruction.
+     * @note The checksum is neither pre- nor post-inverted.
+     */
+    DD_CRC32C_HW_TARGET std::uint32_t crc32cHardware(const std::span<const std::uint8_t> data, std::uint32_t crc) {
+      const auto *it {data.data()};
+      const auto *const end {it + data.size()};
+
+      std::uint64_t crc64 {crc};
+      for (; end - it >= 8; it += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, it, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+      }
+
+      crc = static_cast<std::uint32_t>(crc64);
+      for (; it != end; ++it) {
+        crc = _mm_crc32_u8(crc, *it);
+      }
+      return crc;
+    }
+#elif defined(DD_CRC32C_HW_ARM)
+    /**
+     * @brief The CRC32 extension is guaranteed by the compile target.
+     */
+    constexpr bool hasHardwareCrc32c() {
+      return true;
+    }
+
+    /**
+     * @brief Compute the CRC-32C checksum using the ARMv8 CRC32 extension.
+     * @note The checksum is neither pre- nor post-inverted.
+     */
+    std::uint32_t crc32cHardware(const std::span<const std::uint8_t> data, std::uint32_t crc) {
+      const auto *it {data.data()};
+      const auto *const end {it + data.size()};
+
+      for (; end - it >= 8; it += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, it, sizeof(word));
+        crc = __crc32cd(crc, word);
+      }
+
+      for (; it != end; ++it) {
+        crc = __crc32cb(crc, *it);
+      }
+      return crc;
+    }
+#endif
+
+    /**
+     * @brief FNV-1a 64-bit offset basis.
+     */
+    constexpr std::uint64_t FNV1A64_OFFSET_BASIS {0xCBF29CE484222325};
+
+    /**
+     * @brief FNV-1a 64-bit prime.
+     */
+    constexpr std::uint64_t FNV1A64_PRIME {0x100000001B3};
+
+    /**
+     * @brief Compute the sum of the bytes one by one.
+     */
+    std::uint32_t sumBytesScalar(const std::span<const std::uint8_t> data, std::uint32_t sum) {
+      for (const auto byte : data) {
+        sum += byte;
+      }
+      return sum;
+    }
+  }  // namespace
+
+  std::uint32_t crc32c(const std::span<const std::uint8_t> data, const std::uint32_t crc) {
+#if defined(DD_CRC32C_HW_X86) || defined(DD_CRC32C_HW_ARM)
+    if (hasHardwareCrc32c()) {
+      return ~crc32cHardware(data, ~crc);
+    }
+#endif
+
+    return ~crc32cSoftware(data, ~crc);
+  }
+
+  std::uint64_t fnv1a64(const std::span<const std::uint8_t> data) {
+    std::uint64_t hash {FNV1A64_OFFSET_BASIS};
+    for (const auto byte : data) {
+      hash = (hash ^ byte) * FNV1A64_PRIME;
+    }
+    return hash;
+  }
+
+  std::uint32_t sumBytes(const std::span<const std::uint8_t> data) {
+    const auto *it {data.data()};
+    const auto *const end {it + data.size()};
+    std::uint32_t sum {0};
+
+#if defined(DD_BYTE_SUM_SSE2)
+    // Sum of absolute differences against zero adds up 8 bytes into each of the two 64-bit lanes
+    const __m128i zero {_mm_setzero_si128()};
+    __m128i sums {_mm_setzero_si128()};
+    for (; end - it >= 16; it += 16) {
+      const __m128i bytes {_mm_loadu_si128(reinterpret_cast<const __m128i *>(it))};
+      sums = _mm_add_epi64(sums, _mm_sad_epu8(bytes, zero));
+    }
+    sum = static_cast<std::uint32_t>(_mm_cvtsi128_si64(sums) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(sums, sums)));
+#elif defined(DD_BYTE_SUM_NEON)
+    // Pairwise widening adds, 16-bit lanes cannot overflow within a single iteration
+    uint32x4_t sums {vdupq_n_u32(0)};
+    for (; end - it >= 16; it += 16) {
+      sums = vpadalq_u16(sums, vpaddlq_u8(vld1q_u8(it)));
+    }
+    sum = vaddvq_u32(sums);
+#endif
+
+    return sumBytesScalar({it, end}, sum);
+  }
+}  // namespace display_device::detail
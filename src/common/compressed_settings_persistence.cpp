@@ -0,0 +1,108 @@
+/**
+ * @file src/common/compressed_settings_persistence.cpp
+ * @brief Definitions for the CompressedSettingsPersistence.
+ */
+// class header include
+#include "display_device/compressed_settings_persistence.h"
+
+// system includes
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+#ifdef DD_ZSTD_AVAILABLE
+  #include <zstd.h>
+#endif
+
+// local includes
+#include "display_device/logging.h"
+
+namespace display_device {
+  namespace {
+    /**
+     * @brief Magic number at the beginning of every zstd frame (0xFD2FB528 in little-endian).
+     * @note Valid JSON can never start with these bytes.
+     */
+    constexpr std::array<std::uint8_t, 4> ZSTD_MAGIC {0x28, 0xB5, 0x2F, 0xFD};
+
+    /**
+     * @brief Check whether the data is a zstd frame.
+     */
+    bool isCompressed(const std::vector<std::uint8_t> &data) {
+      return data.size() >= ZSTD_MAGIC.size() && std::equal(std::begin(ZSTD_MAGIC), std::end(ZSTD_MAGIC), std::begin(data));
+    }
+  }  // namespace
+
+  CompressedSettingsPersistence::CompressedSettingsPersistence(std::shared_ptr<SettingsPersistenceInterface> settings_persistence_api, const int compression_level):
+      m_settings_persistence_api {std::move(settings_persistence_api)},
+      m_compression_level {compression_level} {
+    if (!m_settings_persistence_api) {
+      throw std::logic_error {"Nullptr provided for SettingsPersistenceInterface in CompressedSettingsPersistence!"};
+    }
+
+    if (!isCompressionAvailable()) {
+      DD_LOG(warning) << "Library was built without the compression support. Data will be stored uncompressed.";
+    }
+  }
+
+  bool CompressedSettingsPersistence::store(const std::vector<std::uint8_t> &data) {
+#ifdef DD_ZSTD_AVAILABLE
+    std::vector<std::uint8_t> compressed(ZSTD_compressBound(data.size()));
+    const auto result {ZSTD_compress(compressed.data(), compressed.size(), data.data(), data.size(), m_compression_level)};
+    if (ZSTD_isError(result)) {
+      DD_LOG(error) << "Failed to compress persistent settings! Error:\n"
+                    << ZSTD_getErrorName(result);
+      return false;
+    }
+
+    compressed.resize(result);
+    return m_settings_persistence_api->store(compressed);
+#else
+    return m_settings_persistence_api->store(data);
+#endif
+  }
+
+  std::optional<std::vector<std::uint8_t>> CompressedSettingsPersistence::load() const {
+    auto data {m_settings_persistence_api->load()};
+    if (!data || !isCompressed(*data)) {
+      return data;
+    }
+
+#ifdef DD_ZSTD_AVAILABLE
+    const auto content_size {ZSTD_getFrameContentSize(data->data(), data->size())};
+    if (content_size == ZSTD_CONTENTSIZE_ERROR || content_size == ZSTD_CONTENTSIZE_UNKNOWN || content_size > MAX_DECOMPRESSED_SIZE) {
+      DD_LOG(error) << "Compressed persistent settings have invalid or unsupported content size!";
+      return std::nullopt;
+    }
+
+    std::vector<std::uint8_t> decompressed(static_cast<std::size_t>(content_size));
+    const auto result {ZSTD_decompress(decompressed.data(), decompressed.size(), data->data(), data->size())};
+    if (ZSTD_isError(result) || result != decompressed.size()) {
+      DD_LOG(error) << "Failed to decompress persistent settings! Error:\n"
+                    << (ZSTD_isError(result) ? ZSTD_getErrorName(result) : "size mismatch");
+      return std::nullopt;
+    }
+
+    return decompressed;
+#else
+    DD_LOG(error) << "Persistent settings are compressed, but the library was built without the compression support!";
+    return std::nullopt;
+#endif
+  }
+
+  bool CompressedSettingsPersistence::clear() {
+    return m_settings_persistence_api->clear();
+  }
+
+  bool CompressedSettingsPersistence::prefersIntermediateStores() const {
+    return m_settings_persistence_api->prefersIntermediateStores();
+  }
+
+  bool CompressedSettingsPersistence::isCompressionAvailable() {
+#ifdef DD_ZSTD_AVAILABLE
+    return true;
+#else
+    return false;
+#endif
+  }
+}  // namespace display_device
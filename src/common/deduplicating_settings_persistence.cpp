@@ -0,0 +1,62 @@
+/**
+ * @file src/common/deduplicating_settings_persistence.cpp
+ * @brief Definitions for the DeduplicatingSettingsPersistence.
+ */
+// class header include
+#include "display_device/deduplicating_settings_persistence.h"
+
+// system includes
+#include <stdexcept>
+
+// local includes
+#include "display_device/detail/checksum.h"
+
+namespace display_device {
+  DeduplicatingSettingsPersistence::DeduplicatingSettingsPersistence(std::shared_ptr<SettingsPersistenceInterface> settings_persistence_api):
+      m_settings_persistence_api {std::move(settings_persistence_api)} {
+    if (!m_settings_persistence_api) {
+      throw std::logic_error {"Nullptr provided for SettingsPersistenceInterface in DeduplicatingSettingsPersistence!"};
+    }
+  }
+
+  bool DeduplicatingSettingsPersistence::store(const std::vector<std::uint8_t> &data) {
+    const auto fingerprint {makeFingerprint(data)};
+    if (m_last_fingerprint == fingerprint) {
+      m_stats.m_hits++;
+      return true;
+    }
+
+    m_stats.m_misses++;
+    if (!m_settings_persistence_api->store(data)) {
+      // We no longer know what is in the persistent medium
+      m_last_fingerprint = std::nullopt;
+      return false;
+    }
+
+    m_last_fingerprint = fingerprint;
+    return true;
+  }
+
+  std::optional<std::vector<std::uint8_t>> DeduplicatingSettingsPersistence::load() const {
+    auto data {m_settings_persistence_api->load()};
+    m_last_fingerprint = data ? std::make_optional(makeFingerprint(*data)) : std::nullopt;
+    return data;
+  }
+
+  bool DeduplicatingSettingsPersistence::clear() {
+    m_last_fingerprint = std::nullopt;
+    return m_settings_persistence_api->clear();
+  }
+
+  bool DeduplicatingSettingsPersistence::prefersIntermediateStores() const {
+    return m_settings_persistence_api->prefersIntermediateStores();
+  }
+
+  DeduplicatingSettingsPersistence::Stats DeduplicatingSettingsPersistence::getStats() const {
+    return m_stats;
+  }
+
+  DeduplicatingSettingsPersistence::Fingerprint DeduplicatingSettingsPersistence::makeFingerprint(const std::vector<std::uint8_t> &data) {
+    return {data.size(), detail::fnv1a64(data)};
+  }
+}  // namespace display_device
@@ -0,0 +1,169 @@
+/**
+ * @file src/common/device_id.cpp
+ * @brief Definitions for the interned DeviceId.
+ */
+// class header include
+#include "display_device/device_id.h"
+
+// system includes
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+// local includes
+#include "display_device/logging.h"
+
+namespace display_device {
+  namespace {
+    /**
+     * @brief Process-wide table of the interned device id strings.
+     *
+     * Strings are stored in fixed-size chunks that are never moved or released, so that the
+     * handle can be resolved without locking. Only the string lookup and insertion are locked.
+     */
+    class InternTable {
+    public:
+      /**
+       * @brief Get the table instance.
+       */
+      static InternTable &get() {
+        static InternTable instance;
+        return instance;
+      }
+
+      /**
+       * @brief Get the handle of the string, interning it if needed.
+       * @return Handle of the string, or 0 (empty id) if the table is full.
+       */
+      std::uint32_t intern(const std::string_view id) {
+        if (id.empty()) {
+          return 0;
+        }
+
+        {
+          std::shared_lock lock {m_mutex};
+          if (const auto it {m_handles.find(id)}; it != std::end(m_handles)) {
+            return it->second;
+          }
+        }
+
+        std::unique_lock lock {m_mutex};
+        if (const auto it {m_handles.find(id)}; it != std::end(m_handles)) {
+          return it->second;
+        }
+
+        const auto handle {m_size};
+        const auto chunk_index {handle / CHUNK_SIZE};
+        if (chunk_index >= MAX_CHUNKS) {
+          DD_LOG(error) << "Too many device ids have been interned! Failed to intern: " << id;
+          return 0;
+        }
+
+        if (handle % CHUNK_SIZE == 0) {
+          m_chunk_storage.push_back(std::make_unique<Chunk>());
+          m_chunks[chunk_index].store(m_chunk_storage.back().get(), std::memory_order_release);
+        }
+
+        auto &string {(*m_chunks[chunk_index].load(std::memory_order_relaxed))[handle % CHUNK_SIZE]};
+        string = id;
+        m_handles.emplace(string, handle);
+        ++m_size;
+        return handle;
+      }
+
+      /**
+       * @brief Get the handle of the already interned string.
+       * @return Handle of the string, or 0 (empty id) if it was never interned.
+       */
+      std::uint32_t find(const std::string_view id) const {
+        if (id.empty()) {
+          return 0;
+        }
+
+        std::shared_lock lock {m_mutex};
+        const auto it {m_handles.find(id)};
+        return it != std::end(m_handles) ? it->second : 0;
+      }
+
+      /**
+       * @brief Get the interned string of the handle.
+       */
+      const std::string &resolve(const std::uint32_t handle) const {
+        return (*m_chunks[handle / CHUNK_SIZE].load(std::memory_order_acquire))[handle % CHUNK_SIZE];
+      }
+
+    private:
+      static constexpr std::uint32_t CHUNK_SIZE {256};
+      static constexpr std::uint32_t MAX_CHUNKS {4096};
+      using Chunk = std::array<std::string, CHUNK_SIZE>;
+
+      InternTable() {
+        // Handle 0 is reserved for the empty id
+        m_chunk_storage.push_back(std::make_unique<Chunk>());
+        m_chunks[0].store(m_chunk_storage.back().get(), std::memory_order_release);
+        m_size = 1;
+      }
+
+      mutable std::shared_mutex m_mutex;
+      std::array<std::atomic<Chunk *>, MAX_CHUNKS> m_chunks {};
+      std::vector<std::unique_ptr<Chunk>> m_chunk_storage;
+      std::unordered_map<std::string_view, std::uint32_t> m_handles; /**< Views into the chunk storage. */
+      std::uint32_t m_size {0};
+    };
+  }  // namespace
+
+  DeviceId::DeviceId(const std::string_view id):
+      m_handle {InternTable::get().intern(id)} {
+  }
+
+  DeviceId::DeviceId(const std::string &id):
+      DeviceId {std::string_view {id}} {
+  }
+
+  DeviceId::DeviceId(const char *id):
+      DeviceId {id ? std::string_view {id} : std::string_view {}} {
+  }
+
+  DeviceId DeviceId::find(const std::string_view id) {
+    DeviceId device_id;
+    device_id.m_handle = InternTable::get().find(id);
+    return device_id;
+  }
+
+  const std::string &DeviceId::str() const {
+    return InternTable::get().resolve(m_handle);
+  }
+
+  DeviceId::operator const std::string &() const {
+    return str();
+  }
+
+  bool DeviceId::empty() const {
+    return m_handle == 0;
+  }
+
+  std::uint32_t DeviceId::getHandle() const {
+    return m_handle;
+  }
+
+  bool operator==(const DeviceId &lhs, const std::string_view rhs) {
+    return lhs.str() == rhs;
+  }
+
+  std::strong_ordering operator<=>(const DeviceId &lhs, const DeviceId &rhs) {
+    if (lhs.m_handle == rhs.m_handle) {
+      return std::strong_ordering::equal;
+    }
+
+    return lhs.str().compare(rhs.str()) <=> 0;
+  }
+
+  std::ostream &operator<<(std::ostream &stream, const DeviceId &id) {
+    return stream << id.str();
+  }
+}  // namespace display_device
@@ -0,0 +1,29 @@
+/**
+ * @file src/common/display_config.cpp
+ * @brief Definitions for the platform-neutral display configuration model.
+ */
+// header include
+#include "display_device/display_config.h"
+
+namespace display_device {
+  bool operator==(const AdapterId &lhs, const AdapterId &rhs) {
+    return lhs.m_low_part == rhs.m_low_part && lhs.m_high_part == rhs.m_high_part;
+  }
+
+  bool operator==(const DisplayPath &lhs, const DisplayPath &rhs) {
+    return lhs.m_adapter_id == rhs.m_adapter_id && lhs.m_source_id == rhs.m_source_id && lhs.m_target_id == rhs.m_target_id &&
+           lhs.m_available == rhs.m_available && lhs.m_active == rhs.m_active && lhs.m_source_mode_index == rhs.m_source_mode_index;
+  }
+
+  bool operator==(const DisplaySourceMode &lhs, const DisplaySourceMode &rhs) {
+    return lhs.m_position == rhs.m_position && lhs.m_size == rhs.m_size;
+  }
+
+  bool operator==(const PathSourceIndexData &lhs, const PathSourceIndexData &rhs) {
+    return lhs.m_source_id_to_path_index == rhs.m_source_id_to_path_index && lhs.m_adapter_id == rhs.m_adapter_id && lhs.m_active_source == rhs.m_active_source;
+  }
+
+  bool operator==(const TopologyPath &lhs, const TopologyPath &rhs) {
+    return lhs.m_path_index == rhs.m_path_index && lhs.m_clone_group_id == rhs.m_clone_group_id;
+  }
+}  // namespace display_device
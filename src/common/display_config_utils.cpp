@@ -0,0 +1,307 @@
+/**
+ * @file src/common/display_config_utils.cpp
+ * @brief Definitions for the platform-neutral display configuration algorithms.
+ */
+// header include
+#include "display_device/display_config_utils.h"
+
+// system includes
+#include <unordered_map>
+#include <unordered_set>
+
+// local includes
+#include "display_device/flat_map.h"
+#include "display_device/logging.h"
+
+namespace display_device::config_utils {
+  namespace {
+    /**
+     * @brief Check if the source modes are duplicated (cloned).
+     * @param lhs First mode to check.
+     * @param rhs Second mode to check.
+     * @returns True if both mode have the same origin point, false otherwise.
+     * @note Windows enforces the behaviour that only the duplicate devices can
+     *       have the same origin point as otherwise the configuration is considered invalid by the OS.
+     */
+    bool areModesDuplicated(const DisplaySourceMode &lhs, const DisplaySourceMode &rhs) {
+      return lhs.m_position == rhs.m_position;
+    }
+  }  // namespace
+
+  const DisplaySourceMode *getSourceMode(const DisplayPath &path, const std::span<const std::optional<DisplaySourceMode>> modes) {
+    if (!path.m_source_mode_index) {
+      return nullptr;
+    }
+
+    const auto index {*path.m_source_mode_index};
+    if (index >= modes.size()) {
+      DD_LOG(error) << "Source index " << index << " is out of range " << modes.size();
+      return nullptr;
+    }
+
+    const auto &mode {modes[index]};
+    if (!mode) {
+      DD_LOG(error) << "Mode at index " << index << " is not source mode!";
+      return nullptr;
+    }
+
+    return &*mode;
+  }
+
+  std::optional<ValidatedDeviceInfo> getDeviceInfoForValidPath(const std::span<const DisplayPath> paths, const std::size_t path_index, const ValidatedPathType type, const DeviceInfoResolver &resolver) {
+    const auto &path {paths[path_index]};
+    if (!path.m_available) {
+      // Could be transient issue according to MSDOCS (no longer available, but still "active")
+      return std::nullopt;
+    }
+
+    if (type == ValidatedPathType::Active && !path.m_active) {
+      return std::nullopt;
+    }
+
+    return resolver(path_index);
+  }
+
+  std::optional<std::size_t> getActivePathIndex(const std::span<const DisplayPath> paths, const DeviceId &device_id, const DeviceInfoResolver &resolver) {
+    for (std::size_t index = 0; index < paths.size(); ++index) {
+      const auto device_info {getDeviceInfoForValidPath(paths, index, ValidatedPathType::Active, resolver)};
+      if (!device_info) {
+        continue;
+      }
+
+      if (device_info->m_device_id == device_id.str()) {
+        return index;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  PathSourceIndexDataMap collectSourceDataForMatchingPaths(const std::span<const DisplayPath> paths, const DeviceInfoResolver &resolver) {
+    // Keyed by the plain strings so that the ids are interned only once per device at the end
+    std::unordered_map<std::string, PathSourceIndexData> path_data;
+
+    std::unordered_map<std::string, std::string> paths_to_ids;
+    std::unordered_map<std::string, std::string> ids_to_paths;
+    for (std::size_t index = 0; index < paths.size(); ++index) {
+      const auto &path {paths[index]};
+
+      const auto device_info {getDeviceInfoForValidPath(paths, index, ValidatedPathType::Any, resolver)};
+      if (!device_info) {
+        // Path is not valid
+        continue;
+      }
+
+      const auto prev_device_id_for_path_it {paths_to_ids.find(device_info->m_device_path)};
+      if (prev_device_id_for_path_it != std::end(paths_to_ids)) {
+        if (prev_device_id_for_path_it->second != device_info->m_device_id) {
+          DD_LOG(error) << "Duplicate display device id found: " << device_info->m_device_id << " (device path: " << device_info->m_device_path << ")";
+          return {};
+        }
+      } else {
+        // The path is seen for the first time, so any previous path with the same id is a different one
+        const auto [prev_path_for_device_id_it, inserted] {ids_to_paths.try_emplace(device_info->m_device_id, device_info->m_device_path)};
+        if (!inserted) {
+          DD_LOG(error) << "Device id " << device_info->m_device_id << " is shared between 2 different paths: " << prev_path_for_device_id_it->second << " and " << device_info->m_device_path;
+          return {};
+        }
+
+        paths_to_ids[device_info->m_device_path] = device_info->m_device_id;
+      }
+
+      auto path_data_it {path_data.find(device_info->m_device_id)};
+      if (path_data_it != std::end(path_data)) {
+        if (path_data_it->second.m_adapter_id != path.m_adapter_id) {
+          // Sanity check, should not be possible since adapter in embedded in the device path
+          DD_LOG(error) << "Device path " << device_info->m_device_path << " has different adapters!";
+          return {};
+        } else if (path.m_active) {
+          // Sanity check, should not be possible as all active paths are in the front
+          DD_LOG(error) << "Device path " << device_info->m_device_path << " is active, but not the first entry in the list!";
+          return {};
+        } else if (path_data_it->second.m_source_id_to_path_index.contains(path.m_source_id)) {
+          // Sanity check, should not be possible unless the OS goes bonkers
+          DD_LOG(error) << "Device path " << device_info->m_device_path << " has duplicate source ids!";
+          return {};
+        }
+
+        path_data_it->second.m_source_id_to_path_index[path.m_source_id] = index;
+      } else {
+        path_data[device_info->m_device_id] = {
+          {{path.m_source_id, index}},
+          path.m_adapter_id,
+          // Since active paths are always in the front, this is the only time we set it
+          path.m_active ? std::make_optional(path.m_source_id) : std::nullopt
+        };
+      }
+
+      DD_LOG(verbose) << "Device " << device_info->m_device_id << " (active: " << path.m_active << ") at index " << index << " added to the source data list.";
+    }
+
+    if (path_data.empty()) {
+      DD_LOG(error) << "Failed to collect path source data or none was available!";
+      return {};
+    }
+
+    PathSourceIndexDataMap path_data_per_device_id;
+    for (auto &[device_id, data] : path_data) {
+      path_data_per_device_id.emplace(DeviceId {device_id}, std::move(data));
+    }
+    return path_data_per_device_id;
+  }
+
+  std::vector<TopologyPath> makePathsForNewTopology(const ActiveTopology &new_topology, const PathSourceIndexDataMap &path_source_data, const std::size_t path_count) {
+    std::vector<TopologyPath> new_paths;
+
+    std::uint32_t group_id {0};
+    std::unordered_map<AdapterId, FlatSet<std::uint32_t>> used_source_ids_per_adapter;
+    const auto is_source_id_already_used = [&used_source_ids_per_adapter](const AdapterId &adapter_id, std::uint32_t source_id) {
+      auto entry_it {used_source_ids_per_adapter.find(adapter_id)};
+      if (entry_it != std::end(used_source_ids_per_adapter)) {
+        return entry_it->second.contains(source_id);
+      }
+
+      return false;
+    };
+
+    for (const auto &group : new_topology) {
+      // Groups contain only a couple of devices, so a flat map is enough
+      FlatMap<std::uint64_t, std::uint32_t> used_source_ids_per_adapter_per_group;
+      const auto get_already_used_source_id_in_group = [&used_source_ids_per_adapter_per_group](const AdapterId &adapter_id) -> std::optional<std::uint32_t> {
+        auto entry_it {used_source_ids_per_adapter_per_group.find(packAdapterId(adapter_id))};
+        if (entry_it != std::end(used_source_ids_per_adapter_per_group)) {
+          return entry_it->second;
+        }
+
+        return std::nullopt;
+      };
+
+      for (const auto &device_id : group) {
+        auto path_source_data_it {path_source_data.find(device_id)};
+        if (path_source_data_it == std::end(path_source_data)) {
+          DD_LOG(error) << "Device " << device_id << " does not exist in the available path source data!";
+          return {};
+        }
+
+        std::size_t selected_path_index {};
+        const auto &source_data {path_source_data_it->second};
+
+        const auto already_used_source_id {get_already_used_source_id_in_group(source_data.m_adapter_id)};
+        if (already_used_source_id) {
+          // Some device in the group is already using the source id, and we belong to the same adapter.
+          // This means we must also use the path with matching source id.
+          auto path_index_it {source_data.m_source_id_to_path_index.find(*already_used_source_id)};
+          if (path_index_it == std::end(source_data.m_source_id_to_path_index)) {
+            DD_LOG(error) << "Device " << device_id << " does not have a path with a source id " << *already_used_source_id << "!";
+            return {};
+          }
+
+          selected_path_index = path_index_it->second;
+        } else {
+          // Here we want to select a path index that has the lowest index (the "best" of paths), but only
+          // if the source id is still free. Technically we should not need to find the lowest index, but that's
+          // what will match the Windows' behaviour the closest if we need to create new topology in the end.
+          std::optional<std::size_t> path_index_candidate;
+          std::uint32_t used_source_id {};
+          for (const auto &[source_id, index] : source_data.m_source_id_to_path_index) {
+            if (is_source_id_already_used(source_data.m_adapter_id, source_id)) {
+              continue;
+            }
+
+            if (!path_index_candidate || index < *path_index_candidate) {
+              path_index_candidate = index;
+              used_source_id = source_id;
+            }
+          }
+
+          if (!path_index_candidate) {
+            // Apparently nvidia GPU can only render 4 different sources at a time (according to Google).
+            // However, it seems to be true only for physical connections as we also have virtual displays.
+            //
+            // Virtual displays have different adapter ids than the physical connection ones, but GPU still
+            // has to render them, so I don't know how this 4 source limitation makes sense then?
+            //
+            // In short, this arbitrary limitation should not affect virtual displays when the GPU is at its limit.
+            DD_LOG(error) << "Device " << device_id << " cannot be enabled as the adapter has no more free source ids (GPU limitation)!";
+            return {};
+          }
+
+          selected_path_index = *path_index_candidate;
+          used_source_ids_per_adapter[source_data.m_adapter_id].insert(used_source_id);
+          used_source_ids_per_adapter_per_group.insert_or_assign(packAdapterId(source_data.m_adapter_id), used_source_id);
+        }
+
+        if (selected_path_index >= path_count) {
+          DD_LOG(error) << "Selected path index " << selected_path_index << " is out of range! List size: " << path_count;
+          return {};
+        }
+
+        new_paths.push_back({selected_path_index, group_id});
+      }
+
+      group_id++;
+    }
+
+    if (new_paths.empty()) {
+      DD_LOG(error) << "Failed to make paths for new topology!";
+    }
+    return new_paths;
+  }
+
+  DeviceIdSet getAllDeviceIdsAndMatchingDuplicates(const DisplayConfigData &active_config, const DeviceIdSet &device_ids, const DeviceInfoResolver &resolver) {
+    const std::span<const DisplayPath> paths {active_config.m_paths};
+
+    // Plain strings so that only the resulting ids are interned at the end
+    std::unordered_set<std::string> all_device_ids;
+    for (const auto &device_id : device_ids) {
+      if (device_id.empty()) {
+        DD_LOG(error) << "Device id is empty!";
+        return {};
+      }
+
+      const auto provided_path_index {getActivePathIndex(paths, device_id, resolver)};
+      if (!provided_path_index) {
+        DD_LOG(warning) << "Failed to find device for " << device_id << "!";
+        return {};
+      }
+
+      const auto *provided_path_source_mode {getSourceMode(paths[*provided_path_index], active_config.m_source_modes)};
+      if (!provided_path_source_mode) {
+        DD_LOG(error) << "Active device does not have a source mode: " << device_id << "!";
+        return {};
+      }
+
+      // We will now iterate over all the active paths (provided path included) and check if
+      // any of them are duplicated.
+      for (std::size_t index = 0; index < paths.size(); ++index) {
+        const auto device_info {getDeviceInfoForValidPath(paths, index, ValidatedPathType::Active, resolver)};
+        if (!device_info) {
+          continue;
+        }
+
+        if (all_device_ids.contains(device_info->m_device_id)) {
+          // Already checked
+          continue;
+        }
+
+        const auto *source_mode {getSourceMode(paths[index], active_config.m_source_modes)};
+        if (!source_mode) {
+          DD_LOG(error) << "Active device does not have a source mode: " << device_info->m_device_id << "!";
+          return {};
+        }
+
+        if (!areModesDuplicated(*provided_path_source_mode, *source_mode)) {
+          continue;
+        }
+
+        all_device_ids.insert(device_info->m_device_id);
+      }
+    }
+
+    DeviceIdSet interned_device_ids;
+    for (const auto &device_id : all_device_ids) {
+      interned_device_ids.insert(DeviceId {device_id});
+    }
+    return interned_device_ids;
+  }
+}  // namespace display_device::config_utils
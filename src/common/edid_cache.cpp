@@ -0,0 +1,77 @@
+/**
+ * @file src/common/edid_cache.cpp
+ * @brief Definitions for the EdidCache.
+ */
+// class header include
+#include "display_device/edid_cache.h"
+
+// system includes
+#include <cstring>
+#include <stdexcept>
+
+// local includes
+#include "display_device/detail/checksum.h"
+
+namespace display_device {
+  EdidCache::EdidCache(const std::size_t capacity):
+      m_capacity {capacity} {
+    if (m_capacity == 0) {
+      throw std::runtime_error {"Capacity provided in EdidCache must be larger than 0!"};
+    }
+  }
+
+  std::optional<EdidData> EdidCache::parse(const std::span<const std::byte> data) {
+    if (data.empty()) {
+      // Nothing to cache, the parse result is always empty
+      return std::nullopt;
+    }
+
+    // CRC-32C is hardware accelerated and much faster than FNV-1a for the typical 128-512 bytes,
+    // while the collisions are handled by comparing the raw data anyway
+    const std::uint64_t hash {(static_cast<std::uint64_t>(data.size()) << 32) | detail::crc32c({reinterpret_cast<const std::uint8_t *>(data.data()), data.size()})};
+
+    std::lock_guard lock {m_mutex};
+    if (const auto it {m_index.find(hash)}; it != std::end(m_index)) {
+      const auto entry {it->second};
+      // std::equal does not resolve to memcmp for std::byte, making it an order of magnitude slower
+      if (entry->m_data.size() == data.size() && std::memcmp(entry->m_data.data(), data.data(), data.size()) == 0) {
+        ++m_stats.m_hits;
+        m_entries.splice(std::begin(m_entries), m_entries, entry);
+        return entry->m_edid;
+      }
+
+      // Hash collision, the new data replaces the old one
+      m_entries.erase(entry);
+      m_index.erase(it);
+    }
+
+    ++m_stats.m_misses;
+    auto edid {EdidData::parse(data)};
+
+    if (m_entries.size() >= m_capacity) {
+      ++m_stats.m_evictions;
+      m_index.erase(m_entries.back().m_hash);
+      m_entries.pop_back();
+    }
+
+    m_entries.push_front({hash, {std::begin(data), std::end(data)}, edid});
+    m_index[hash] = std::begin(m_entries);
+    return edid;
+  }
+
+  EdidCache::Stats EdidCache::getStats() const {
+    std::lock_guard lock {m_mutex};
+    return m_stats;
+  }
+
+  std::size_t EdidCache::size() const {
+    std::lock_guard lock {m_mutex};
+    return m_entries.size();
+  }
+
+  void EdidCache::clear() {
+    std::lock_guard lock {m_mutex};
+    m_entries.clear();
+    m_index.clear();
+  }
+}  // namespace display_device
@@ -0,0 +1,724 @@
+/**
+ * @file src/common/edid_decoder.cpp
+ * @brief Definitions for the private EDID block decoder.
+ */
+// header include
+#include "display_device/detail/edid_decoder.h"
+
+// system includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string_view>
+#include <utility>
+
+// local includes
+#include "display_device/detail/checksum.h"
+#include "display_device/logging.h"
+
+namespace display_device::detail {
+  namespace {
+    /**
+     * @brief Size of the detailed timing and display descriptors.
+     */
+    constexpr std::size_t DESCRIPTOR_SIZE {18};
+
+    /**
+     * @brief Offset of the first descriptor in the base block.
+     */
+    constexpr std::size_t BASE_DESCRIPTORS_OFFSET {54};
+
+    /**
+     * @brief Offset of the extension block count in the base block.
+     */
+    constexpr std::size_t EXTENSION_COUNT_OFFSET {126};
+
+    /**
+     * @brief Size of the DisplayID type I and type VII timing descriptors.
+     */
+    constexpr std::size_t DISPLAYID_TIMING_SIZE {20};
+
+    /**
+     * @brief Offset of the established timings in the base block.
+     */
+    constexpr std::size_t ESTABLISHED_TIMINGS_OFFSET {35};
+
+    /**
+     * @brief Offset of the standard timings in the base block.
+     */
+    constexpr std::size_t STANDARD_TIMINGS_OFFSET {38};
+
+    /**
+     * @brief Offset of the EDID structure revision in the base block.
+     */
+    constexpr std::size_t REVISION_OFFSET {19};
+
+    /**
+     * @brief Tag of the block map extension block, which does not describe the display.
+     */
+    constexpr std::uint32_t BLOCK_MAP_TAG {0xF0};
+
+    /**
+     * @brief IEEE OUI of the HDMI Licensing (HDMI VSDB).
+     */
+    constexpr std::uint32_t HDMI_OUI {0x000C03};
+
+    /**
+     * @brief IEEE OUI of the HDMI Forum (HF-VSDB).
+     */
+    constexpr std::uint32_t HDMI_FORUM_OUI {0xC45DD8};
+
+    /**
+     * @brief Display mode defined by a specification, with the nominal refresh rate in Hz.
+     */
+    struct ModeDefinition {
+      unsigned int m_width;
+      unsigned int m_height;
+      unsigned int m_refresh_rate;
+      bool m_interlaced;
+    };
+
+    /**
+     * @brief Modes of the established timings, in the order of the bits starting from the most significant bit of the first byte.
+     */
+    constexpr std::array<ModeDefinition, 17> ESTABLISHED_TIMINGS {{
+      {720, 400, 70, false}, {720, 400, 88, false}, {640, 480, 60, false}, {640, 480, 67, false},
+      {640, 480, 72, false}, {640, 480, 75, false}, {800, 600, 56, false}, {800, 600, 60, false},
+      {800, 600, 72, false}, {800, 600, 75, false}, {832, 624, 75, false}, {1024, 768, 87, true},
+      {1024, 768, 60, false}, {1024, 768, 70, false}, {1024, 768, 75, false}, {1280, 1024, 75, false},
+      {1152, 870, 75, false},
+    }};
+
+    /**
+     * @brief Modes of the CTA-861 video identification codes (VICs), keyed by the VIC.
+     */
+    constexpr std::array<std::pair<std::uint32_t, ModeDefinition>, 154> CTA_VIDEO_MODES {{
+      {1, {640, 480, 60, false}}, {2, {720, 480, 60, false}}, {3, {720, 480, 60, false}}, {4, {1280, 720, 60, false}},
+      {5, {1920, 1080, 60, true}}, {6, {1440, 480, 60, true}}, {7, {1440, 480, 60, true}}, {8, {1440, 240, 60, false}},
+      {9, {1440, 240, 60, false}}, {10, {2880, 480, 60, true}}, {11, {2880, 480, 60, true}}, {12, {2880, 240, 60, false}},
+      {13, {2880, 240, 60, false}}, {14, {1440, 480, 60, false}}, {15, {1440, 480, 60, false}}, {16, {1920, 1080, 60, false}},
+      {17, {720, 576, 50, false}}, {18, {720, 576, 50, false}}, {19, {1280, 720, 50, false}}, {20, {1920, 1080, 50, true}},
+      {21, {1440, 576, 50, true}}, {22, {1440, 576, 50, true}}, {23, {1440, 288, 50, false}}, {24, {1440, 288, 50, false}},
+      {25, {2880, 576, 50, true}}, {26, {2880, 576, 50, true}}, {27, {2880, 288, 50, false}}, {28, {2880, 288, 50, false}},
+      {29, {1440, 576, 50, false}}, {30, {1440, 576, 50, false}}, {31, {1920, 1080, 50, false}}, {32, {1920, 1080, 24, false}},
+      {33, {1920, 1080, 25, false}}, {34, {1920, 1080, 30, false}}, {35, {2880, 480, 60, false}}, {36, {2880, 480, 60, false}},
+      {37, {2880, 576, 50, false}}, {38, {2880, 576, 50, false}}, {39, {1920, 1080, 50, true}}, {40, {1920, 1080, 100, true}},
+      {41, {1280, 720, 100, false}}, {42, {720, 576, 100, false}}, {43, {720, 576, 100, false}}, {44, {1440, 576, 100, true}},
+      {45, {1440, 576, 100, true}}, {46, {1920, 1080, 120, true}}, {47, {1280, 720, 120, false}}, {48, {720, 480, 120, false}},
+      {49, {720, 480, 120, false}}, {50, {1440, 480, 120, true}}, {51, {1440, 480, 120, true}}, {52, {720, 576, 200, false}},
+      {53, {720, 576, 200, false}}, {54, {1440, 576, 200, true}}, {55, {1440, 576, 200, true}}, {56, {720, 480, 240, false}},
+      {57, {720, 480, 240, false}}, {58, {1440, 480, 240, true}}, {59, {1440, 480, 240, true}}, {60, {1280, 720, 24, false}},
+      {61, {1280, 720, 25, false}}, {62, {1280, 720, 30, false}}, {63, {1920, 1080, 120, false}}, {64, {1920, 1080, 100, false}},
+      {65, {1280, 720, 24, false}}, {66, {1280, 720, 25, false}}, {67, {1280, 720, 30, false}}, {68, {1280, 720, 50, false}},
+      {69, {1280, 720, 60, false}}, {70, {1280, 720, 100, false}}, {71, {1280, 720, 120, false}}, {72, {1920, 1080, 24, false}},
+      {73, {1920, 1080, 25, false}}, {74, {1920, 1080, 30, false}}, {75, {1920, 1080, 50, false}}, {76, {1920, 1080, 60, false}},
+      {77, {1920, 1080, 100, false}}, {78, {1920, 1080, 120, false}}, {79, {1680, 720, 24, false}}, {80, {1680, 720, 25, false}},
+      {81, {1680, 720, 30, false}}, {82, {1680, 720, 50, false}}, {83, {1680, 720, 60, false}}, {84, {1680, 720, 100, false}},
+      {85, {1680, 720, 120, false}}, {86, {2560, 1080, 24, false}}, {87, {2560, 1080, 25, false}}, {88, {2560, 1080, 30, false}},
+      {89, {2560, 1080, 50, false}}, {90, {2560, 1080, 60, false}}, {91, {2560, 1080, 100, false}}, {92, {2560, 1080, 120, false}},
+      {93, {3840, 2160, 24, false}}, {94, {3840, 2160, 25, false}}, {95, {3840, 2160, 30, false}}, {96, {3840, 2160, 50, false}},
+      {97, {3840, 2160, 60, false}}, {98, {4096, 2160, 24, false}}, {99, {4096, 2160, 25, false}}, {100, {4096, 2160, 30, false}},
+      {101, {4096, 2160, 50, false}}, {102, {4096, 2160, 60, false}}, {103, {3840, 2160, 24, false}}, {104, {3840, 2160, 25, false}},
+      {105, {3840, 2160, 30, false}}, {106, {3840, 2160, 50, false}}, {107, {3840, 2160, 60, false}}, {108, {1280, 720, 48, false}},
+      {109, {1280, 720, 48, false}}, {110, {1680, 720, 48, false}}, {111, {1920, 1080, 48, false}}, {112, {1920, 1080, 48, false}},
+      {113, {2560, 1080, 48, false}}, {114, {3840, 2160, 48, false}}, {115, {4096, 2160, 48, false}}, {116, {3840, 2160, 48, false}},
+      {117, {3840, 2160, 100, false}}, {118, {3840, 2160, 120, false}}, {119, {3840, 2160, 100, false}}, {120, {3840, 2160, 120, false}},
+      {121, {5120, 2160, 24, false}}, {122, {5120, 2160, 25, false}}, {123, {5120, 2160, 30, false}}, {124, {5120, 2160, 48, false}},
+      {125, {5120, 2160, 50, false}}, {126, {5120, 2160, 60, false}}, {127, {5120, 2160, 100, false}}, {193, {5120, 2160, 120, false}},
+      {194, {7680, 4320, 24, false}}, {195, {7680, 4320, 25, false}}, {196, {7680, 4320, 30, false}}, {197, {7680, 4320, 48, false}},
+      {198, {7680, 4320, 50, false}}, {199, {7680, 4320, 60, false}}, {200, {7680, 4320, 100, false}}, {201, {7680, 4320, 120, false}},
+      {202, {7680, 4320, 24, false}}, {203, {7680, 4320, 25, false}}, {204, {7680, 4320, 30, false}}, {205, {7680, 4320, 48, false}},
+      {206, {7680, 4320, 50, false}}, {207, {7680, 4320, 60, false}}, {208, {7680, 4320, 100, false}}, {209, {7680, 4320, 120, false}},
+      {210, {10240, 4320, 24, false}}, {211, {10240, 4320, 25, false}}, {212, {10240, 4320, 30, false}}, {213, {10240, 4320, 48, false}},
+      {214, {10240, 4320, 50, false}}, {215, {10240, 4320, 60, false}}, {216, {10240, 4320, 100, false}}, {217, {10240, 4320, 120, false}},
+      {218, {4096, 2160, 100, false}}, {219, {4096, 2160, 120, false}},
+    }};
+
+    /**
+     * @brief State shared between the block decoders.
+     */
+    struct DecoderContext {
+      EdidData &m_edid; /**< Data being filled. */
+      std::optional<EdidData::Timing> m_displayid_preferred_timing {}; /**< Timing flagged as preferred by the DisplayID block. */
+      unsigned int m_revision {}; /**< EDID structure revision of the base block. */
+      bool m_modes_complete {true}; /**< Cleared once a source of the modes that is not decoded is found. */
+    };
+
+    /**
+     * @brief Decoder for a part of the EDID data.
+     */
+    using Decoder = void (*)(std::span<const std::byte> data, DecoderContext &context);
+
+    /**
+     * @brief Get the byte value at the specified offset.
+     */
+    std::uint32_t byteAt(const std::span<const std::byte> data, const std::size_t offset) {
+      return std::to_integer<std::uint32_t>(data[offset]);
+    }
+
+    /**
+     * @brief Read a little-endian value of the specified byte count.
+     */
+    std::uint32_t readValue(const std::span<const std::byte> data, const std::size_t offset, const std::size_t count) {
+      std::uint32_t value {0};
+      for (std::size_t i = 0; i < count; ++i) {
+        value |= byteAt(data, offset + i) << (8 * i);
+      }
+      return value;
+    }
+
+    /**
+     * @brief Find the decoder for the key in a decoder table.
+     * @return Decoder or nullptr if the key is not supported.
+     */
+    template<std::size_t N>
+    Decoder findDecoder(const std::array<std::pair<std::uint32_t, Decoder>, N> &table, const std::uint32_t key) {
+      const auto it {std::ranges::find(table, key, &std::pair<std::uint32_t, Decoder>::first)};
+      return it != std::end(table) ? it->second : nullptr;
+    }
+
+    /**
+     * @brief Get the text from the display descriptor up to the terminating line feed.
+     */
+    std::string_view getDescriptorText(const std::span<const std::byte> descriptor) {
+      const auto text_data {descriptor.subspan(5)};
+      const std::string_view text {reinterpret_cast<const char *>(text_data.data()), text_data.size()};
+      return text.substr(0, text.find('\n'));
+    }
+
+    /**
+     * @brief Make the timing from the raw timing values.
+     */
+    EdidData::Timing makeTiming(const std::uint32_t pixel_clock_khz, const unsigned int h_active, const unsigned int h_blank, const unsigned int v_active, const unsigned int v_blank, const bool interlaced, const bool v_active_per_field) {
+      const std::uint64_t total_pixels {static_cast<std::uint64_t>(h_active + h_blank) * (v_active + v_blank)};
+      const std::uint64_t refresh_rate_mhz {total_pixels > 0 ? (static_cast<std::uint64_t>(pixel_clock_khz) * 1000000 + total_pixels / 2) / total_pixels : 0};
+
+      return {
+        .m_resolution = {h_active, interlaced && v_active_per_field ? v_active * 2 : v_active},
+        .m_refresh_rate = {static_cast<unsigned int>(refresh_rate_mhz), 1000},
+        .m_pixel_clock_khz = pixel_clock_khz,
+        .m_interlaced = interlaced
+      };
+    }
+
+    /**
+     * @brief Add the timing to the list if it's not there yet.
+     */
+    void addTiming(DecoderContext &context, const EdidData::Timing &timing) {
+      if (timing.m_resolution.m_width == 0 || timing.m_resolution.m_height == 0) {
+        return;
+      }
+
+      auto &timings {context.m_edid.m_detailed_timings};
+      if (std::ranges::find(timings, timing) == std::end(timings)) {
+        timings.push_back(timing);
+      }
+    }
+
+    /**
+     * @brief Add the progressive mode with the nominal refresh rate to the list if it's not there yet.
+     * @param context Decoder context to add the mode to.
+     * @param mode Mode to be added.
+     * @param cta_mode Whether the mode comes from a CTA-861 VIC. Only these support the 1000/1001 factor
+     *                 for the rates that are a multiple of 6 Hz (e.g. 59.94 Hz for 60 Hz).
+     */
+    void addVideoMode(DecoderContext &context, const ModeDefinition &mode, const bool cta_mode) {
+      if (mode.m_interlaced || mode.m_width == 0 || mode.m_height == 0) {
+        return;
+      }
+
+      auto &modes {context.m_edid.m_video_modes};
+      const auto add_mode {[&modes, &mode](const Rational &refresh_rate) {
+        const EdidData::VideoMode video_mode {{mode.m_width, mode.m_height}, refresh_rate};
+        if (std::ranges::find(modes, video_mode) == std::end(modes)) {
+          modes.push_back(video_mode);
+        }
+      }};
+
+      add_mode({mode.m_refresh_rate, 1});
+      if (cta_mode && mode.m_refresh_rate % 6 == 0) {
+        add_mode({mode.m_refresh_rate * 1000, 1001});
+      }
+    }
+
+    /**
+     * @brief Decode the 2-byte standard timing.
+     */
+    void decodeStandardTiming(const std::span<const std::byte> timing, DecoderContext &context) {
+      const auto first {byteAt(timing, 0)};
+      const auto second {byteAt(timing, 1)};
+      if (first == 0x00 || (first == 0x01 && second == 0x01)) {
+        // Unused
+        return;
+      }
+
+      const auto width {(first + 31) * 8};
+      unsigned int height {0};
+      switch (second >> 6) {
+        case 0:
+          // The 16:10 aspect ratio was 1:1 before the EDID 1.3
+          height = context.m_revision < 3 ? width : width * 10 / 16;
+          break;
+        case 1:
+          height = width * 3 / 4;
+          break;
+        case 2:
+          height = width * 4 / 5;
+          break;
+        default:
+          height = width * 9 / 16;
+          break;
+      }
+
+      addVideoMode(context, {width, height, (second & 0x3F) + 60, false}, false);
+    }
+
+    /**
+     * @brief Decode the CTA-861 short video descriptors.
+     */
+    void decodeShortVideoDescriptors(const std::span<const std::byte> descriptors, DecoderContext &context) {
+      for (std::size_t i = 0; i < descriptors.size(); ++i) {
+        // Values 129-192 are the VICs 1-64 with the native flag set
+        const auto value {byteAt(descriptors, i)};
+        const auto vic {value >= 129 && value <= 192 ? value & 0x7F : value};
+
+        const auto it {std::ranges::find(CTA_VIDEO_MODES, vic, &std::pair<std::uint32_t, ModeDefinition>::first)};
+        if (it == std::end(CTA_VIDEO_MODES)) {
+          DD_LOG(debug) << "EDID CTA-861 short video descriptor " << value << " is not supported.";
+          context.m_modes_complete = false;
+          continue;
+        }
+
+        addVideoMode(context, it->second, true);
+      }
+    }
+
+    /**
+     * @brief Mark the modes as incomplete for the blocks that advertise the modes in a way that is not decoded.
+     */
+    void markModesIncomplete(const std::span<const std::byte>, DecoderContext &context) {
+      context.m_modes_complete = false;
+    }
+
+    /**
+     * @brief Decode the 18-byte detailed timing descriptor.
+     */
+    EdidData::Timing decodeDetailedTiming(const std::span<const std::byte> descriptor) {
+      const auto pixel_clock_khz {readValue(descriptor, 0, 2) * 10};
+      const auto h_active {byteAt(descriptor, 2) | ((byteAt(descriptor, 4) & 0xF0) << 4)};
+      const auto h_blank {byteAt(descriptor, 3) | ((byteAt(descriptor, 4) & 0x0F) << 8)};
+      const auto v_active {byteAt(descriptor, 5) | ((byteAt(descriptor, 7) & 0xF0) << 4)};
+      const auto v_blank {byteAt(descriptor, 6) | ((byteAt(descriptor, 7) & 0x0F) << 8)};
+      const bool interlaced {(byteAt(descriptor, 17) & 0x80) != 0};
+
+      return makeTiming(pixel_clock_khz, h_active, h_blank, v_active, v_blank, interlaced, true);
+    }
+
+    /**
+     * @brief Decode the monitor name (0xFC) display descriptor.
+     */
+    void decodeMonitorName(const std::span<const std::byte> descriptor, DecoderContext &context) {
+      // Long names are split across multiple descriptors
+      context.m_edid.m_monitor_name += getDescriptorText(descriptor);
+    }
+
+    /**
+     * @brief Decode the display range limits (0xFD) display descriptor.
+     */
+    void decodeRangeLimits(const std::span<const std::byte> descriptor, DecoderContext &context) {
+      const auto offsets {byteAt(descriptor, 4) & 0x03};
+      const auto min_rate {byteAt(descriptor, 5) + (offsets == 0x03 ? 255 : 0)};
+      const auto max_rate {byteAt(descriptor, 6) + ((offsets & 0x02) != 0 ? 255 : 0)};
+
+      if (min_rate > 0 && min_rate <= max_rate) {
+        context.m_edid.m_refresh_rate_range = EdidData::RefreshRateRange {min_rate, max_rate};
+      }
+    }
+
+    /**
+     * @brief Decode the standard timing identifiers (0xFA) display descriptor.
+     */
+    void decodeStandardTimingsDescriptor(const std::span<const std::byte> descriptor, DecoderContext &context) {
+      for (std::size_t offset = 5; offset + 2 <= 17; offset += 2) {
+        decodeStandardTiming(descriptor.subspan(offset, 2), context);
+      }
+    }
+
+    /**
+     * @brief Decoders for the display descriptors, keyed by the descriptor tag.
+     * @note The established timings III (0xF7) and the CVT 3-byte codes (0xF8) are not decoded.
+     */
+    constexpr std::array<std::pair<std::uint32_t, Decoder>, 5> DISPLAY_DESCRIPTOR_DECODERS {{
+      {0xF7, &markModesIncomplete},
+      {0xF8, &markModesIncomplete},
+      {0xFA, &decodeStandardTimingsDescriptor},
+      {0xFC, &decodeMonitorName},
+      {0xFD, &decodeRangeLimits},
+    }};
+
+    /**
+     * @brief Decode the 18-byte descriptor which is either a detailed timing or a display descriptor.
+     * @return True if the descriptor was a detailed timing, false otherwise.
+     */
+    bool decodeDescriptor(const std::span<const std::byte> descriptor, DecoderContext &context) {
+      if (readValue(descriptor, 0, 2) != 0) {
+        addTiming(context, decodeDetailedTiming(descriptor));
+        return true;
+      }
+
+      if (const auto decoder {findDecoder(DISPLAY_DESCRIPTOR_DECODERS, byteAt(descriptor, 3))}) {
+        decoder(descriptor, context);
+      }
+      return false;
+    }
+
+    /**
+     * @brief Decode the HDR static metadata (extended tag 0x06) CTA-861 data block.
+     */
+    void decodeHdrStaticMetadata(const std::span<const std::byte> payload, DecoderContext &context) {
+      if (payload.size() < 3) {
+        DD_LOG(warning) << "EDID HDR static metadata block is too small: " << payload.size();
+        return;
+      }
+
+      const auto eotfs {byteAt(payload, 1)};
+      EdidData::HdrStaticMetadata metadata {
+        .m_traditional_sdr = (eotfs & 0x01) != 0,
+        .m_traditional_hdr = (eotfs & 0x02) != 0,
+        .m_smpte_st2084 = (eotfs & 0x04) != 0,
+        .m_hlg = (eotfs & 0x08) != 0
+      };
+
+      // Luminance values are encoded as defined in CTA-861.3
+      if (payload.size() > 3) {
+        metadata.m_max_luminance = 50. * std::pow(2., byteAt(payload, 3) / 32.);
+      }
+      if (payload.size() > 4) {
+        metadata.m_max_frame_average_luminance = 50. * std::pow(2., byteAt(payload, 4) / 32.);
+      }
+      if (payload.size() > 5 && metadata.m_max_luminance) {
+        const double min_value {byteAt(payload, 5) / 255.};
+        metadata.m_min_luminance = *metadata.m_max_luminance * min_value * min_value / 100.;
+      }
+
+      context.m_edid.m_hdr_static_metadata = metadata;
+    }
+
+    /**
+     * @brief Decode the YCbCr 4:2:0 video (extended tag 0x0E) CTA-861 data block.
+     */
+    void decodeYcbcr420VideoBlock(const std::span<const std::byte> payload, DecoderContext &context) {
+      decodeShortVideoDescriptors(payload.subspan(1), context);
+    }
+
+    /**
+     * @brief Decoders for the CTA-861 extended data blocks, keyed by the extended tag.
+     * @note The DisplayID type VII, VIII and X timings embedded in the CTA-861 block are not decoded.
+     */
+    constexpr std::array<std::pair<std::uint32_t, Decoder>, 5> CTA_EXTENDED_DATA_BLOCK_DECODERS {{
+      {0x06, &decodeHdrStaticMetadata},
+      {0x0E, &decodeYcbcr420VideoBlock},
+      {0x22, &markModesIncomplete},
+      {0x23, &markModesIncomplete},
+      {0x2A, &markModesIncomplete},
+    }};
+
+    /**
+     * @brief Decode the HDMI Licensing vendor-specific CTA-861 data block.
+     */
+    void decodeHdmiBlock(const std::span<const std::byte> payload, DecoderContext &context) {
+      // The HDMI VICs (e.g. 4K at 30 Hz) are not decoded
+      if (payload.size() > 7 && (byteAt(payload, 7) & 0x20) != 0) {
+        context.m_modes_complete = false;
+      }
+    }
+
+    /**
+     * @brief Decode the HDMI Forum vendor-specific CTA-861 data block.
+     */
+    void decodeHdmiForumBlock(const std::span<const std::byte> payload, DecoderContext &context) {
+      // VRR range was only added in HDMI 2.1, older blocks are shorter
+      if (payload.size() < 10) {
+        return;
+      }
+
+      const auto vrr_min {byteAt(payload, 8) & 0x3F};
+      const auto vrr_max {((byteAt(payload, 8) & 0xC0) << 2) | byteAt(payload, 9)};
+      if (vrr_min > 0 && vrr_min < vrr_max) {
+        context.m_edid.m_vrr_range = EdidData::RefreshRateRange {vrr_min, vrr_max};
+      }
+    }
+
+    /**
+     * @brief Decoders for the CTA-861 vendor-specific data blocks, keyed by the IEEE OUI.
+     */
+    constexpr std::array<std::pair<std::uint32_t, Decoder>, 2> CTA_VENDOR_DATA_BLOCK_DECODERS {{
+      {HDMI_OUI, &decodeHdmiBlock},
+      {HDMI_FORUM_OUI, &decodeHdmiForumBlock},
+    }};
+
+    /**
+     * @brief Decode the vendor-specific (tag 3) CTA-861 data block.
+     */
+    void decodeCtaVendorBlock(const std::span<const std::byte> payload, DecoderContext &context) {
+      if (payload.size() < 3) {
+        return;
+      }
+
+      if (const auto decoder {findDecoder(CTA_VENDOR_DATA_BLOCK_DECODERS, readValue(payload, 0, 3))}) {
+        decoder(payload, context);
+      }
+    }
+
+    /**
+     * @brief Decode the extended (tag 7) CTA-861 data block.
+     */
+    void decodeCtaExtendedBlock(const std::span<const std::byte> payload, DecoderContext &context) {
+      if (payload.empty()) {
+        return;
+      }
+
+      if (const auto decoder {findDecoder(CTA_EXTENDED_DATA_BLOCK_DECODERS, byteAt(payload, 0))}) {
+        decoder(payload, context);
+      }
+    }
+
+    /**
+     * @brief Decoders for the CTA-861 data blocks, keyed by the data block tag.
+     */
+    constexpr std::array<std::pair<std::uint32_t, Decoder>, 3> CTA_DATA_BLOCK_DECODERS {{
+      {2, &decodeShortVideoDescriptors},
+      {3, &decodeCtaVendorBlock},
+      {7, &decodeCtaExtendedBlock},
+    }};
+
+    /**
+     * @brief Decode the CTA-861 (tag 0x02) extension block.
+     */
+    void decodeCtaBlock(const std::span<const std::byte> block, DecoderContext &context) {
+      const std::size_t dtd_offset {byteAt(block, 2)};
+      if (dtd_offset == 0) {
+        // Neither the data blocks, nor the detailed timings are provided
+        return;
+      }
+
+      if (dtd_offset < 4 || dtd_offset >= EDID_BLOCK_SIZE) {
+        DD_LOG(warning) << "EDID CTA-861 block has invalid detailed timing offset: " << dtd_offset;
+        return;
+      }
+
+      for (std::size_t offset = 4; offset < dtd_offset;) {
+        const auto header {byteAt(block, offset)};
+        const std::size_t length {header & 0x1F};
+        if (offset + 1 + length > dtd_offset) {
+          DD_LOG(warning) << "EDID CTA-861 data block exceeds the data block collection.";
+          break;
+        }
+
+        if (const auto decoder {findDecoder(CTA_DATA_BLOCK_DECODERS, header >> 5)}) {
+          decoder(block.subspan(offset + 1, length), context);
+        }
+        offset += 1 + length;
+      }
+
+      // The last byte is reserved for the checksum
+      for (std::size_t offset = dtd_offset; offset + DESCRIPTOR_SIZE < EDID_BLOCK_SIZE; offset += DESCRIPTOR_SIZE) {
+        const auto descriptor {block.subspan(offset, DESCRIPTOR_SIZE)};
+        if (readValue(descriptor, 0, 2) == 0) {
+          break;
+        }
+
+        addTiming(context, decodeDetailedTiming(descriptor));
+      }
+    }
+
+    /**
+     * @brief Decode the DisplayID timing descriptors that share the type I layout.
+     * @param pixel_clock_unit_khz Unit of the pixel clock value.
+     */
+    void decodeDisplayIdTimings(const std::span<const std::byte> payload, DecoderContext &context, const std::uint32_t pixel_clock_unit_khz) {
+      for (std::size_t offset = 0; offset + DISPLAYID_TIMING_SIZE <= payload.size(); offset += DISPLAYID_TIMING_SIZE) {
+        const auto descriptor {payload.subspan(offset, DISPLAYID_TIMING_SIZE)};
+        const auto flags {byteAt(descriptor, 3)};
+
+        // All of the values are stored with an offset of -1
+        const auto timing {makeTiming(
+          (readValue(descriptor, 0, 3) + 1) * pixel_clock_unit_khz,
+          readValue(descriptor, 4, 2) + 1,
+          readValue(descriptor, 6, 2) + 1,
+          readValue(descriptor, 12, 2) + 1,
+          readValue(descriptor, 14, 2) + 1,
+          (flags & 0x10) != 0,
+          false
+        )};
+
+        addTiming(context, timing);
+        if ((flags & 0x80) != 0 && !context.m_displayid_preferred_timing) {
+          context.m_displayid_preferred_timing = timing;
+        }
+      }
+    }
+
+    /**
+     * @brief Decode the DisplayID type I detailed timing (tag 0x03) data block.
+     */
+    void decodeDisplayIdTypeITimings(const std::span<const std::byte> payload, DecoderContext &context) {
+      decodeDisplayIdTimings(payload, context, 10);
+    }
+
+    /**
+     * @brief Decode the DisplayID 2.0 type VII detailed timing (tag 0x22) data block.
+     */
+    void decodeDisplayIdTypeVIITimings(const std::span<const std::byte> payload, DecoderContext &context) {
+      decodeDisplayIdTimings(payload, context, 1);
+    }
+
+    /**
+     * @brief Decode the DisplayID product identification (tag 0x00 or 0x20) data block.
+     */
+    void decodeDisplayIdProductId(const std::span<const std::byte> payload, DecoderContext &context) {
+      if (payload.size() < 12 || !context.m_edid.m_monitor_name.empty()) {
+        return;
+      }
+
+      const std::size_t name_length {std::min<std::size_t>(byteAt(payload, 11), payload.size() - 12)};
+      const auto name_data {payload.subspan(12, name_length)};
+      context.m_edid.m_monitor_name = std::string_view {reinterpret_cast<const char *>(name_data.data()), name_data.size()};
+    }
+
+    /**
+     * @brief Decoders for the DisplayID data blocks, keyed by the data block tag.
+     * @note Only the type I and type VII timings are decoded, the other timing blocks just mark the modes as incomplete.
+     */
+    constexpr std::array<std::pair<std::uint32_t, Decoder>, 14> DISPLAYID_DATA_BLOCK_DECODERS {{
+      {0x00, &decodeDisplayIdProductId},
+      {0x03, &decodeDisplayIdTypeITimings},
+      {0x04, &markModesIncomplete},
+      {0x05, &markModesIncomplete},
+      {0x06, &markModesIncomplete},
+      {0x07, &markModesIncomplete},
+      {0x08, &markModesIncomplete},
+      {0x09, &markModesIncomplete},
+      {0x13, &markModesIncomplete},
+      {0x20, &decodeDisplayIdProductId},
+      {0x22, &decodeDisplayIdTypeVIITimings},
+      {0x23, &markModesIncomplete},
+      {0x24, &markModesIncomplete},
+      {0x25, &markModesIncomplete},
+    }};
+
+    /**
+     * @brief Decode the DisplayID (tag 0x70) extension block.
+     */
+    void decodeDisplayIdBlock(const std::span<const std::byte> block, DecoderContext &context) {
+      // The section is followed by its own checksum and the EDID block checksum
+      const std::size_t section_end {5 + byteAt(block, 2)};
+      if (section_end + 2 > EDID_BLOCK_SIZE) {
+        DD_LOG(warning) << "EDID DisplayID section exceeds the extension block.";
+        return;
+      }
+
+      for (std::size_t offset = 5; offset + 3 <= section_end;) {
+        const auto tag {byteAt(block, offset)};
+        const std::size_t length {byteAt(block, offset + 2)};
+        if (tag == 0 && length == 0) {
+          // Rest of the section is padding
+          break;
+        }
+
+        if (offset + 3 + length > section_end) {
+          DD_LOG(warning) << "EDID DisplayID data block exceeds the section.";
+          break;
+        }
+
+        if (const auto decoder {findDecoder(DISPLAYID_DATA_BLOCK_DECODERS, tag)}) {
+          decoder(block.subspan(offset + 3, length), context);
+        }
+        offset += 3 + length;
+      }
+    }
+
+    /**
+     * @brief Decoders for the extension blocks, keyed by the extension tag.
+     */
+    constexpr std::array<std::pair<std::uint32_t, Decoder>, 2> EXTENSION_BLOCK_DECODERS {{
+      {0x02, &decodeCtaBlock},
+      {0x70, &decodeDisplayIdBlock},
+    }};
+  }  // namespace
+
+  bool isEdidBlockChecksumValid(const std::span<const std::byte> block) {
+    return sumBytes({reinterpret_cast<const std::uint8_t *>(block.data()), block.size()}) % 256 == 0;
+  }
+
+  void decodeEdidBlocks(const std::span<const std::byte> data, EdidData &edid) {
+    DecoderContext context {edid};
+    context.m_revision = byteAt(data, REVISION_OFFSET);
+
+    // ---- Established timings (the rest of the last byte is manufacturer specific)
+    const auto established_timings {readValue(data, ESTABLISHED_TIMINGS_OFFSET, 3)};
+    for (std::size_t i = 0; i < ESTABLISHED_TIMINGS.size(); ++i) {
+      // Bytes are read as little-endian, but the bits are ordered from the most significant one of each byte
+      if ((established_timings & (1u << (8 * (i / 8) + 7 - i % 8))) != 0) {
+        addVideoMode(context, ESTABLISHED_TIMINGS[i], false);
+      }
+    }
+    if ((byteAt(data, ESTABLISHED_TIMINGS_OFFSET + 2) & 0x7F) != 0) {
+      context.m_modes_complete = false;
+    }
+
+    // ---- Standard timings
+    for (std::size_t i = 0; i < 8; ++i) {
+      decodeStandardTiming(data.subspan(STANDARD_TIMINGS_OFFSET + i * 2, 2), context);
+    }
+
+    // ---- Base block descriptors (first detailed timing is the preferred one)
+    bool base_has_timing {false};
+    for (std::size_t i = 0; i < 4; ++i) {
+      const auto descriptor {data.subspan(BASE_DESCRIPTORS_OFFSET + i * DESCRIPTOR_SIZE, DESCRIPTOR_SIZE)};
+      if (decodeDescriptor(descriptor, context) && !base_has_timing) {
+        base_has_timing = true;
+        edid.m_preferred_timing = decodeDetailedTiming(descriptor);
+      }
+    }
+
+    // ---- Extension blocks
+    const std::size_t declared_blocks {byteAt(data, EXTENSION_COUNT_OFFSET)};
+    const std::size_t available_blocks {data.size() / EDID_BLOCK_SIZE - 1};
+    if (declared_blocks > available_blocks) {
+      DD_LOG(debug) << "EDID declares " << declared_blocks << " extension block(s), but only " << available_blocks << " are available.";
+      context.m_modes_complete = false;
+    }
+
+    for (std::size_t i = 1; i <= std::min(declared_blocks, available_blocks); ++i) {
+      const auto block {data.subspan(i * EDID_BLOCK_SIZE, EDID_BLOCK_SIZE)};
+      if (!isEdidBlockChecksumValid(block)) {
+        DD_LOG(warning) << "EDID extension block " << i << " checksum verification failed.";
+        context.m_modes_complete = false;
+        continue;
+      }
+
+      if (const auto decoder {findDecoder(EXTENSION_BLOCK_DECODERS, byteAt(block, 0))}) {
+        decoder(block, context);
+      } else if (byteAt(block, 0) != BLOCK_MAP_TAG) {
+        context.m_modes_complete = false;
+      }
+    }
+
+    // The name is ASCII by the spec, anything else (e.g. NUL padding) would also break the JSON serialization
+    std::erase_if(edid.m_monitor_name, [](const char ch) {
+      return ch < 0x20 || ch > 0x7E;
+    });
+
+    // Some displays pad the name with spaces without the terminating line feed
+    edid.m_monitor_name.erase(edid.m_monitor_name.find_last_not_of(' ') + 1);
+
+    edid.m_modes_complete = context.m_modes_complete;
+    if (!edid.m_preferred_timing) {
+      edid.m_preferred_timing = context.m_displayid_preferred_timing;
+    }
+    if (!edid.m_preferred_timing && !edid.m_detailed_timings.empty()) {
+      edid.m_preferred_timing = edid.m_detailed_timings.front();
+    }
+  }
+}  // namespace display_device::detail
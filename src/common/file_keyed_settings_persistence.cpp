@@ -0,0 +1,337 @@
+/**
+ * @file src/common/file_keyed_settings_persistence.cpp
+ * @brief Definitions for the FileKeyedSettingsPersistence.
+ */
+// class header include
+#include "display_device/file_keyed_settings_persistence.h"
+
+// system includes
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+// local includes
+#include "display_device/detail/checksum.h"
+#include "display_device/detail/file_utils.h"
+#include "display_device/detail/little_endian.h"
+#include "display_device/logging.h"
+
+namespace display_device {
+  namespace {
+    /**
+     * @brief Size of the record header: [4 bytes type][4 bytes key size][4 bytes data size][4 bytes CRC-32C], all little-endian.
+     * @note The checksum covers the rest of the header, the key and the data.
+     */
+    constexpr std::size_t RECORD_HEADER_SIZE {16};
+
+    /**
+     * @brief Offset of the checksum in the record header.
+     */
+    constexpr std::size_t RECORD_CHECKSUM_OFFSET {12};
+
+    /**
+     * @brief Type of the record.
+     */
+    enum class RecordType : std::uint32_t {
+      Store = 1,  ///< Record contains the data for the key.
+      Remove = 2  ///< Record marks the key as removed.
+    };
+
+    /**
+     * @brief Parsed record.
+     */
+    struct Record {
+      RecordType m_type {}; /**< Type of the record. */
+      std::string_view m_key {}; /**< Key of the record. */
+      std::span<const std::uint8_t> m_data {}; /**< Data of the record. */
+      std::size_t m_size {}; /**< Size of the whole record. */
+    };
+
+    /**
+     * @brief Encode the record.
+     */
+    std::vector<std::uint8_t> makeRecord(const RecordType type, const std::string &key, const std::span<const std::uint8_t> data) {
+      std::vector<std::uint8_t> record;
+      record.reserve(RECORD_HEADER_SIZE + key.size() + data.size());
+      detail::appendLittleEndian(record, static_cast<std::uint32_t>(type));
+      detail::appendLittleEndian(record, static_cast<std::uint32_t>(key.size()));
+      detail::appendLittleEndian(record, static_cast<std::uint32_t>(data.size()));
+      record.insert(std::end(record), std::begin(key), std::end(key));
+      record.insert(std::end(record), std::begin(data), std::end(data));
+
+      std::vector<std::uint8_t> checksum;
+      detail::appendLittleEndian(checksum, detail::crc32c(std::span<const std::uint8_t> {record}.subspan(RECORD_CHECKSUM_OFFSET), detail::crc32c(std::span<const std::uint8_t> {record}.first(RECORD_CHECKSUM_OFFSET))));
+      record.insert(std::begin(record) + RECORD_CHECKSUM_OFFSET, std::begin(checksum), std::end(checksum));
+      return record;
+    }
+
+    /**
+     * @brief Parse the record from the beginning of the data.
+     * @return Parsed record if it is complete and valid, null optional otherwise.
+     */
+    std::optional<Record> parseRecord(const std::span<const std::uint8_t> data) {
+      if (data.size() < RECORD_HEADER_SIZE) {
+        return std::nullopt;
+      }
+
+      const auto type {detail::readLittleEndian<std::uint32_t>(data)};
+      if (type != static_cast<std::uint32_t>(RecordType::Store) && type != static_cast<std::uint32_t>(RecordType::Remove)) {
+        return std::nullopt;
+      }
+
+      const std::size_t key_size {detail::readLittleEndian<std::uint32_t>(data.subspan(4))};
+      const std::size_t data_size {detail::readLittleEndian<std::uint32_t>(data.subspan(8))};
+      if (data.size() - RECORD_HEADER_SIZE < key_size || data.size() - RECORD_HEADER_SIZE - key_size < data_size) {
+        return std::nullopt;
+      }
+
+      const auto body {data.subspan(RECORD_HEADER_SIZE, key_size + data_size)};
+      if (detail::readLittleEndian<std::uint32_t>(data.subspan(RECORD_CHECKSUM_OFFSET)) != detail::crc32c(body, detail::crc32c(data.first(RECORD_CHECKSUM_OFFSET)))) {
+        return std::nullopt;
+      }
+
+      return Record {
+        static_cast<RecordType>(type),
+        {reinterpret_cast<const char *>(body.data()), key_size},
+        body.subspan(key_size),
+        RECORD_HEADER_SIZE + key_size + data_size
+      };
+    }
+  }  // namespace
+
+  FileKeyedSettingsPersistence::FileKeyedSettingsPersistence(std::filesystem::path filepath):
+      m_filepath {std::move(filepath)} {
+    if (m_filepath.empty()) {
+      throw std::runtime_error {"Empty filename provided for FileKeyedSettingsPersistence!"};
+    }
+
+    detail::removeStaleTemporaryFiles(m_filepath);
+  }
+
+  bool FileKeyedSettingsPersistence::store(const std::string &key, const std::vector<std::uint8_t> &data) {
+    if (!ensureIndex()) {
+      // Error already logged
+      return false;
+    }
+
+    const auto offset {m_index->m_file_size};
+    const auto record {makeRecord(RecordType::Store, key, data)};
+    if (!append(record)) {
+      // Error already logged
+      return false;
+    }
+
+    if (const auto it {m_index->m_entries.find(key)}; it != std::end(m_index->m_entries)) {
+      m_index->m_garbage_size += it->second.m_size;
+      it->second = {offset, record.size()};
+    } else {
+      m_index->m_entries.emplace(key, IndexEntry {offset, record.size()});
+    }
+
+    compactIfNeeded();
+    return true;
+  }
+
+  std::optional<std::vector<std::uint8_t>> FileKeyedSettingsPersistence::load(const std::string &key) const {
+    if (!ensureIndex()) {
+      // Error already logged
+      return std::nullopt;
+    }
+
+    const auto it {m_index->m_entries.find(key)};
+    if (it == std::end(m_index->m_entries)) {
+      return std::vector<std::uint8_t> {};
+    }
+
+    std::vector<std::uint8_t> record(it->second.m_size);
+    {
+      std::ifstream stream {m_filepath, std::ios::binary};
+      stream.seekg(static_cast<std::streamoff>(it->second.m_offset));
+      stream.read(reinterpret_cast<char *>(record.data()), static_cast<std::streamsize>(record.size()));
+      if (!stream) {
+        DD_LOG(error) << "Failed to read the record for \"" << key << "\" from " << m_filepath << "!";
+        m_index = std::nullopt;
+        return std::nullopt;
+      }
+    }
+
+    const auto parsed_record {parseRecord(record)};
+    if (!parsed_record || parsed_record->m_type != RecordType::Store || parsed_record->m_key != key) {
+      DD_LOG(error) << "Record for \"" << key << "\" in " << m_filepath << " is corrupted or was modified externally!";
+      m_index = std::nullopt;
+      return std::nullopt;
+    }
+
+    return std::vector<std::uint8_t> {std::begin(parsed_record->m_data), std::end(parsed_record->m_data)};
+  }
+
+  bool FileKeyedSettingsPersistence::remove(const std::string &key) {
+    if (!ensureIndex()) {
+      // Error already logged
+      return false;
+    }
+
+    const auto it {m_index->m_entries.find(key)};
+    if (it == std::end(m_index->m_entries)) {
+      return true;
+    }
+
+    const auto record {makeRecord(RecordType::Remove, key, {})};
+    if (!append(record)) {
+      // Error already logged
+      return false;
+    }
+
+    m_index->m_garbage_size += it->second.m_size + record.size();
+    m_index->m_entries.erase(it);
+
+    compactIfNeeded();
+    return true;
+  }
+
+  std::optional<std::vector<std::string>> FileKeyedSettingsPersistence::getKeys() const {
+    if (!ensureIndex()) {
+      // Error already logged
+      return std::nullopt;
+    }
+
+    std::vector<std::string> keys;
+    keys.reserve(m_index->m_entries.size());
+    for (const auto &[key, entry] : m_index->m_entries) {
+      keys.push_back(key);
+    }
+
+    std::ranges::sort(keys);
+    return keys;
+  }
+
+  bool FileKeyedSettingsPersistence::clear() {
+    // Return value does not matter since we check the error code in case the file could NOT be removed.
+    std::error_code error_code;
+    std::filesystem::remove(m_filepath, error_code);
+
+    if (error_code) {
+      DD_LOG(error) << "Failed to remove " << m_filepath << "! Error:\n"
+                    << "[" << error_code.value() << "] " << error_code.message();
+      m_index = std::nullopt;
+      return false;
+    }
+
+    m_index = Index {};
+    return true;
+  }
+
+  bool FileKeyedSettingsPersistence::compact() {
+    if (!ensureIndex()) {
+      // Error already logged
+      return false;
+    }
+
+    detail::FileView file_view;
+    if (const auto error_code {file_view.open(m_filepath)}; error_code && error_code != std::errc::no_such_file_or_directory) {
+      DD_LOG(error) << "Failed to load " << m_filepath << "! Error:\n"
+                    << "[" << error_code.value() << "] " << error_code.message();
+      return false;
+    }
+
+    if (file_view.data().size() < m_index->m_file_size) {
+      DD_LOG(error) << "File " << m_filepath << " was modified externally!";
+      m_index = std::nullopt;
+      return false;
+    }
+
+    Index compacted_index {};
+    std::vector<std::uint8_t> contents;
+    contents.reserve(m_index->m_file_size - m_index->m_garbage_size);
+    for (const auto &[key, entry] : m_index->m_entries) {
+      const auto record {file_view.data().subspan(entry.m_offset, entry.m_size)};
+      compacted_index.m_entries.emplace(key, IndexEntry {contents.size(), entry.m_size});
+      contents.insert(std::end(contents), std::begin(record), std::end(record));
+    }
+    compacted_index.m_file_size = contents.size();
+
+    if (const auto error_code {detail::writeFileAtomically(m_filepath, contents)}) {
+      DD_LOG(error) << "Failed to compact " << m_filepath << "! Error:\n"
+                    << "[" << error_code.value() << "] " << error_code.message();
+      m_index = std::nullopt;
+      return false;
+    }
+
+    m_index = std::move(compacted_index);
+    return true;
+  }
+
+  bool FileKeyedSettingsPersistence::ensureIndex() const {
+    if (m_index) {
+      return true;
+    }
+
+    detail::FileView file_view;
+    if (const auto error_code {file_view.open(m_filepath)}) {
+      if (error_code == std::errc::no_such_file_or_directory) {
+        m_index = Index {};
+        return true;
+      }
+
+      DD_LOG(error) << "Failed to load " << m_filepath << "! Error:\n"
+                    << "[" << error_code.value() << "] " << error_code.message();
+      return false;
+    }
+
+    Index index {};
+    const auto data {file_view.data()};
+    while (const auto record {parseRecord(data.subspan(index.m_file_size))}) {
+      const std::string key {record->m_key};
+      if (const auto it {index.m_entries.find(key)}; it != std::end(index.m_entries)) {
+        index.m_garbage_size += it->second.m_size;
+        index.m_entries.erase(it);
+      }
+
+      if (record->m_type == RecordType::Store) {
+        index.m_entries.emplace(key, IndexEntry {index.m_file_size, record->m_size});
+      } else {
+        index.m_garbage_size += record->m_size;
+      }
+      index.m_file_size += record->m_size;
+    }
+
+    if (index.m_file_size != data.size()) {
+      DD_LOG(warning) << "File " << m_filepath << " contains an incomplete record at its end. It will be dropped.";
+      index.m_has_incomplete_tail = true;
+    }
+
+    m_index = std::move(index);
+    return true;
+  }
+
+  bool FileKeyedSettingsPersistence::append(const std::vector<std::uint8_t> &record) {
+    std::error_code error_code;
+    if (m_index->m_has_incomplete_tail) {
+      // Drop the incomplete records so that the new record directly follows the valid ones
+      std::filesystem::resize_file(m_filepath, m_index->m_file_size, error_code);
+    }
+
+    if (!error_code) {
+      error_code = detail::writeAndSync(m_filepath, record, true);
+    }
+
+    if (error_code) {
+      DD_LOG(error) << "Failed to append to " << m_filepath << "! Error:\n"
+                    << "[" << error_code.value() << "] " << error_code.message();
+      m_index = std::nullopt;
+      return false;
+    }
+
+    m_index->m_file_size += record.size();
+    m_index->m_has_incomplete_tail = false;
+    return true;
+  }
+
+  void FileKeyedSettingsPersistence::compactIfNeeded() {
+    const auto live_size {m_index->m_file_size - m_index->m_garbage_size};
+    if (m_index->m_garbage_size >= COMPACTION_MIN_GARBAGE_SIZE && m_index->m_garbage_size > live_size) {
+      // Error (if any) is logged and the records are still available in the uncompacted file
+      static_cast<void>(compact());
+    }
+  }
+}  // namespace display_device
@@ -5,12 +5,8 @@
 // class header include
 #include "display_device/file_settings_persistence.h"
 
-// system includes
-#include <algorithm>
-#include <fstream>
-#include <iterator>
-
 // local includes
+#include "display_device/detail/file_utils.h"
 #include "display_device/logging.h"
 
 namespace display_device {
@@ -19,49 +15,34 @@ namespace display_device {
     if (m_filepath.empty()) {
       throw std::runtime_error {"Empty filename provided for FileSettingsPersistence!"};
     }
+
+    detail::removeStaleTemporaryFiles(m_filepath);
   }
 
   bool FileSettingsPersistence::store(const std::vector<std::uint8_t> &data) {
-    try {
-      std::ofstream stream {m_filepath, std::ios::binary | std::ios::trunc};
-      if (!stream) {
-        DD_LOG(error) << "Failed to open " << m_filepath << " for writing!";
-        return false;
-      }
-
-      std::copy(std::begin(data), std::end(data), std::ostreambuf_iterator<char> {stream});
-      return true;
-    } catch (const std::exception &error) {
+    if (const auto error_code {detail::writeFileAtomically(m_filepath, data)}) {
       DD_LOG(error) << "Failed to write to " << m_filepath << "! Error:\n"
-                    << error.what();
+                    << "[" << error_code.value() << "] " << error_code.message();
       return false;
     }
+
+    return true;
   }
 
   std::optional<std::vector<std::uint8_t>> FileSettingsPersistence::load() const {
-    if (std::error_code error_code; !std::filesystem::exists(m_filepath, error_code)) {
-      if (error_code) {
-        DD_LOG(error) << "Failed to load " << m_filepath << "! Error:\n"
-                      << "[" << error_code.value() << "] " << error_code.message();
-        return std::nullopt;
+    // The contents are returned as a vector, so a single sized read is cheaper than mapping the file and copying it
+    detail::FileView file_view;
+    if (const auto error_code {file_view.open(m_filepath, false)}) {
+      if (error_code == std::errc::no_such_file_or_directory) {
+        return std::vector<std::uint8_t> {};
       }
 
-      return std::vector<std::uint8_t> {};
-    }
-
-    try {
-      std::ifstream stream {m_filepath, std::ios::binary};
-      if (!stream) {
-        DD_LOG(error) << "Failed to open " << m_filepath << " for reading!";
-        return std::nullopt;
-      }
-
-      return std::vector<std::uint8_t> {std::istreambuf_iterator<char> {stream}, std::istreambuf_iterator<char> {}};
-    } catch (const std::exception &error) {
-      DD_LOG(error) << "Failed to read " << m_filepath << "! Error:\n"
-                    << error.what();
+      DD_LOG(error) << "Failed to load " << m_filepath << "! Error:\n"
+                    << "[" << error_code.value() << "] " << error_code.message();
       return std::nullopt;
     }
+
+    return std::move(file_view).release();
   }
 
   bool FileSettingsPersistence::clear() {
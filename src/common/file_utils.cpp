@@ -0,0 +1,384 @@
+/**
+ * @file src/common/file_utils.cpp
+ * @brief Definitions for private file helpers shared by the persistence implementations.
+ */
+// header include
+#include "display_device/detail/file_utils.h"
+
+// system includes
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#ifdef _WIN32
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <cerrno>
+  #include <csignal>
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+// local includes
+#include "display_device/logging.h"
+
+namespace display_device::detail {
+  namespace {
+    /**
+     * @brief Get the last OS error as an error code.
+     */
+    std::error_code lastError() {
+#ifdef _WIN32
+      return {static_cast<int>(GetLastError()), std::system_category()};
+#else
+      return {errno, std::generic_category()};
+#endif
+    }
+
+    /**
+     * @brief Get the path of a temporary sibling file that is unique to this write.
+     * @note The process ID keeps the name unique between the processes and the counter between the writes within the process.
+     */
+    std::filesystem::path makeTemporaryPath(const std::filesystem::path &filepath) {
+      static std::atomic_uint64_t counter {0};
+
+#ifdef _WIN32
+      const auto process_id {GetCurrentProcessId()};
+#else
+      const auto process_id {::getpid()};
+#endif
+
+      auto temp_filepath {filepath};
+      temp_filepath += "." + std::to_string(process_id) + "." + std::to_string(counter++) + ".tmp";
+      return temp_filepath;
+    }
+
+    /**
+     * @brief Get the process ID from the name created by `makeTemporaryPath`.
+     * @param filename Name of the file to check.
+     * @param prefix Name of the target file followed by a dot.
+     * @return Process ID if the name belongs to the target file's temporary file, empty optional otherwise.
+     */
+    std::optional<std::uint64_t> parseTemporaryProcessId(const std::string_view filename, const std::string_view prefix) {
+      constexpr std::string_view suffix {".tmp"};
+      if (filename.size() <= prefix.size() + suffix.size() || !filename.starts_with(prefix) || !filename.ends_with(suffix)) {
+        return std::nullopt;
+      }
+
+      const auto middle {filename.substr(prefix.size(), filename.size() - prefix.size() - suffix.size())};
+      const auto separator {middle.find('.')};
+      if (separator == std::string_view::npos) {
+        return std::nullopt;
+      }
+
+      const auto is_number {[](const std::string_view string, std::uint64_t &value) {
+        const auto *const end {string.data() + string.size()};
+        const auto result {std::from_chars(string.data(), end, value)};
+        return !string.empty() && result.ec == std::errc {} && result.ptr == end;
+      }};
+
+      std::uint64_t process_id {};
+      std::uint64_t counter {};
+      if (!is_number(middle.substr(0, separator), process_id) || !is_number(middle.substr(separator + 1), counter)) {
+        return std::nullopt;
+      }
+
+      return process_id;
+    }
+
+    /**
+     * @brief Check whether the process might still be running.
+     * @return False only if the process is known to be gone, true otherwise.
+     */
+    bool isProcessRunning(const std::uint64_t process_id) {
+#ifdef _WIN32
+      if (process_id > std::numeric_limits<DWORD>::max()) {
+        return false;
+      }
+
+      const HANDLE process {OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, static_cast<DWORD>(process_id))};
+      if (!process) {
+        // Only the existing processes can deny the access
+        return GetLastError() == ERROR_ACCESS_DENIED;
+      }
+
+      DWORD exit_code {0};
+      const bool running {!GetExitCodeProcess(process, &exit_code) || exit_code == STILL_ACTIVE};
+      CloseHandle(process);
+      return running;
+#else
+      // Zero and the values that do not fit would address the process groups instead
+      if (process_id == 0 || process_id > static_cast<std::uint64_t>(std::numeric_limits<pid_t>::max())) {
+        return false;
+      }
+
+      return ::kill(static_cast<pid_t>(process_id), 0) == 0 || errno != ESRCH;
+#endif
+    }
+  }  // namespace
+
+  FileView::~FileView() {
+    reset();
+  }
+
+  std::error_code FileView::open(const std::filesystem::path &filepath, [[maybe_unused]] const bool allow_mapping) {
+    reset();
+
+#ifdef _WIN32
+    const HANDLE file {CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr)};
+    if (file == INVALID_HANDLE_VALUE) {
+      return lastError();
+    }
+
+    std::error_code error_code;
+    LARGE_INTEGER file_size {};
+    if (!GetFileSizeEx(file, &file_size)) {
+      error_code = lastError();
+    } else {
+      m_buffer.resize(static_cast<std::size_t>(file_size.QuadPart));
+
+      std::size_t read {0};
+      while (!error_code && read < m_buffer.size()) {
+        const auto chunk {static_cast<DWORD>(std::min<std::size_t>(m_buffer.size() - read, MAXDWORD))};
+        DWORD chunk_read {0};
+        if (!ReadFile(file, m_buffer.data() + read, chunk, &chunk_read, nullptr)) {
+          error_code = lastError();
+        } else if (chunk_read == 0) {
+          // The file was truncated in the meantime
+          break;
+        }
+        read += chunk_read;
+      }
+      m_buffer.resize(read);
+    }
+
+    CloseHandle(file);
+#else
+    const int file {::open(filepath.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (file < 0) {
+      return lastError();
+    }
+
+    std::error_code error_code;
+    struct stat file_stat {};
+    if (::fstat(file, &file_stat) != 0) {
+      error_code = lastError();
+    } else {
+      const auto file_size {static_cast<std::size_t>(file_stat.st_size)};
+      if (allow_mapping && file_size >= MAPPING_THRESHOLD) {
+        if (void *mapping {::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file, 0)}; mapping != MAP_FAILED) {
+          m_data = {static_cast<const std::uint8_t *>(mapping), file_size};
+          m_mapped = true;
+        }
+      }
+
+      if (!m_mapped) {
+        m_buffer.resize(file_size);
+
+        std::size_t read {0};
+        while (!error_code && read < m_buffer.size()) {
+          const auto result {::read(file, m_buffer.data() + read, m_buffer.size() - read)};
+          if (result < 0) {
+            if (errno != EINTR) {
+              error_code = lastError();
+            }
+            continue;
+          }
+
+          if (result == 0) {
+            // The file was truncated in the meantime
+            break;
+          }
+          read += static_cast<std::size_t>(result);
+        }
+        m_buffer.resize(read);
+      }
+    }
+
+    ::close(file);
+#endif
+
+    if (error_code) {
+      reset();
+    } else if (!m_mapped) {
+      m_data = m_buffer;
+    }
+
+    return error_code;
+  }
+
+  std::span<const std::uint8_t> FileView::data() const {
+    return m_data;
+  }
+
+  bool FileView::isMapped() const {
+    return m_mapped;
+  }
+
+  std::vector<std::uint8_t> FileView::release() && {
+    std::vector<std::uint8_t> contents;
+    if (m_mapped) {
+      contents.assign(std::begin(m_data), std::end(m_data));
+    } else {
+      contents = std::move(m_buffer);
+    }
+
+    reset();
+    return contents;
+  }
+
+  void FileView::reset() {
+#ifndef _WIN32
+    if (m_mapped) {
+      ::munmap(const_cast<std::uint8_t *>(m_data.data()), m_data.size());
+    }
+#endif
+
+    m_data = {};
+    m_mapped = false;
+    m_buffer = {};
+  }
+
+  std::error_code writeAndSync(const std::filesystem::path &filepath, const std::span<const std::uint8_t> data, const bool append) {
+#ifdef _WIN32
+    const HANDLE file {CreateFileW(filepath.c_str(), append ? FILE_APPEND_DATA : GENERIC_WRITE, 0, nullptr, append ? OPEN_ALWAYS : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr)};
+    if (file == INVALID_HANDLE_VALUE) {
+      return lastError();
+    }
+
+    std::error_code error_code;
+    std::size_t written {0};
+    while (!error_code && written < data.size()) {
+      const auto chunk {static_cast<DWORD>(std::min<std::size_t>(data.size() - written, MAXDWORD))};
+      DWORD chunk_written {0};
+      if (!WriteFile(file, data.data() + written, chunk, &chunk_written, nullptr)) {
+        error_code = lastError();
+      } else if (chunk_written == 0) {
+        // No progress was made, retrying would loop forever
+        error_code = std::make_error_code(std::errc::io_error);
+        break;
+      }
+      written += chunk_written;
+    }
+
+    if (!error_code && !FlushFileBuffers(file)) {
+      error_code = lastError();
+    }
+
+    CloseHandle(file);
+    return error_code;
+#else
+    const int file {::open(filepath.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC | (append ? O_APPEND : O_TRUNC), 0644)};
+    if (file < 0) {
+      return lastError();
+    }
+
+    std::error_code error_code;
+    std::size_t written {0};
+    while (!error_code && written < data.size()) {
+      const auto result {::write(file, data.data() + written, data.size() - written)};
+      if (result < 0) {
+        if (errno != EINTR) {
+          error_code = lastError();
+        }
+        continue;
+      }
+      if (result == 0) {
+        // No progress was made, retrying would loop forever
+        error_code = std::make_error_code(std::errc::io_error);
+        break;
+      }
+      written += static_cast<std::size_t>(result);
+    }
+
+    if (!error_code && ::fsync(file) != 0) {
+      error_code = lastError();
+    }
+
+    ::close(file);
+    return error_code;
+#endif
+  }
+
+  std::error_code replaceFile(const std::filesystem::path &source, const std::filesystem::path &target) {
+#ifdef _WIN32
+    // The write-through flag makes the function return only after the move is flushed to the disk.
+    if (!MoveFileExW(source.c_str(), target.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+      return lastError();
+    }
+
+    return {};
+#else
+    if (::rename(source.c_str(), target.c_str()) != 0) {
+      return lastError();
+    }
+
+    // The directory entry must also be flushed, otherwise the rename itself might not survive a crash.
+    // The target is already replaced at this point, therefore failing to flush it is not a failure to replace.
+    const auto parent_path {target.parent_path()};
+    const int directory {::open(parent_path.empty() ? "." : parent_path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC)};
+    if (directory < 0) {
+      const auto error_code {lastError()};
+      DD_LOG(warning) << "Failed to open the directory of " << target << " for flushing the replaced file! Error: " << error_code.message();
+      return {};
+    }
+
+    if (::fsync(directory) != 0) {
+      const auto error_code {lastError()};
+      DD_LOG(warning) << "Failed to flush the directory of the replaced file " << target << "! Error: " << error_code.message();
+    }
+
+    ::close(directory);
+    return {};
+#endif
+  }
+
+  std::error_code writeFileAtomically(const std::filesystem::path &filepath, const std::span<const std::uint8_t> data) {
+    const auto temp_filepath {makeTemporaryPath(filepath)};
+    auto error_code {writeAndSync(temp_filepath, data)};
+    if (!error_code) {
+      error_code = replaceFile(temp_filepath, filepath);
+    }
+
+    if (error_code) {
+      std::error_code remove_error_code;
+      std::filesystem::remove(temp_filepath, remove_error_code);
+    }
+
+    return error_code;
+  }
+
+  void removeStaleTemporaryFiles(const std::filesystem::path &filepath) {
+    const auto parent_path {filepath.parent_path()};
+    const auto prefix {filepath.filename().string() + "."};
+
+    std::error_code error_code;
+    std::filesystem::directory_iterator it {parent_path.empty() ? std::filesystem::path {"."} : parent_path, error_code};
+    for (; !error_code && it != std::filesystem::directory_iterator {}; it.increment(error_code)) {
+      const auto process_id {parseTemporaryProcessId(it->path().filename().string(), prefix)};
+      if (!process_id || isProcessRunning(*process_id)) {
+        continue;
+      }
+
+      std::error_code remove_error_code;
+      if (std::filesystem::remove(it->path(), remove_error_code)) {
+        DD_LOG(info) << "Removed stale temporary file " << it->path() << ".";
+      } else if (remove_error_code) {
+        DD_LOG(warning) << "Failed to remove stale temporary file " << it->path() << "! Error: " << remove_error_code.message();
+      }
+    }
+
+    if (error_code && error_code != std::errc::no_such_file_or_directory) {
+      DD_LOG(warning) << "Failed to look for the stale temporary files of " << filepath << "! Error: " << error_code.message();
+    }
+  }
+}  // namespace display_device::detail
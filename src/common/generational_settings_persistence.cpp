@@ -0,0 +1,181 @@
+/**
+ * @file src/common/generational_settings_persistence.cpp
+ * @brief Definitions for the GenerationalSettingsPersistence.
+ */
+// class header include
+#include "display_device/generational_settings_persistence.h"
+
+// system includes
+#include <stdexcept>
+
+// local includes
+#include "display_device/detail/checksum.h"
+#include "display_device/detail/file_utils.h"
+#include "display_device/detail/little_endian.h"
+#include "display_device/logging.h"
+
+namespace display_device {
+  namespace {
+    /**
+     * @brief Size of the footer: [8 bytes generation][4 bytes data size][4 bytes CRC-32C], all little-endian.
+     * @note The checksum covers both the data and the rest of the footer.
+     */
+    constexpr std::size_t FOOTER_SIZE {16};
+
+    /**
+     * @brief Validate the generation file contents.
+     * @return Generation number and the data if the contents are valid, null optional otherwise.
+     */
+    std::optional<std::pair<std::uint64_t, std::span<const std::uint8_t>>> parseGeneration(const std::span<const std::uint8_t> contents) {
+      if (contents.size() < FOOTER_SIZE) {
+        return std::nullopt;
+      }
+
+      const auto data_size {contents.size() - FOOTER_SIZE};
+      const auto footer {contents.subspan(data_size)};
+      if (detail::readLittleEndian<std::uint32_t>(footer.subspan(8)) != data_size) {
+        return std::nullopt;
+      }
+
+      if (detail::readLittleEndian<std::uint32_t>(footer.subspan(12)) != detail::crc32c(contents.first(data_size + 12))) {
+        return std::nullopt;
+      }
+
+      const auto generation {detail::readLittleEndian<std::uint64_t>(footer)};
+      if (generation == 0) {
+        return std::nullopt;
+      }
+
+      return std::make_pair(generation, contents.first(data_size));
+    }
+  }  // namespace
+
+  GenerationalSettingsPersistence::GenerationalSettingsPersistence(std::filesystem::path filepath, const std::size_t generations):
+      m_filepath {std::move(filepath)},
+      m_generations {generations} {
+    if (m_filepath.empty()) {
+      throw std::runtime_error {"Empty filename provided for GenerationalSettingsPersistence!"};
+    }
+
+    if (m_generations == 0) {
+      throw std::runtime_error {"Number of generations for GenerationalSettingsPersistence must be larger than 0!"};
+    }
+
+    for (std::size_t slot {0}; slot < m_generations; ++slot) {
+      detail::removeStaleTemporaryFiles(getSlotFilepath(slot));
+    }
+  }
+
+  bool GenerationalSettingsPersistence::store(const std::vector<std::uint8_t> &data) {
+    if (!m_newest) {
+      m_newest = findNewestGeneration();
+      if (!m_newest) {
+        // Corrupted files will be overwritten by the new generations
+        m_newest = NewestGeneration {m_generations - 1, 0, {}};
+      }
+      m_newest->m_data = {};
+    }
+
+    const auto slot {(m_newest->m_slot + 1) % m_generations};
+    const auto generation {m_newest->m_generation + 1};
+
+    std::vector<std::uint8_t> contents;
+    contents.reserve(data.size() + FOOTER_SIZE);
+    contents.insert(std::end(contents), std::begin(data), std::end(data));
+    detail::appendLittleEndian(contents, generation);
+    detail::appendLittleEndian(contents, static_cast<std::uint32_t>(data.size()));
+    detail::appendLittleEndian(contents, detail::crc32c(contents));
+
+    const auto filepath {getSlotFilepath(slot)};
+    if (const auto error_code {detail::writeFileAtomically(filepath, contents)}) {
+      DD_LOG(error) << "Failed to write to " << filepath << "! Error:\n"
+                    << "[" << error_code.value() << "] " << error_code.message();
+      m_newest = std::nullopt;
+      return false;
+    }
+
+    m_newest = NewestGeneration {slot, generation, {}};
+    return true;
+  }
+
+  std::optional<std::vector<std::uint8_t>> GenerationalSettingsPersistence::load() const {
+    auto newest {findNewestGeneration()};
+    if (!newest) {
+      // Error already logged
+      return std::nullopt;
+    }
+
+    return std::move(newest->m_data);
+  }
+
+  bool GenerationalSettingsPersistence::clear() {
+    m_newest = std::nullopt;
+
+    bool success {true};
+    for (std::size_t slot = 0; slot < m_generations; ++slot) {
+      const auto filepath {getSlotFilepath(slot)};
+
+      // Return value does not matter since we check the error code in case the file could NOT be removed.
+      std::error_code error_code;
+      std::filesystem::remove(filepath, error_code);
+
+      if (error_code) {
+        DD_LOG(error) << "Failed to remove " << filepath << "! Error:\n"
+                      << "[" << error_code.value() << "] " << error_code.message();
+        success = false;
+      }
+    }
+
+    if (success) {
+      m_newest = NewestGeneration {m_generations - 1, 0, {}};
+    }
+    return success;
+  }
+
+  std::filesystem::path GenerationalSettingsPersistence::getSlotFilepath(const std::size_t slot) const {
+    auto filepath {m_filepath};
+    filepath += "." + std::to_string(slot);
+    return filepath;
+  }
+
+  std::optional<GenerationalSettingsPersistence::NewestGeneration> GenerationalSettingsPersistence::findNewestGeneration() const {
+    std::optional<NewestGeneration> newest;
+    std::size_t existing_files {0};
+
+    for (std::size_t slot = 0; slot < m_generations; ++slot) {
+      const auto filepath {getSlotFilepath(slot)};
+
+      detail::FileView file_view;
+      if (const auto error_code {file_view.open(filepath)}) {
+        if (error_code != std::errc::no_such_file_or_directory) {
+          existing_files++;
+          DD_LOG(warning) << "Failed to load " << filepath << "! Error:\n"
+                          << "[" << error_code.value() << "] " << error_code.message();
+        }
+        continue;
+      }
+
+      existing_files++;
+      const auto generation {parseGeneration(file_view.data())};
+      if (!generation) {
+        DD_LOG(warning) << "Generation file " << filepath << " is corrupted and will be ignored.";
+        continue;
+      }
+
+      if (!newest || newest->m_generation < generation->first) {
+        newest = NewestGeneration {slot, generation->first, {std::begin(generation->second), std::end(generation->second)}};
+      }
+    }
+
+    if (!newest) {
+      if (existing_files > 0) {
+        DD_LOG(error) << "None of the generation files for " << m_filepath << " are valid!";
+        return std::nullopt;
+      }
+
+      return NewestGeneration {m_generations - 1, 0, {}};
+    }
+
+    return newest;
+  }
+}  // namespace display_device
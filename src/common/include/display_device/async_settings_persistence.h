@@ -0,0 +1,137 @@
+/**
+ * @file src/common/include/display_device/async_settings_persistence.h
+ * @brief Declarations for the AsyncSettingsPersistence.
+ */
+#pragma once
+
+// system includes
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// local includes
+#include "settings_persistence_interface.h"
+
+namespace display_device {
+  /**
+   * @brief A wrapper for the SettingsPersistenceInterface that performs the stores
+   *        and clears in a background thread.
+   *
+   * Consecutive operations are coalesced so that only the latest one is forwarded
+   * to the wrapped interface. The pending operation is forwarded once the flush delay
+   * (counted from the first operation that is not yet forwarded) elapses, once the
+   * `flush` method is called or once the object is destroyed.
+   *
+   * Durability guarantees:
+   *   - `store` and `clear` only accept the operation and always return true.
+   *     The data is NOT durable at that point and is lost if the process crashes
+   *     before the operation is forwarded.
+   *   - Once `flush` returns true, every operation accepted before the call has been
+   *     forwarded to the wrapped interface successfully (and is as durable as
+   *     the wrapped interface makes it).
+   *   - Failed background operations are logged and retried after another flush delay,
+   *     unless they are superseded by a newer operation.
+   *   - `load` always reflects the latest accepted operation.
+   *
+   * @note The wrapped interface is never accessed concurrently.
+   */
+  class AsyncSettingsPersistence: public SettingsPersistenceInterface {
+  public:
+    /**
+     * Default constructor.
+     * @param settings_persistence_api Interface to forward the operations to. Throws on nullptr.
+     * @param flush_delay Maximum time an operation waits in the background before being forwarded. Throws if not larger than 0.
+     */
+    explicit AsyncSettingsPersistence(std::shared_ptr<SettingsPersistenceInterface> settings_persistence_api, std::chrono::milliseconds flush_delay = std::chrono::milliseconds {500});
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    AsyncSettingsPersistence(const AsyncSettingsPersistence &) = delete;
+
+    /**
+     * @brief Deleted copy operator.
+     */
+    AsyncSettingsPersistence &operator=(const AsyncSettingsPersistence &) = delete;
+
+    /**
+     * @brief Stops the background thread and forwards the pending operation (if any).
+     */
+    ~AsyncSettingsPersistence() override;
+
+    /**
+     * Accept the data to be stored in the background, replacing any pending operation.
+     * @returns Always true.
+     * @see SettingsPersistenceInterface::store for more details.
+     */
+    [[nodiscard]] bool store(const std::vector<std::uint8_t> &data) override;
+
+    /**
+     * Get the data from the pending operation or load it using the wrapped interface.
+     * @see SettingsPersistenceInterface::load for more details.
+     */
+    [[nodiscard]] std::optional<std::vector<std::uint8_t>> load() const override;
+
+    /**
+     * Accept the clear to be performed in the background, replacing any pending operation.
+     * @returns Always true.
+     * @see SettingsPersistenceInterface::clear for more details.
+     */
+    [[nodiscard]] bool clear() override;
+
+    /**
+     * @brief Wait for the operations in progress to complete and forward the pending one in the calling thread.
+     * @returns True if all of the accepted operations were forwarded successfully, false otherwise.
+     * @examples
+     * AsyncSettingsPersistence persistence { ... };
+     * persistence.store(data);
+     * const auto data_is_durable { persistence.flush() };
+     * @examples_end
+     */
+    [[nodiscard]] bool flush();
+
+  private:
+    /**
+     * @brief Operation to be forwarded to the wrapped interface.
+     */
+    struct PendingOperation {
+      std::optional<std::vector<std::uint8_t>> m_data; /**< Data to be stored (null if the data is to be cleared). */
+      std::uint64_t m_generation {}; /**< Sequence number assigned when the operation is accepted. */
+    };
+
+    /**
+     * @brief Assign the next generation, replace the pending operation and wake up the thread.
+     */
+    void schedule(PendingOperation operation);
+
+    /**
+     * @brief Forward the pending operation to the wrapped interface.
+     * @param lock Acquired lock for the `m_mutex` that will be released while forwarding.
+     * @returns True if the operation was forwarded successfully, false otherwise.
+     * @note A failed operation is rescheduled only if no newer operation was accepted in the meantime.
+     *       The operation is counted as in progress until it is either completed or rescheduled.
+     */
+    bool forwardPending(std::unique_lock<std::mutex> &lock);
+
+    std::shared_ptr<SettingsPersistenceInterface> m_settings_persistence_api; /**< Interface to forward the operations to. */
+    std::chrono::milliseconds m_flush_delay; /**< Maximum time an operation is kept pending. */
+
+    std::optional<PendingOperation> m_pending; /**< Latest accepted operation that is not yet forwarded. */
+    std::chrono::steady_clock::time_point m_deadline {}; /**< Time when the pending operation is to be forwarded. */
+    std::uint64_t m_last_generation {}; /**< Generation of the latest accepted operation. */
+    std::size_t m_forwards_in_progress {}; /**< Number of operations taken from the pending slot, but not yet completed or rescheduled. */
+
+    mutable std::mutex m_mutex {}; /**< A mutex for synchronizing access to the pending operation. */
+    mutable std::mutex m_api_mutex {}; /**< A mutex for synchronizing access to the wrapped interface. Always locked after `m_mutex`, if both are needed. */
+    std::condition_variable m_sleep_cv {}; /**< Condition variable for waking up thread. */
+    std::condition_variable m_forward_cv {}; /**< Condition variable for waiting on the operations in progress. */
+    bool m_keep_alive {true}; /**< When set to false, the thread will exit. */
+
+    // Always the last in the list so that all the members are already initialized!
+    std::thread m_thread; /**< A thread forwarding the operations. */
+  };
+}  // namespace display_device
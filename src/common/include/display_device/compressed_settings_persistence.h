@@ -0,0 +1,75 @@
+/**
+ * @file src/common/include/display_device/compressed_settings_persistence.h
+ * @brief Declarations for the CompressedSettingsPersistence.
+ */
+#pragma once
+
+// system includes
+#include <memory>
+
+// local includes
+#include "settings_persistence_interface.h"
+
+namespace display_device {
+  /**
+   * @brief A decorator for the SettingsPersistenceInterface that compresses
+   *        the data with zstd before forwarding it.
+   *
+   * The format of the loaded data is detected automatically, therefore the data
+   * that was stored without compression (e.g. by an older version) can still be loaded.
+   *
+   * @note If the library is built without zstd, the data is stored uncompressed
+   *       and only the uncompressed data can be loaded.
+   */
+  class CompressedSettingsPersistence: public SettingsPersistenceInterface {
+  public:
+    /**
+     * @brief Maximum size of the decompressed data, protecting against malformed data.
+     */
+    static constexpr std::size_t MAX_DECOMPRESSED_SIZE {64 * 1024 * 1024};
+
+    /**
+     * Default constructor.
+     * @param settings_persistence_api Interface to be decorated. Throws on nullptr.
+     * @param compression_level zstd compression level to use.
+     */
+    explicit CompressedSettingsPersistence(std::shared_ptr<SettingsPersistenceInterface> settings_persistence_api, int compression_level = 3);
+
+    /**
+     * Compress the data (if supported) and store it using the decorated interface.
+     * @see SettingsPersistenceInterface::store for more details.
+     */
+    [[nodiscard]] bool store(const std::vector<std::uint8_t> &data) override;
+
+    /**
+     * Load the data using the decorated interface and decompress it if needed.
+     * @see SettingsPersistenceInterface::load for more details.
+     */
+    [[nodiscard]] std::optional<std::vector<std::uint8_t>> load() const override;
+
+    /**
+     * Clear the data using the decorated interface.
+     * @see SettingsPersistenceInterface::clear for more details.
+     */
+    [[nodiscard]] bool clear() override;
+
+    /**
+     * Check the preference of the decorated interface.
+     * @see SettingsPersistenceInterface::prefersIntermediateStores for more details.
+     */
+    [[nodiscard]] bool prefersIntermediateStores() const override;
+
+    /**
+     * @brief Check whether the library was built with the compression support.
+     * @returns True if the data is compressed when storing, false otherwise.
+     * @examples
+     * const bool compressed = CompressedSettingsPersistence::isCompressionAvailable();
+     * @examples_end
+     */
+    [[nodiscard]] static bool isCompressionAvailable();
+
+  private:
+    std::shared_ptr<SettingsPersistenceInterface> m_settings_persistence_api;
+    int m_compression_level;
+  };
+}  // namespace display_device
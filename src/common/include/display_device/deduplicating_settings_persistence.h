@@ -0,0 +1,98 @@
+/**
+ * @file src/common/include/display_device/deduplicating_settings_persistence.h
+ * @brief Declarations for the DeduplicatingSettingsPersistence.
+ */
+#pragma once
+
+// system includes
+#include <memory>
+
+// local includes
+#include "settings_persistence_interface.h"
+
+namespace display_device {
+  /**
+   * @brief A decorator for the SettingsPersistenceInterface that skips storing
+   *        the data which is identical to the last stored or loaded data.
+   *
+   * Only the size and a 64-bit hash of the last known data is kept in memory.
+   */
+  class DeduplicatingSettingsPersistence: public SettingsPersistenceInterface {
+  public:
+    /**
+     * @brief Store statistics.
+     */
+    struct Stats {
+      std::size_t m_hits {}; /**< Number of skipped stores due to identical data. */
+      std::size_t m_misses {}; /**< Number of stores forwarded to the decorated interface. */
+
+      /**
+       * @brief Comparator for the statistics.
+       */
+      friend bool operator==(const Stats &lhs, const Stats &rhs) = default;
+    };
+
+    /**
+     * Default constructor.
+     * @param settings_persistence_api Interface to be decorated. Throws on nullptr.
+     */
+    explicit DeduplicatingSettingsPersistence(std::shared_ptr<SettingsPersistenceInterface> settings_persistence_api);
+
+    /**
+     * Store the data using the decorated interface, unless the data matches the last known data.
+     * @see SettingsPersistenceInterface::store for more details.
+     */
+    [[nodiscard]] bool store(const std::vector<std::uint8_t> &data) override;
+
+    /**
+     * Load the data using the decorated interface and remember it as the last known data.
+     * @see SettingsPersistenceInterface::load for more details.
+     */
+    [[nodiscard]] std::optional<std::vector<std::uint8_t>> load() const override;
+
+    /**
+     * Clear the data using the decorated interface and forget the last known data.
+     * @see SettingsPersistenceInterface::clear for more details.
+     */
+    [[nodiscard]] bool clear() override;
+
+    /**
+     * Check the preference of the decorated interface.
+     * @see SettingsPersistenceInterface::prefersIntermediateStores for more details.
+     */
+    [[nodiscard]] bool prefersIntermediateStores() const override;
+
+    /**
+     * @brief Get the store statistics.
+     * @returns Number of skipped and forwarded stores.
+     * @examples
+     * const DeduplicatingSettingsPersistence persistence { ... };
+     * const auto stats { persistence.getStats() };
+     * @examples_end
+     */
+    [[nodiscard]] Stats getStats() const;
+
+  private:
+    /**
+     * @brief Fingerprint of the data.
+     */
+    struct Fingerprint {
+      std::size_t m_size {}; /**< Size of the data. */
+      std::uint64_t m_hash {}; /**< Hash of the data. */
+
+      /**
+       * @brief Comparator for the fingerprint.
+       */
+      friend bool operator==(const Fingerprint &lhs, const Fingerprint &rhs) = default;
+    };
+
+    /**
+     * @brief Make a fingerprint of the data.
+     */
+    static Fingerprint makeFingerprint(const std::vector<std::uint8_t> &data);
+
+    std::shared_ptr<SettingsPersistenceInterface> m_settings_persistence_api;
+    mutable std::optional<Fingerprint> m_last_fingerprint; /**< Fingerprint of the data in the persistent medium (null if unknown). */
+    Stats m_stats;
+  };
+}  // namespace display_device
@@ -0,0 +1,45 @@
+/**
+ * @file src/common/include/display_device/detail/checksum.h
+ * @brief Declarations for private checksum helpers.
+ */
+#pragma once
+
+// system includes
+#include <cstdint>
+#include <span>
+
+namespace display_device::detail {
+  /**
+   * @brief Compute the CRC-32C (Castagnoli) checksum of the data.
+   *
+   * The SSE4.2 (x86-64, detected at runtime) or ARMv8 CRC32 (when enabled
+   * by the compile target) instructions are used if available.
+   *
+   * @param data Data to compute the checksum for.
+   * @param crc Checksum of the preceding data when computing the checksum in chunks.
+   * @return Computed checksum.
+   * @examples
+   * const std::vector<std::uint8_t> data { ... };
+   * const auto checksum { crc32c(data) };
+   * @examples_end
+   */
+  std::uint32_t crc32c(std::span<const std::uint8_t> data, std::uint32_t crc = 0);
+
+  /**
+   * @brief Compute the 64-bit FNV-1a hash of the data.
+   * @param data Data to compute the hash for.
+   * @return Computed hash.
+   * @note The hash is meant for detecting changes in data, not for integrity checks.
+   */
+  std::uint64_t fnv1a64(std::span<const std::uint8_t> data);
+
+  /**
+   * @brief Compute the sum of all the bytes in the data.
+   *
+   * The SSE2 (x86-64) or NEON (AArch64) instructions are used if available.
+   *
+   * @param data Data to compute the sum for.
+   * @return Sum of the bytes, e.g. for verifying the EDID block checksum (sum % 256 == 0).
+   */
+  std::uint32_t sumBytes(std::span<const std::uint8_t> data);
+}  // namespace display_device::detail
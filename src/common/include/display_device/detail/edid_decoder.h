@@ -0,0 +1,62 @@
+/**
+ * @file src/common/include/display_device/detail/edid_decoder.h
+ * @brief Declarations for the private EDID block decoder.
+ */
+#pragma once
+
+// system includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+// local includes
+#include "display_device/types.h"
+
+namespace display_device::detail {
+  /**
+   * @brief Size of the base EDID block and of every extension block.
+   */
+  constexpr std::size_t EDID_BLOCK_SIZE {128};
+
+  /**
+   * @brief Fixed header at the beginning of the base EDID block.
+   */
+  constexpr std::array<std::byte, 8> EDID_FIXED_HEADER {std::byte {0x00}, std::byte {0xFF}, std::byte {0xFF}, std::byte {0xFF}, std::byte {0xFF}, std::byte {0xFF}, std::byte {0xFF}, std::byte {0x00}};
+
+  /**
+   * @brief Format the value as 4 uppercase hex digits.
+   * @param value Value to format.
+   * @return Zero-padded hex digits.
+   * @examples
+   * static_assert(std::string_view {formatHex16(0x27EC).data(), 4} == "27EC");
+   * @examples_end
+   */
+  constexpr std::array<char, 4> formatHex16(const std::uint16_t value) {
+    constexpr std::string_view digits {"0123456789ABCDEF"};
+    return {digits[(value >> 12) & 0xF], digits[(value >> 8) & 0xF], digits[(value >> 4) & 0xF], digits[value & 0xF]};
+  }
+
+  /**
+   * @brief Verify the checksum of a single EDID block.
+   * @param block Block of EDID_BLOCK_SIZE bytes.
+   * @return True if all of the block bytes sum up to 0 (modulo 256), false otherwise.
+   */
+  [[nodiscard]] bool isEdidBlockChecksumValid(std::span<const std::byte> block);
+
+  /**
+   * @brief Decode the display descriptors of the base block and all of the supported extension blocks.
+   *
+   * The base block provides the established and standard timings besides the descriptors.
+   * Supported extension blocks are CTA-861 (detailed timings, short video descriptors, HDR static
+   * metadata and the HDMI Forum VRR range) and DisplayID (type I/VII timings and product name).
+   * Blocks with an invalid checksum or an unsupported tag are skipped, which (same as any other
+   * source of the modes that is not decoded) leaves the modes marked as incomplete.
+   *
+   * @param data EDID data with an already validated base block.
+   * @param edid Parsed data to be filled.
+   * @note The data is only viewed, nothing is copied except for the final values.
+   */
+  void decodeEdidBlocks(std::span<const std::byte> data, EdidData &edid);
+}  // namespace display_device::detail
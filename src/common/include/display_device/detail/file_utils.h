@@ -0,0 +1,145 @@
+/**
+ * @file src/common/include/display_device/detail/file_utils.h
+ * @brief Declarations for private file helpers shared by the persistence implementations.
+ */
+#pragma once
+
+// system includes
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <system_error>
+#include <vector>
+
+namespace display_device::detail {
+  /**
+   * @brief Read-only view of the whole file contents.
+   *
+   * Large files are memory-mapped (POSIX only) to avoid copying them, while
+   * smaller files (or when mapping fails) are read into a buffer of the file's
+   * size with a single read.
+   *
+   * @warning The mapped data must not be accessed after the file is truncated
+   *          in-place, therefore the view should be short-lived.
+   */
+  class FileView {
+  public:
+    /**
+     * @brief Files of this size or larger are memory-mapped.
+     */
+    static constexpr std::size_t MAPPING_THRESHOLD {64 * 1024};
+
+    /**
+     * @brief Default constructor. Creates an empty view.
+     */
+    FileView() = default;
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    FileView(const FileView &) = delete;
+
+    /**
+     * @brief Deleted copy operator.
+     */
+    FileView &operator=(const FileView &) = delete;
+
+    /**
+     * @brief Releases the file contents.
+     */
+    ~FileView();
+
+    /**
+     * @brief Open the file and make its contents available via the `data` method.
+     * @param filepath File to be opened.
+     * @param allow_mapping Specify whether the large files can be memory-mapped. Disable it if
+     *                      the contents are going to be released, as the mapping would be copied anyway.
+     * @return Empty error code on success, error code otherwise.
+     *         Missing file can be detected by comparing the error code to `std::errc::no_such_file_or_directory`.
+     * @examples
+     * FileView view;
+     * if (const auto error_code { view.open(filepath) }) {
+     *   return error_code == std::errc::no_such_file_or_directory;
+     * }
+     * process(view.data());
+     * @examples_end
+     */
+    [[nodiscard]] std::error_code open(const std::filesystem::path &filepath, bool allow_mapping = true);
+
+    /**
+     * @brief Get the file contents.
+     * @return Contents of the last successfully opened file, empty otherwise.
+     */
+    [[nodiscard]] std::span<const std::uint8_t> data() const;
+
+    /**
+     * @brief Check whether the file contents are memory-mapped.
+     * @return True if mapped, false otherwise.
+     */
+    [[nodiscard]] bool isMapped() const;
+
+    /**
+     * @brief Take the file contents out of the view, leaving it empty.
+     * @return Contents of the last successfully opened file, empty otherwise.
+     * @note The read buffer is moved out as is, only the mapped contents are copied.
+     * @examples
+     * FileView view;
+     * if (!view.open(filepath, false)) {
+     *   auto contents { std::move(view).release() };
+     * }
+     * @examples_end
+     */
+    [[nodiscard]] std::vector<std::uint8_t> release() &&;
+
+  private:
+    /**
+     * @brief Release the file contents.
+     */
+    void reset();
+
+    std::span<const std::uint8_t> m_data;
+    bool m_mapped {false};
+    std::vector<std::uint8_t> m_buffer;
+  };
+
+  /**
+   * @brief Write the data to the file in bulk and flush it to the disk.
+   * @param filepath File to be written to.
+   * @param data Data to be written.
+   * @param append Specify whether the data should be appended instead of overwriting the file.
+   * @return Empty error code on success, error code otherwise.
+   */
+  std::error_code writeAndSync(const std::filesystem::path &filepath, std::span<const std::uint8_t> data, bool append = false);
+
+  /**
+   * @brief Atomically replace the target file with the source file and flush the change to the disk.
+   * @param source File to be moved.
+   * @param target File to be replaced.
+   * @return Empty error code on success, error code otherwise.
+   * @note Once the target is replaced, failing to flush its directory entry is only logged as
+   *       a warning and the replacement is still reported as successful.
+   */
+  std::error_code replaceFile(const std::filesystem::path &source, const std::filesystem::path &target);
+
+  /**
+   * @brief Atomically write the data to the file.
+   *
+   * The data is written and flushed to a sibling "<filepath>.<pid>.<counter>.tmp" file first, which
+   * then replaces the target file. The temporary file is removed on failure.
+   * The temporary name is unique to the write, so the concurrent writers never share it.
+   * A crash can still leave the temporary file behind, see `removeStaleTemporaryFiles`.
+   *
+   * @param filepath File to be created or replaced.
+   * @param data Data to be written.
+   * @return Empty error code on success, error code otherwise.
+   */
+  std::error_code writeFileAtomically(const std::filesystem::path &filepath, std::span<const std::uint8_t> data);
+
+  /**
+   * @brief Remove the temporary files left behind by `writeFileAtomically` in the processes that are no longer running.
+   * @param filepath File whose temporary siblings are to be removed.
+   * @note The files of the running processes (including this one) are kept, since their writes might still be in progress.
+   *       Failures are only logged, as the stale files do not affect the target file.
+   */
+  void removeStaleTemporaryFiles(const std::filesystem::path &filepath);
+}  // namespace display_device::detail
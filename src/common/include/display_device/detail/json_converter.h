@@ -7,6 +7,7 @@
 #ifdef DD_JSON_DETAIL
   // system includes
   #include <nlohmann/json.hpp>
+  #include <span>
 
 namespace display_device {
   // A shared "toJson" implementation. Extracted here for UTs + coverage.
@@ -48,6 +49,70 @@ namespace display_device {
     }
   }
 
+  /**
+   * @brief A migration step that upgrades the JSON data from version N to N + 1 in-place.
+   */
+  using JsonMigrationStep = void (*)(nlohmann::json &data);
+
+  // A shared "toVersionedJson" implementation. Extracted here for UTs + coverage.
+  template<typename Type>
+  std::string toVersionedJsonHelper(const Type &obj, std::span<const JsonMigrationStep> migrations, const std::optional<unsigned int> &indent, bool *success) {
+    try {
+      if (success) {
+        *success = true;
+      }
+
+      nlohmann::json json_obj;
+      json_obj["version"] = migrations.size();
+      json_obj["data"] = obj;
+      return json_obj.dump(static_cast<int>(indent.value_or(-1)));
+    } catch (const std::exception &err) {  // GCOVR_EXCL_BR_LINE for fallthrough branch
+      if (success) {
+        *success = false;
+      }
+
+      return err.what();
+    }
+  }
+
+  // A shared "fromVersionedJson" implementation. Extracted here for UTs + coverage.
+  template<typename Type>
+  bool fromVersionedJsonHelper(const std::string &string, Type &obj, std::span<const JsonMigrationStep> migrations, std::string *error_message = nullptr) {
+    try {
+      if (error_message) {
+        error_message->clear();
+      }
+
+      nlohmann::json json_obj = nlohmann::json::parse(string);
+      std::size_t version {0};
+      if (json_obj.is_object() && json_obj.contains("version")) {
+        version = json_obj.at("version").get<std::size_t>();
+
+        // Moving the data out of the envelope instead of copying it.
+        nlohmann::json data = std::move(json_obj.at("data"));
+        json_obj = std::move(data);
+      }
+
+      if (version > migrations.size()) {
+        throw std::runtime_error {"Unsupported data version " + std::to_string(version) + "! Latest supported version is " + std::to_string(migrations.size()) + "."};
+      }
+
+      for (; version < migrations.size(); ++version) {
+        migrations[version](json_obj);
+      }
+
+      Type parsed_obj = json_obj.get<Type>();
+      obj = std::move(parsed_obj);
+      return true;
+    } catch (const std::exception &err) {
+      if (error_message) {
+        *error_message = err.what();
+      }
+
+      return false;
+    }
+  }
+
   #define DD_JSON_DEFINE_CONVERTER(Type) \
     std::string toJson(const Type &obj, const std::optional<unsigned int> &indent, bool *success) { \
       return toJsonHelper(obj, indent, success); \
@@ -55,5 +120,13 @@ namespace display_device {
     bool fromJson(const std::string &string, Type &obj, std::string *error_message) { \
       return fromJsonHelper<Type>(string, obj, error_message); \
     }
+
+  #define DD_JSON_DEFINE_VERSIONED_CONVERTER(Type, migrations) \
+    std::string toVersionedJson(const Type &obj, const std::optional<unsigned int> &indent, bool *success) { \
+      return toVersionedJsonHelper(obj, migrations, indent, success); \
+    } \
+    bool fromVersionedJson(const std::string &string, Type &obj, std::string *error_message) { \
+      return fromVersionedJsonHelper<Type>(string, obj, migrations, error_message); \
+    }
 }  // namespace display_device
 #endif
@@ -14,10 +14,17 @@ namespace display_device {
   DD_JSON_DECLARE_SERIALIZE_TYPE(SingleDisplayConfiguration::DevicePreparation)
   DD_JSON_DECLARE_SERIALIZE_TYPE(SingleDisplayConfiguration::Profile)
 
+  // Interned types
+  DD_JSON_DECLARE_SERIALIZE_TYPE(DeviceId)
+
   // Structs
   DD_JSON_DECLARE_SERIALIZE_TYPE(Resolution)
   DD_JSON_DECLARE_SERIALIZE_TYPE(Rational)
   DD_JSON_DECLARE_SERIALIZE_TYPE(Point)
+  DD_JSON_DECLARE_SERIALIZE_TYPE(EdidData::Timing)
+  DD_JSON_DECLARE_SERIALIZE_TYPE(EdidData::VideoMode)
+  DD_JSON_DECLARE_SERIALIZE_TYPE(EdidData::HdrStaticMetadata)
+  DD_JSON_DECLARE_SERIALIZE_TYPE(EdidData::RefreshRateRange)
   DD_JSON_DECLARE_SERIALIZE_TYPE(EdidData)
   DD_JSON_DECLARE_SERIALIZE_TYPE(EnumeratedDevice::Info)
   DD_JSON_DECLARE_SERIALIZE_TYPE(EnumeratedDevice)
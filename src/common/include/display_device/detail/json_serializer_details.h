@@ -11,6 +11,12 @@
   // Special versions of the NLOHMANN definitions to remove the "m_" prefix in string form ('cause I like it that way ;P)
   #define DD_JSON_TO(v1) nlohmann_json_j[#v1] = nlohmann_json_t.m_##v1;
   #define DD_JSON_FROM(v1) nlohmann_json_j.at(#v1).get_to(nlohmann_json_t.m_##v1);
+  #define DD_JSON_FROM_IF_PRESENT(v1) \
+    if (const auto it {nlohmann_json_j.find(#v1)}; it != nlohmann_json_j.end()) { \
+      it->get_to(nlohmann_json_t.m_##v1); \
+    } else { \
+      nlohmann_json_t.m_##v1 = {}; \
+    }
 
   // Coverage has trouble with inlined functions when they are included in different units,
   // therefore the usual macro was split into declaration and definition
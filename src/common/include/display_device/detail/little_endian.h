@@ -0,0 +1,39 @@
+/**
+ * @file src/common/include/display_device/detail/little_endian.h
+ * @brief Declarations for private helpers encoding integers in the on-disk byte order.
+ */
+#pragma once
+
+// system includes
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace display_device::detail {
+  /**
+   * @brief Read a little-endian value from the beginning of the data.
+   * @param data Data containing at least `sizeof(T)` bytes.
+   * @return Decoded value.
+   */
+  template<std::unsigned_integral T>
+  T readLittleEndian(const std::span<const std::uint8_t> data) {
+    T value {0};
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+      value |= static_cast<T>(data[i]) << (8 * i);
+    }
+    return value;
+  }
+
+  /**
+   * @brief Append a value to the data in little-endian order.
+   * @param data Data to append to.
+   * @param value Value to be appended.
+   */
+  template<std::unsigned_integral T>
+  void appendLittleEndian(std::vector<std::uint8_t> &data, const T value) {
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+      data.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+  }
+}  // namespace display_device::detail
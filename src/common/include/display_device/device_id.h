@@ -0,0 +1,142 @@
+/**
+ * @file src/common/include/display_device/device_id.h
+ * @brief Declarations for the interned DeviceId.
+ */
+#pragma once
+
+// system includes
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+namespace display_device {
+  /**
+   * @brief A device id interned in a process-wide table.
+   *
+   * The id is a 32-bit handle to the interned string, so copying, equality and hashing
+   * do not touch the string itself. It is implicitly convertible to the string so that
+   * the string based APIs keep working as adapters.
+   *
+   * Constructing the id interns the string permanently, therefore it is explicit and meant
+   * only for the ids that are to be stored. Strings that are only searched for or compared
+   * against are to be looked up via `find` or compared directly, which never interns.
+   *
+   * The ordering still compares the strings, therefore the ordered containers iterate
+   * the same way as they did with the plain strings.
+   *
+   * @note Interned strings are never released, which is fine for the handful of
+   *       device ids a system has. Should the table ever get full, the id is left
+   *       empty (and an error is logged) instead of throwing.
+   * @note The intern table is thread-safe.
+   */
+  class DeviceId {
+  public:
+    /**
+     * Default constructor for an empty id.
+     */
+    DeviceId() = default;
+
+    /**
+     * Constructor interning the string.
+     * @param id Device id string.
+     * @examples
+     * const DeviceId id {"{77f67f3e-754f-5d31-af64-ee037e18100a}"};
+     * @examples_end
+     */
+    explicit DeviceId(std::string_view id);
+
+    /**
+     * @copydoc DeviceId(std::string_view)
+     */
+    explicit DeviceId(const std::string &id);
+
+    /**
+     * @copydoc DeviceId(std::string_view)
+     */
+    explicit DeviceId(const char *id);
+
+    /**
+     * @brief Look up the already interned string without interning it.
+     * @param id Device id string.
+     * @return Interned id, or an empty id if the string was never interned.
+     * @note An id that was never interned cannot be stored anywhere, therefore
+     *       the returned empty id does not match anything except for the empty ids.
+     * @examples
+     * const auto it = device_modes.find(DeviceId::find(untrusted_string));
+     * @examples_end
+     */
+    [[nodiscard]] static DeviceId find(std::string_view id);
+
+    /**
+     * @brief Get the interned string.
+     * @return Reference to the string which is valid for the lifetime of the process.
+     */
+    [[nodiscard]] const std::string &str() const;
+
+    /**
+     * @brief Implicit conversion for the string based APIs.
+     */
+    operator const std::string &() const;  // NOLINT(*-explicit-constructor)
+
+    /**
+     * @brief Check if the id is empty.
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Get the handle of the interned string.
+     * @note The handle values depend on the interning order and are not to be persisted.
+     */
+    [[nodiscard]] std::uint32_t getHandle() const;
+
+    /**
+     * @brief Comparator for equality of the handles.
+     */
+    friend bool operator==(const DeviceId &lhs, const DeviceId &rhs) = default;
+
+    /**
+     * @brief Comparator for equality of the id string, without interning the other string.
+     */
+    friend bool operator==(const DeviceId &lhs, std::string_view rhs);
+
+    /**
+     * @brief Comparator ordering the ids the same way as their strings.
+     */
+    friend std::strong_ordering operator<=>(const DeviceId &lhs, const DeviceId &rhs);
+
+  private:
+    std::uint32_t m_handle {0};
+  };
+
+  /**
+   * @brief Write the id string to the stream (e.g. for logging).
+   */
+  std::ostream &operator<<(std::ostream &stream, const DeviceId &id);
+
+  namespace literals {
+    /**
+     * @brief Intern the string literal as a device id.
+     * @examples
+     * using namespace display_device::literals;
+     * const ActiveTopology topology {{"DeviceId1"_id, "DeviceId2"_id}};
+     * @examples_end
+     */
+    inline DeviceId operator""_id(const char *id, const std::size_t size) {
+      return DeviceId {std::string_view {id, size}};
+    }
+  }  // namespace literals
+}  // namespace display_device
+
+/**
+ * @brief Hash of the DeviceId handle.
+ */
+template<>
+struct std::hash<display_device::DeviceId> {
+  std::size_t operator()(const display_device::DeviceId &id) const noexcept {
+    return std::hash<std::uint32_t> {}(id.getHandle());
+  }
+};
@@ -0,0 +1,179 @@
+/**
+ * @file src/common/include/display_device/display_config.h
+ * @brief Declarations for the platform-neutral display configuration model.
+ */
+#pragma once
+
+// system includes
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+// local includes
+#include "flat_set.h"
+#include "types.h"
+
+namespace display_device {
+  /**
+   * @brief A LIST[LIST[DEVICE_ID]] structure which represents an active topology.
+   *
+   * Single display:
+   *     [[DISPLAY_1]]
+   * 2 extended displays:
+   *     [[DISPLAY_1], [DISPLAY_2]]
+   * 2 duplicated displays:
+   *     [[DISPLAY_1, DISPLAY_2]]
+   * Mixed displays:
+   *     [[EXTENDED_DISPLAY_1], [DUPLICATED_DISPLAY_1, DUPLICATED_DISPLAY_2], [EXTENDED_DISPLAY_2]]
+   *
+   * @note On Windows the order does not matter of both device ids or the inner lists.
+   */
+  using ActiveTopology = std::vector<std::vector<DeviceId>>;
+
+  /**
+   * @brief Ordered set of device ids, e.g. a flattened topology.
+   */
+  using DeviceIdSet = FlatSet<DeviceId>;
+
+  /**
+   * @brief Locally unique id of the graphics adapter (mirrors the Windows' LUID).
+   */
+  struct AdapterId {
+    std::uint32_t m_low_part {};
+    std::int32_t m_high_part {};
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const AdapterId &lhs, const AdapterId &rhs);
+  };
+
+  /**
+   * @brief Pack the adapter id into a single integer.
+   * @param id Id to pack.
+   * @return Key that is unique for every adapter id.
+   * @examples
+   * static_assert(packAdapterId({3, 1}) == 0x0000000100000003);
+   * @examples_end
+   */
+  [[nodiscard]] constexpr std::uint64_t packAdapterId(const AdapterId &id) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(id.m_high_part)) << 32) | id.m_low_part;
+  }
+
+  /**
+   * @brief A path connecting a source (rendered by the adapter) to a target (display).
+   */
+  struct DisplayPath {
+    AdapterId m_adapter_id {}; /**< Adapter of the source. */
+    std::uint32_t m_source_id {}; /**< Source id, unique only within the adapter. */
+    std::uint32_t m_target_id {}; /**< Target id, unique only within the adapter. */
+    bool m_available {}; /**< Whether the target is available (connected). */
+    bool m_active {}; /**< Whether the path is currently active. */
+    std::optional<std::uint32_t> m_source_mode_index {}; /**< Index of the source mode for the active path. */
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const DisplayPath &lhs, const DisplayPath &rhs);
+  };
+
+  /**
+   * @brief Source mode (desktop area) of an active path.
+   */
+  struct DisplaySourceMode {
+    Point m_position {}; /**< Position on the desktop, the primary display is at (0, 0). */
+    Resolution m_size {}; /**< Size of the desktop area. */
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const DisplaySourceMode &lhs, const DisplaySourceMode &rhs);
+  };
+
+  /**
+   * @brief Contains the paths and modes of the display configuration.
+   */
+  struct DisplayConfigData {
+    std::vector<DisplayPath> m_paths {}; /**< Paths with the active ones in the front. */
+    std::vector<std::optional<DisplaySourceMode>> m_source_modes {}; /**< Modes in the original order, empty for the non-source modes. */
+  };
+
+  /**
+   * @brief Specifies additional constraints for the validated device.
+   */
+  enum class ValidatedPathType {
+    Active, /**< The device path must be active. */
+    Any /**< The device path can be active or inactive. */
+  };
+
+  /**
+   * @brief Contains the device path and the id for a VALID device.
+   * @see config_utils::getDeviceInfoForValidPath for what is considered a valid device.
+   */
+  struct ValidatedDeviceInfo {
+    std::string m_device_path {}; /**< Unique device path string. */
+    std::string m_device_id {}; /**< A device id (made up by us) that identifies the device. */
+  };
+
+  /**
+   * @brief Resolve the device info of the path at the specified index.
+   *
+   * Resolving the device info is expensive on some platforms, therefore it is done lazily
+   * and only for the paths that pass the cheaper checks first.
+   *
+   * @returns Device info, or empty optional if the device cannot be identified.
+   */
+  using DeviceInfoResolver = std::function<std::optional<ValidatedDeviceInfo>(std::size_t path_index)>;
+
+  /**
+   * @brief Contains information about sources with identical adapter ids from matching paths.
+   */
+  struct PathSourceIndexData {
+    std::map<std::uint32_t, std::size_t> m_source_id_to_path_index {}; /**< Maps source ids to its index in the path list. */
+    AdapterId m_adapter_id {}; /**< Adapter id shared by all source ids. */
+    std::optional<std::uint32_t> m_active_source {}; /**< Currently active source id. */
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const PathSourceIndexData &lhs, const PathSourceIndexData &rhs);
+  };
+
+  /**
+   * @brief Ordered map of [DEVICE_ID -> PathSourceIndexData].
+   * @see PathSourceIndexData
+   */
+  using PathSourceIndexDataMap = std::map<DeviceId, PathSourceIndexData>;
+
+  /**
+   * @brief A path selected for the new topology.
+   */
+  struct TopologyPath {
+    std::size_t m_path_index {}; /**< Index of the path in the path list. */
+    std::uint32_t m_clone_group_id {}; /**< Group id shared by the duplicated displays. */
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const TopologyPath &lhs, const TopologyPath &rhs);
+  };
+}  // namespace display_device
+
+/**
+ * @brief Hash of the packed AdapterId.
+ *
+ * The packed key is mixed since the adapter ids usually differ only in a few low bits.
+ */
+template<>
+struct std::hash<display_device::AdapterId> {
+  std::size_t operator()(const display_device::AdapterId &id) const noexcept {
+    // SplitMix64 finalizer
+    std::uint64_t key {display_device::packAdapterId(id)};
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+    return static_cast<std::size_t>(key ^ (key >> 31));
+  }
+};
@@ -0,0 +1,90 @@
+/**
+ * @file src/common/include/display_device/display_config_utils.h
+ * @brief Declarations for the platform-neutral display configuration algorithms.
+ */
+#pragma once
+
+// system includes
+#include <span>
+
+// local includes
+#include "display_config.h"
+
+/**
+ * @brief Algorithms operating on the platform-neutral display configuration model.
+ *
+ * Platforms convert their native paths and modes to the model and provide a DeviceInfoResolver,
+ * which allows testing, fuzzing and benchmarking the algorithms with synthetic data.
+ */
+namespace display_device::config_utils {
+  /**
+   * @brief Get the source mode of the path.
+   * @param path Path to get the source mode for.
+   * @param modes List of the source modes (empty for non-source modes).
+   * @returns Pointer to the source mode, or nullptr if the path has no (valid) source mode.
+   * @examples
+   * const DisplayConfigData data;
+   * const auto *source_mode = getSourceMode(data.m_paths.front(), data.m_source_modes);
+   * @examples_end
+   */
+  [[nodiscard]] const DisplaySourceMode *getSourceMode(const DisplayPath &path, std::span<const std::optional<DisplaySourceMode>> modes);
+
+  /**
+   * @brief Check if the path is valid and get the associated device info.
+   *
+   * A valid path is available, active (if requested) and its device info can be resolved.
+   *
+   * @param paths List of paths.
+   * @param path_index Index of the path to check.
+   * @param type Additional constraints for the path.
+   * @param resolver Resolver for the device info, only called if the other checks pass.
+   * @returns Device info for a valid path, empty optional otherwise.
+   */
+  [[nodiscard]] std::optional<ValidatedDeviceInfo> getDeviceInfoForValidPath(std::span<const DisplayPath> paths, std::size_t path_index, ValidatedPathType type, const DeviceInfoResolver &resolver);
+
+  /**
+   * @brief Get the index of the active path matching the device id.
+   * @param paths List of paths to search.
+   * @param device_id Id of the device to search for.
+   * @param resolver Resolver for the device info.
+   * @returns Index of the first matching active path, or empty optional if none was found.
+   */
+  [[nodiscard]] std::optional<std::size_t> getActivePathIndex(std::span<const DisplayPath> paths, const DeviceId &device_id, const DeviceInfoResolver &resolver);
+
+  /**
+   * @brief Collect the source ids and path indexes of all the valid paths, grouped by the device id.
+   *
+   * A device can have multiple paths (one for each source id it can be rendered from), with
+   * only the first one (if any) being active.
+   *
+   * @param paths List of paths with the active ones in the front.
+   * @param resolver Resolver for the device info.
+   * @returns Map of the collected data, or an empty map if none was found or the paths are inconsistent.
+   */
+  [[nodiscard]] PathSourceIndexDataMap collectSourceDataForMatchingPaths(std::span<const DisplayPath> paths, const DeviceInfoResolver &resolver);
+
+  /**
+   * @brief Select the paths needed to activate the new topology.
+   *
+   * For every device the path with the lowest index and a still free source id is selected,
+   * except for the devices of the same adapter within a group, which must share the source id.
+   *
+   * @param new_topology Topology to make the paths for.
+   * @param path_source_data Data from collectSourceDataForMatchingPaths.
+   * @param path_count Size of the path list the data was collected from.
+   * @returns Selected paths with their clone group ids, or an empty list if the topology cannot be made.
+   */
+  [[nodiscard]] std::vector<TopologyPath> makePathsForNewTopology(const ActiveTopology &new_topology, const PathSourceIndexDataMap &path_source_data, std::size_t path_count);
+
+  /**
+   * @brief Get the device ids together with the ids of the devices duplicating them.
+   *
+   * Duplicated devices share the same desktop position of their source modes.
+   *
+   * @param active_config Currently active configuration.
+   * @param device_ids Device ids to start with.
+   * @param resolver Resolver for the device info.
+   * @returns All of the device ids, or an empty set if any of the devices is not active or has no source mode.
+   */
+  [[nodiscard]] DeviceIdSet getAllDeviceIdsAndMatchingDuplicates(const DisplayConfigData &active_config, const DeviceIdSet &device_ids, const DeviceInfoResolver &resolver);
+}  // namespace display_device::config_utils
@@ -0,0 +1,92 @@
+/**
+ * @file src/common/include/display_device/edid_cache.h
+ * @brief Declarations for the EdidCache.
+ */
+#pragma once
+
+// system includes
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+// local includes
+#include "types.h"
+
+namespace display_device {
+  /**
+   * @brief A bounded cache of the parsed EDID data, keyed by the hash of the raw EDID bytes.
+   *
+   * The raw bytes are kept alongside the parsed data and compared on every hit, therefore
+   * a hash collision can only cause a miss. Least recently used entries are evicted once
+   * the capacity is reached. Failed parse results are cached too.
+   *
+   * @note The cache is thread-safe.
+   */
+  class EdidCache {
+  public:
+    /**
+     * @brief Cache statistics.
+     */
+    struct Stats {
+      std::size_t m_hits {}; /**< Number of lookups returning the cached data. */
+      std::size_t m_misses {}; /**< Number of lookups that had to parse the data. */
+      std::size_t m_evictions {}; /**< Number of entries evicted due to the capacity limit. */
+
+      /**
+       * @brief Comparator for the statistics.
+       */
+      friend bool operator==(const Stats &lhs, const Stats &rhs) = default;
+    };
+
+    /**
+     * Default constructor.
+     * @param capacity Maximum number of cached entries. Throws if it's 0.
+     */
+    explicit EdidCache(std::size_t capacity = 16);
+
+    /**
+     * @brief Get the parsed EDID data from the cache or parse and cache it.
+     * @param data Raw EDID data.
+     * @return Parsed data or empty optional if failed to parse it.
+     * @see EdidData::parse for more details.
+     * @examples
+     * EdidCache cache;
+     * const auto edid {cache.parse(raw_edid)};
+     * @examples_end
+     */
+    [[nodiscard]] std::optional<EdidData> parse(std::span<const std::byte> data);
+
+    /**
+     * @brief Get the cache statistics.
+     * @returns Number of hits, misses and evictions.
+     */
+    [[nodiscard]] Stats getStats() const;
+
+    /**
+     * @brief Get the number of cached entries.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Remove all of the cached entries. Statistics are kept.
+     */
+    void clear();
+
+  private:
+    /**
+     * @brief Cached parse result.
+     */
+    struct Entry {
+      std::uint64_t m_hash {}; /**< Hash of the raw data. */
+      std::vector<std::byte> m_data {}; /**< Raw data for verifying the hits. */
+      std::optional<EdidData> m_edid {}; /**< Parse result. */
+    };
+
+    std::size_t m_capacity;
+    mutable std::mutex m_mutex;
+    std::list<Entry> m_entries; /**< Entries ordered from the most to the least recently used. */
+    std::unordered_map<std::uint64_t, std::list<Entry>::iterator> m_index;
+    Stats m_stats;
+  };
+}  // namespace display_device
@@ -0,0 +1,121 @@
+/**
+ * @file src/common/include/display_device/file_keyed_settings_persistence.h
+ * @brief Declarations for the FileKeyedSettingsPersistence.
+ */
+#pragma once
+
+// system includes
+#include <filesystem>
+#include <unordered_map>
+
+// local includes
+#include "keyed_settings_persistence_interface.h"
+
+namespace display_device {
+  /**
+   * @brief Implementation of the KeyedSettingsPersistenceInterface,
+   *        that keeps all of the records in a single append-only file.
+   *
+   * Every store or remove appends a checksummed record to the file. An in-memory
+   * index (built by scanning the file on first access) maps the keys to the latest
+   * records, so a single record can be loaded without reading the rest of the file.
+   *
+   * Once the outdated records take up more space than the live ones, the file
+   * is compacted by atomically replacing it with a copy containing only the live records.
+   *
+   * @warning The file must not be modified by other instances while this one is in use.
+   */
+  class FileKeyedSettingsPersistence: public KeyedSettingsPersistenceInterface {
+  public:
+    /**
+     * @brief Minimum size of the outdated records before the compaction is considered.
+     */
+    static constexpr std::size_t COMPACTION_MIN_GARBAGE_SIZE {64 * 1024};
+
+    /**
+     * Default constructor. Does not perform any operations on the file yet,
+     * only removes the temporary files left behind by the interrupted stores.
+     * @param filepath A non-empty filepath. Throws on empty.
+     */
+    explicit FileKeyedSettingsPersistence(std::filesystem::path filepath);
+
+    /**
+     * Append the record to the file specified in constructor.
+     * @warning The method does not create missing directories!
+     * @see KeyedSettingsPersistenceInterface::store for more details.
+     */
+    [[nodiscard]] bool store(const std::string &key, const std::vector<std::uint8_t> &data) override;
+
+    /**
+     * Read the latest record for the key from the file specified in constructor.
+     * @see KeyedSettingsPersistenceInterface::load for more details.
+     */
+    [[nodiscard]] std::optional<std::vector<std::uint8_t>> load(const std::string &key) const override;
+
+    /**
+     * Append the removal record to the file specified in constructor.
+     * @see KeyedSettingsPersistenceInterface::remove for more details.
+     */
+    [[nodiscard]] bool remove(const std::string &key) override;
+
+    /**
+     * @see KeyedSettingsPersistenceInterface::getKeys for more details.
+     */
+    [[nodiscard]] std::optional<std::vector<std::string>> getKeys() const override;
+
+    /**
+     * Remove the file specified in constructor (if it exists).
+     * @see KeyedSettingsPersistenceInterface::clear for more details.
+     */
+    [[nodiscard]] bool clear() override;
+
+    /**
+     * @brief Rewrite the file so that it contains only the live records.
+     * @returns True on success, false otherwise.
+     * @examples
+     * FileKeyedSettingsPersistence persistence { ... };
+     * const auto result = persistence.compact();
+     * @examples_end
+     */
+    [[nodiscard]] bool compact();
+
+  private:
+    /**
+     * @brief Location of the live record in the file.
+     */
+    struct IndexEntry {
+      std::uint64_t m_offset {}; /**< Offset of the record. */
+      std::size_t m_size {}; /**< Size of the whole record. */
+    };
+
+    /**
+     * @brief In-memory index of the file.
+     */
+    struct Index {
+      std::unordered_map<std::string, IndexEntry> m_entries; /**< Live records. */
+      std::uint64_t m_file_size {}; /**< Size of the valid part of the file. */
+      std::uint64_t m_garbage_size {}; /**< Size of the outdated records. */
+      bool m_has_incomplete_tail {false}; /**< Specifies whether the file contains incomplete records after the valid part. */
+    };
+
+    /**
+     * @brief Build the index if it is not available yet.
+     * @returns True if the index is available, false otherwise.
+     */
+    [[nodiscard]] bool ensureIndex() const;
+
+    /**
+     * @brief Append the record to the file and update the index.
+     * @returns True on success, false otherwise.
+     */
+    [[nodiscard]] bool append(const std::vector<std::uint8_t> &record);
+
+    /**
+     * @brief Compact the file if enough outdated records have accumulated.
+     */
+    void compactIfNeeded();
+
+    std::filesystem::path m_filepath;
+    mutable std::optional<Index> m_index; /**< Index of the file (null if it needs to be rebuilt). */
+  };
+}  // namespace display_device
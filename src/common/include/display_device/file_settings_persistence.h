@@ -18,13 +18,18 @@ namespace display_device {
   class FileSettingsPersistence: public SettingsPersistenceInterface {
   public:
     /**
-     * Default constructor. Does not perform any operations on the file yet.
+     * Default constructor. Does not perform any operations on the file yet,
+     * only removes the temporary files left behind by the interrupted stores.
      * @param filepath A non-empty filepath. Throws on empty.
      */
     explicit FileSettingsPersistence(std::filesystem::path filepath);
 
     /**
      * Store the data in the file specified in constructor.
+     *
+     * The data is written and flushed to a unique temporary sibling file first, which then atomically
+     * replaces the target file. A crash during the store leaves either the old or the new data in the file,
+     * and the concurrent stores never write to the same temporary file.
      * @warning The method does not create missing directories!
      * @see SettingsPersistenceInterface::store for more details.
      */
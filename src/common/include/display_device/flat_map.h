@@ -0,0 +1,245 @@
+/**
+ * @file src/common/include/display_device/flat_map.h
+ * @brief Declarations for the FlatMap.
+ */
+#pragma once
+
+// system includes
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace display_device {
+  /**
+   * @brief An ordered map stored as a sorted vector of key-value pairs.
+   *
+   * Meant for the small maps (a few displays) where a node-based std::map spends more
+   * time allocating and chasing pointers than comparing the keys. Lookups are binary
+   * searches, insertions and removals shift the following elements.
+   *
+   * The interface mirrors std::map (hence the naming), so that it can be used as a drop-in
+   * replacement, including the JSON serialization. Unlike std::map, inserting or removing
+   * elements invalidates the iterators and the keys must not be modified via the iterators.
+   */
+  template<class Key, class Value, class Compare = std::less<Key>>
+  class FlatMap {
+  public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using key_compare = Compare;
+    using container_type = std::vector<value_type>;
+    using size_type = typename container_type::size_type;
+    using difference_type = typename container_type::difference_type;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+    using iterator = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+
+    /**
+     * Default constructor for an empty map.
+     */
+    FlatMap() = default;
+
+    /**
+     * Constructor from a range of key-value pairs. Only the first of the duplicate keys is kept.
+     * @param first Start of the range.
+     * @param last End of the range.
+     */
+    template<class InputIt>
+    FlatMap(InputIt first, InputIt last):
+        m_data(first, last) {
+      std::ranges::stable_sort(m_data, m_compare, &value_type::first);
+      const auto duplicates {std::ranges::unique(m_data, [this](const auto &lhs, const auto &rhs) {
+        return !m_compare(lhs, rhs) && !m_compare(rhs, lhs);
+      },
+                                                 &value_type::first)};
+      m_data.erase(std::begin(duplicates), std::end(duplicates));
+    }
+
+    /**
+     * Constructor from the initializer list. Only the first of the duplicate keys is kept.
+     * @param init Key-value pairs.
+     * @examples
+     * const FlatMap<std::string, int> map {{"a", 1}, {"b", 2}};
+     * @examples_end
+     */
+    FlatMap(std::initializer_list<value_type> init):
+        FlatMap(std::begin(init), std::end(init)) {
+    }
+
+    iterator begin() {
+      return std::begin(m_data);
+    }
+
+    const_iterator begin() const {
+      return std::begin(m_data);
+    }
+
+    const_iterator cbegin() const {
+      return std::cbegin(m_data);
+    }
+
+    iterator end() {
+      return std::end(m_data);
+    }
+
+    const_iterator end() const {
+      return std::end(m_data);
+    }
+
+    const_iterator cend() const {
+      return std::cend(m_data);
+    }
+
+    [[nodiscard]] bool empty() const {
+      return m_data.empty();
+    }
+
+    [[nodiscard]] size_type size() const {
+      return m_data.size();
+    }
+
+    void clear() {
+      m_data.clear();
+    }
+
+    void reserve(const size_type capacity) {
+      m_data.reserve(capacity);
+    }
+
+    iterator lower_bound(const Key &key) {
+      return std::ranges::lower_bound(m_data, key, m_compare, &value_type::first);
+    }
+
+    const_iterator lower_bound(const Key &key) const {
+      return std::ranges::lower_bound(m_data, key, m_compare, &value_type::first);
+    }
+
+    iterator find(const Key &key) {
+      const auto it {lower_bound(key)};
+      return isMatch(it, key) ? it : end();
+    }
+
+    const_iterator find(const Key &key) const {
+      const auto it {lower_bound(key)};
+      return isMatch(it, key) ? it : end();
+    }
+
+    [[nodiscard]] bool contains(const Key &key) const {
+      return find(key) != end();
+    }
+
+    [[nodiscard]] size_type count(const Key &key) const {
+      return contains(key) ? 1 : 0;
+    }
+
+    Value &at(const Key &key) {
+      const auto it {find(key)};
+      if (it == end()) {
+        throw std::out_of_range {"Key not found in FlatMap!"};
+      }
+      return it->second;
+    }
+
+    const Value &at(const Key &key) const {
+      const auto it {find(key)};
+      if (it == end()) {
+        throw std::out_of_range {"Key not found in FlatMap!"};
+      }
+      return it->second;
+    }
+
+    Value &operator[](const Key &key) {
+      return try_emplace(key).first->second;
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args) {
+      const auto it {lower_bound(key)};
+      if (isMatch(it, key)) {
+        return {it, false};
+      }
+      return {m_data.emplace(it, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...)), true};
+    }
+
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const Key &key, M &&value) {
+      auto result {try_emplace(key, std::forward<M>(value))};
+      if (!result.second) {
+        result.first->second = std::forward<M>(value);
+      }
+      return result;
+    }
+
+    std::pair<iterator, bool> insert(value_type value) {
+      const auto it {lower_bound(value.first)};
+      if (isMatch(it, value.first)) {
+        return {it, false};
+      }
+      return {m_data.insert(it, std::move(value)), true};
+    }
+
+    /**
+     * @brief Insert the value, using the hint to skip the search if the value belongs right before it.
+     * @note Makes filling from an already sorted source (e.g. via std::inserter) linear.
+     */
+    iterator insert(const_iterator hint, value_type value) {
+      const bool hint_is_valid {(hint == cend() || m_compare(value.first, hint->first)) && (hint == cbegin() || m_compare(std::prev(hint)->first, value.first))};
+      if (!hint_is_valid) {
+        return insert(std::move(value)).first;
+      }
+      return m_data.insert(hint, std::move(value));
+    }
+
+    template<class InputIt>
+    void insert(InputIt first, InputIt last) {
+      for (; first != last; ++first) {
+        insert(*first);
+      }
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> emplace(Args &&...args) {
+      return insert(value_type(std::forward<Args>(args)...));
+    }
+
+    iterator erase(const_iterator pos) {
+      return m_data.erase(pos);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+      return m_data.erase(first, last);
+    }
+
+    size_type erase(const Key &key) {
+      const auto it {find(key)};
+      if (it == end()) {
+        return 0;
+      }
+      m_data.erase(it);
+      return 1;
+    }
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const FlatMap &lhs, const FlatMap &rhs) {
+      return lhs.m_data == rhs.m_data;
+    }
+
+  private:
+    /**
+     * @brief Check if the iterator from lower_bound points to the key.
+     */
+    bool isMatch(const const_iterator it, const Key &key) const {
+      return it != cend() && !m_compare(key, it->first);
+    }
+
+    container_type m_data;
+    [[no_unique_address]] Compare m_compare;
+  };
+}  // namespace display_device
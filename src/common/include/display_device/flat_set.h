@@ -0,0 +1,182 @@
+/**
+ * @file src/common/include/display_device/flat_set.h
+ * @brief Declarations for the FlatSet.
+ */
+#pragma once
+
+// system includes
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+namespace display_device {
+  /**
+   * @brief An ordered set stored as a sorted vector of unique keys.
+   *
+   * The set counterpart of the FlatMap, with an interface mirroring std::set. Inserting
+   * or removing elements invalidates the iterators.
+   */
+  template<class Key, class Compare = std::less<Key>>
+  class FlatSet {
+  public:
+    using key_type = Key;
+    using value_type = Key;
+    using key_compare = Compare;
+    using container_type = std::vector<Key>;
+    using size_type = typename container_type::size_type;
+    using difference_type = typename container_type::difference_type;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+    using iterator = typename container_type::const_iterator;
+    using const_iterator = typename container_type::const_iterator;
+
+    /**
+     * Default constructor for an empty set.
+     */
+    FlatSet() = default;
+
+    /**
+     * Constructor from a range of keys. Duplicate keys are dropped.
+     * @param first Start of the range.
+     * @param last End of the range.
+     */
+    template<class InputIt>
+    FlatSet(InputIt first, InputIt last):
+        m_data(first, last) {
+      std::ranges::sort(m_data, m_compare);
+      const auto duplicates {std::ranges::unique(m_data, [this](const auto &lhs, const auto &rhs) {
+        return !m_compare(lhs, rhs) && !m_compare(rhs, lhs);
+      })};
+      m_data.erase(std::begin(duplicates), std::end(duplicates));
+    }
+
+    /**
+     * Constructor from the initializer list. Duplicate keys are dropped.
+     * @param init Keys.
+     * @examples
+     * const FlatSet<std::string> set {"b", "a", "b"};  // {"a", "b"}
+     * @examples_end
+     */
+    FlatSet(std::initializer_list<Key> init):
+        FlatSet(std::begin(init), std::end(init)) {
+    }
+
+    const_iterator begin() const {
+      return std::begin(m_data);
+    }
+
+    const_iterator cbegin() const {
+      return std::cbegin(m_data);
+    }
+
+    const_iterator end() const {
+      return std::end(m_data);
+    }
+
+    const_iterator cend() const {
+      return std::cend(m_data);
+    }
+
+    [[nodiscard]] bool empty() const {
+      return m_data.empty();
+    }
+
+    [[nodiscard]] size_type size() const {
+      return m_data.size();
+    }
+
+    void clear() {
+      m_data.clear();
+    }
+
+    void reserve(const size_type capacity) {
+      m_data.reserve(capacity);
+    }
+
+    const_iterator lower_bound(const Key &key) const {
+      return std::ranges::lower_bound(m_data, key, m_compare);
+    }
+
+    const_iterator find(const Key &key) const {
+      const auto it {lower_bound(key)};
+      return isMatch(it, key) ? it : end();
+    }
+
+    [[nodiscard]] bool contains(const Key &key) const {
+      return find(key) != end();
+    }
+
+    [[nodiscard]] size_type count(const Key &key) const {
+      return contains(key) ? 1 : 0;
+    }
+
+    std::pair<iterator, bool> insert(Key key) {
+      const auto it {lower_bound(key)};
+      if (isMatch(it, key)) {
+        return {it, false};
+      }
+      return {m_data.insert(it, std::move(key)), true};
+    }
+
+    /**
+     * @brief Insert the key, using the hint to skip the search if the key belongs right before it.
+     * @note Makes filling from an already sorted source (e.g. via std::inserter) linear.
+     */
+    iterator insert(const_iterator hint, Key key) {
+      const bool hint_is_valid {(hint == cend() || m_compare(key, *hint)) && (hint == cbegin() || m_compare(*std::prev(hint), key))};
+      if (!hint_is_valid) {
+        return insert(std::move(key)).first;
+      }
+      return m_data.insert(hint, std::move(key));
+    }
+
+    template<class InputIt>
+    void insert(InputIt first, InputIt last) {
+      for (; first != last; ++first) {
+        insert(*first);
+      }
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> emplace(Args &&...args) {
+      return insert(Key(std::forward<Args>(args)...));
+    }
+
+    iterator erase(const_iterator pos) {
+      return m_data.erase(pos);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+      return m_data.erase(first, last);
+    }
+
+    size_type erase(const Key &key) {
+      const auto it {find(key)};
+      if (it == end()) {
+        return 0;
+      }
+      m_data.erase(it);
+      return 1;
+    }
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const FlatSet &lhs, const FlatSet &rhs) {
+      return lhs.m_data == rhs.m_data;
+    }
+
+  private:
+    /**
+     * @brief Check if the iterator from lower_bound points to the key.
+     */
+    bool isMatch(const const_iterator it, const Key &key) const {
+      return it != cend() && !m_compare(key, *it);
+    }
+
+    container_type m_data;
+    [[no_unique_address]] Compare m_compare;
+  };
+}  // namespace display_device
@@ -0,0 +1,80 @@
+/**
+ * @file src/common/include/display_device/generational_settings_persistence.h
+ * @brief Declarations for the GenerationalSettingsPersistence.
+ */
+#pragma once
+
+// system includes
+#include <filesystem>
+
+// local includes
+#include "settings_persistence_interface.h"
+
+namespace display_device {
+  /**
+   * @brief Implementation of the SettingsPersistenceInterface,
+   *        that keeps multiple checksummed generations of the persistent settings.
+   *
+   * The generations are stored in "<filepath>.<slot>" files which are overwritten
+   * in a round-robin manner. Each file contains the data followed by a footer with
+   * the generation number, data size and a CRC-32C checksum.
+   *
+   * When loading, the newest valid generation is used. If it is corrupted,
+   * the older generations are tried instead.
+   */
+  class GenerationalSettingsPersistence: public SettingsPersistenceInterface {
+  public:
+    /**
+     * Default constructor. Does not perform any operations on the files yet,
+     * only removes the temporary files left behind by the interrupted stores.
+     * @param filepath A non-empty base filepath. Throws on empty.
+     * @param generations Number of generations to keep. Throws on 0.
+     */
+    explicit GenerationalSettingsPersistence(std::filesystem::path filepath, std::size_t generations = 3);
+
+    /**
+     * Store the data as a new generation, overwriting the oldest one.
+     * @warning The method does not create missing directories!
+     * @see SettingsPersistenceInterface::store for more details.
+     */
+    [[nodiscard]] bool store(const std::vector<std::uint8_t> &data) override;
+
+    /**
+     * Read the data from the newest valid generation.
+     * @note If none of the files exist, an empty data list will be returned instead of null optional.
+     * @see SettingsPersistenceInterface::load for more details.
+     */
+    [[nodiscard]] std::optional<std::vector<std::uint8_t>> load() const override;
+
+    /**
+     * Remove all of the generation files (if they exist).
+     * @see SettingsPersistenceInterface::clear for more details.
+     */
+    [[nodiscard]] bool clear() override;
+
+  private:
+    /**
+     * @brief Information about the newest valid generation.
+     */
+    struct NewestGeneration {
+      std::size_t m_slot {}; /**< Slot containing the generation. */
+      std::uint64_t m_generation {}; /**< Generation number (0 if there are no generations). */
+      std::vector<std::uint8_t> m_data {}; /**< Data of the generation. */
+    };
+
+    /**
+     * @brief Get the filepath for the specified slot.
+     */
+    [[nodiscard]] std::filesystem::path getSlotFilepath(std::size_t slot) const;
+
+    /**
+     * @brief Find the newest valid generation.
+     * @return Null optional if some files exist, but none of them are valid or could be read.
+     */
+    [[nodiscard]] std::optional<NewestGeneration> findNewestGeneration() const;
+
+    std::filesystem::path m_filepath;
+    std::size_t m_generations;
+    std::optional<NewestGeneration> m_newest; /**< Cached newest generation info (null if unknown). The data is not kept. */
+  };
+}  // namespace display_device
@@ -0,0 +1,75 @@
+/**
+ * @file src/common/include/display_device/journal_settings_persistence.h
+ * @brief Declarations for the JournalSettingsPersistence.
+ */
+#pragma once
+
+// system includes
+#include <filesystem>
+
+// local includes
+#include "settings_persistence_interface.h"
+
+namespace display_device {
+  /**
+   * @brief Implementation of the SettingsPersistenceInterface,
+   *        that appends the persistent settings to a write-ahead journal file.
+   *
+   * Every store appends a small checksummed record to the journal instead of rewriting
+   * the whole file, which makes it cheap to persist the state after every step of a
+   * multi-step operation. The latest complete record represents the current data.
+   *
+   * A record that was only partially written (e.g. due to a crash) is discarded
+   * and the previous record is used instead.
+   *
+   * Once the journal contains the specified amount of records, it is compacted
+   * into a single record by atomically replacing the file.
+   */
+  class JournalSettingsPersistence: public SettingsPersistenceInterface {
+  public:
+    /**
+     * Default constructor. Does not perform any operations on the file yet,
+     * only removes the temporary files left behind by the interrupted stores.
+     * @param filepath A non-empty filepath. Throws on empty.
+     * @param compaction_threshold Number of records after which the journal is compacted. Throws on 0.
+     */
+    explicit JournalSettingsPersistence(std::filesystem::path filepath, std::size_t compaction_threshold = 32);
+
+    /**
+     * Append the data to the journal file specified in constructor.
+     * @warning The method does not create missing directories!
+     * @see SettingsPersistenceInterface::store for more details.
+     */
+    [[nodiscard]] bool store(const std::vector<std::uint8_t> &data) override;
+
+    /**
+     * Read the latest complete record from the journal file specified in constructor.
+     * @note If file does not exist, an empty data list will be returned instead of null optional.
+     * @see SettingsPersistenceInterface::load for more details.
+     */
+    [[nodiscard]] std::optional<std::vector<std::uint8_t>> load() const override;
+
+    /**
+     * Remove the journal file specified in constructor (if it exists).
+     * @see SettingsPersistenceInterface::clear for more details.
+     */
+    [[nodiscard]] bool clear() override;
+
+    /**
+     * Appending a record is cheap, therefore every step of a multi-step operation should be stored.
+     * @see SettingsPersistenceInterface::prefersIntermediateStores for more details.
+     */
+    [[nodiscard]] bool prefersIntermediateStores() const override;
+
+  private:
+    /**
+     * @brief Scan the journal file and drop the incomplete records from its end.
+     * @return True if the journal is ready for appending, false otherwise.
+     */
+    [[nodiscard]] bool recoverJournal();
+
+    std::filesystem::path m_filepath;
+    std::size_t m_compaction_threshold;
+    std::optional<std::size_t> m_record_count; /**< Number of records in the journal (null if unknown). */
+  };
+}  // namespace display_device
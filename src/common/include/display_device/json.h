@@ -21,6 +21,21 @@
   [[nodiscard]] std::string toJson(const Type &obj, const std::optional<unsigned int> &indent = 2u, bool *success = nullptr); \
   [[nodiscard]] bool fromJson(const std::string &string, Type &obj, std::string *error_message = nullptr);  // NOLINT(*-macro-parentheses)
 
+/**
+ * @brief Helper MACRO to declare the versioned toJson and fromJson converters for a type.
+ *
+ * The versioned converters wrap the data into a `{"version": N, "data": {...}}` envelope.
+ * When loading data with an older version (data without an envelope is treated as version 0),
+ * the registered migration steps are applied before the data is converted to the type.
+ * @examples
+ * SingleDisplayConfigState state;
+ * const auto json_string {toVersionedJson(state)};
+ * @examples_end
+ */
+#define DD_JSON_DECLARE_VERSIONED_CONVERTER(Type) \
+  [[nodiscard]] std::string toVersionedJson(const Type &obj, const std::optional<unsigned int> &indent = 2u, bool *success = nullptr); \
+  [[nodiscard]] bool fromVersionedJson(const std::string &string, Type &obj, std::string *error_message = nullptr);  // NOLINT(*-macro-parentheses)
+
 // Shared converters (add as needed)
 namespace display_device {
   extern const std::optional<unsigned int> JSON_COMPACT;
@@ -0,0 +1,81 @@
+/**
+ * @file src/common/include/display_device/keyed_settings_persistence_interface.h
+ * @brief Declarations for the KeyedSettingsPersistenceInterface.
+ */
+#pragma once
+
+// system includes
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace display_device {
+  /**
+   * @brief A class for storing and loading multiple named settings data records from a persistent medium.
+   */
+  class KeyedSettingsPersistenceInterface {
+  public:
+    /**
+     * @brief Default virtual destructor.
+     */
+    virtual ~KeyedSettingsPersistenceInterface() = default;
+
+    /**
+     * @brief Store the provided data under the key, replacing the previous data.
+     * @param key Key of the record.
+     * @param data Data array to store.
+     * @returns True on success, false otherwise.
+     * @examples
+     * std::vector<std::uint8_t> data;
+     * KeyedSettingsPersistenceInterface* iface = getIface(...);
+     * const auto result = iface->store("profile", data);
+     * @examples_end
+     */
+    [[nodiscard]] virtual bool store(const std::string &key, const std::vector<std::uint8_t> &data) = 0;
+
+    /**
+     * @brief Load the data saved under the key.
+     * @param key Key of the record.
+     * @returns Null optional if failed to load data.
+     *          Empty array, if there is no data for the key.
+     *          Non-empty array, if some data was loaded.
+     * @examples
+     * const KeyedSettingsPersistenceInterface* iface = getIface(...);
+     * const auto opt_data = iface->load("profile");
+     * @examples_end
+     */
+    [[nodiscard]] virtual std::optional<std::vector<std::uint8_t>> load(const std::string &key) const = 0;
+
+    /**
+     * @brief Remove the data saved under the key.
+     * @param key Key of the record.
+     * @returns True if data was removed or did not exist, false otherwise.
+     * @examples
+     * KeyedSettingsPersistenceInterface* iface = getIface(...);
+     * const auto result = iface->remove("profile");
+     * @examples_end
+     */
+    [[nodiscard]] virtual bool remove(const std::string &key) = 0;
+
+    /**
+     * @brief Get the keys of all stored records.
+     * @returns Null optional if failed to get the keys, sorted keys otherwise.
+     * @examples
+     * const KeyedSettingsPersistenceInterface* iface = getIface(...);
+     * const auto keys = iface->getKeys();
+     * @examples_end
+     */
+    [[nodiscard]] virtual std::optional<std::vector<std::string>> getKeys() const = 0;
+
+    /**
+     * @brief Clear all of the persistent settings data.
+     * @returns True if data was cleared, false otherwise.
+     * @examples
+     * KeyedSettingsPersistenceInterface* iface = getIface(...);
+     * const auto result = iface->clear();
+     * @examples_end
+     */
+    [[nodiscard]] virtual bool clear() = 0;
+  };
+}  // namespace display_device
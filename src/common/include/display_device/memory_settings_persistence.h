@@ -0,0 +1,48 @@
+/**
+ * @file src/common/include/display_device/memory_settings_persistence.h
+ * @brief Declarations for the MemorySettingsPersistence.
+ */
+#pragma once
+
+// system includes
+#include <mutex>
+
+// local includes
+#include "settings_persistence_interface.h"
+
+namespace display_device {
+  /**
+   * @brief Implementation of the SettingsPersistenceInterface,
+   *        that keeps the persistent settings in the process memory.
+   *
+   * The data does not survive the process restart, therefore the class
+   * is mostly useful for tests, benchmarks or as a fallback.
+   *
+   * @note The class is thread-safe.
+   */
+  class MemorySettingsPersistence: public SettingsPersistenceInterface {
+  public:
+    /**
+     * Keep a copy of the data.
+     * @see SettingsPersistenceInterface::store for more details.
+     */
+    [[nodiscard]] bool store(const std::vector<std::uint8_t> &data) override;
+
+    /**
+     * Get a copy of the data.
+     * @note If nothing was stored, an empty data list will be returned instead of null optional.
+     * @see SettingsPersistenceInterface::load for more details.
+     */
+    [[nodiscard]] std::optional<std::vector<std::uint8_t>> load() const override;
+
+    /**
+     * Discard the data.
+     * @see SettingsPersistenceInterface::clear for more details.
+     */
+    [[nodiscard]] bool clear() override;
+
+  private:
+    std::vector<std::uint8_t> m_data;
+    mutable std::mutex m_mutex {};
+  };
+}  // namespace display_device
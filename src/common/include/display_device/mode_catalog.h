@@ -0,0 +1,110 @@
+/**
+ * @file src/common/include/display_device/mode_catalog.h
+ * @brief Declarations for the ModeCatalog.
+ */
+#pragma once
+
+// system includes
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+// local includes
+#include "types.h"
+
+namespace display_device {
+  /**
+   * @brief A sorted catalog of the display modes supported by a display, for validating the requested modes.
+   *
+   * Modes are stored as packed 64-bit keys (width, height and the refresh rate in millihertz) in a contiguous
+   * array, so that the lookups are binary searches over a few cache lines. Entries with the same resolution
+   * and refresh rate (in millihertz) are deduplicated, keeping the first one.
+   *
+   * A catalog is complete if it lists every mode the display advertises. Only then can a missing
+   * refresh rate be snapped to a listed one, otherwise it might just not have been decoded.
+   *
+   * @note The OS can also offer the modes that are scaled by the GPU or added by the drivers, which
+   *       the display does not advertise. A complete catalog therefore says nothing about them.
+   */
+  class ModeCatalog {
+  public:
+    /**
+     * @brief A supported display mode.
+     */
+    struct Mode {
+      Resolution m_resolution {};
+      Rational m_refresh_rate {};
+
+      /**
+       * @brief Comparator for strict equality.
+       */
+      friend bool operator==(const Mode &lhs, const Mode &rhs);
+    };
+
+    /**
+     * Default constructor for an empty catalog.
+     */
+    ModeCatalog() = default;
+
+    /**
+     * Constructor from arbitrary modes.
+     * @param modes Modes to be cataloged. Modes with invalid refresh rate or with dimensions not
+     *              fitting into 16 bits are skipped.
+     * @param complete Specify whether the modes are all of the modes supported by the display.
+     */
+    explicit ModeCatalog(const std::vector<Mode> &modes, bool complete = false);
+
+    /**
+     * @brief Create a catalog from the progressive timings and video modes of the EDID.
+     *
+     * The detailed timings come first, so that their exact refresh rates are kept over the
+     * nominal rates of the video modes that end up with the same millihertz value.
+     * The catalog is complete if every mode source of the EDID was decoded.
+     *
+     * @param edid Parsed EDID data.
+     * @return Catalog of the modes.
+     * @examples
+     * const auto catalog {ModeCatalog::fromEdid(*EdidData::parse(raw_edid))};
+     * @examples_end
+     */
+    static ModeCatalog fromEdid(const EdidData &edid);
+
+    /**
+     * @brief Check if the catalog is empty.
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Check if the catalog lists every mode supported by the display.
+     */
+    [[nodiscard]] bool isComplete() const;
+
+    /**
+     * @brief Get the number of cataloged modes.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Get the cataloged modes, sorted by width, height and refresh rate.
+     */
+    [[nodiscard]] std::span<const Mode> getModes() const;
+
+    /**
+     * @brief Find the mode with the same resolution and the closest refresh rate.
+     * @param resolution Requested resolution.
+     * @param refresh_rate Requested refresh rate.
+     * @param max_difference_mhz Maximum allowed refresh rate difference in millihertz.
+     * @return Closest cataloged mode, or empty optional if there is no such mode within the allowed difference.
+     * @examples
+     * const auto mode {catalog.findNearest({2560, 1440}, {60, 1}, 900)};  // e.g. 2560x1440@59.951
+     * @examples_end
+     */
+    [[nodiscard]] std::optional<Mode> findNearest(const Resolution &resolution, const Rational &refresh_rate, std::uint32_t max_difference_mhz = std::numeric_limits<std::uint32_t>::max()) const;
+
+  private:
+    std::vector<std::uint64_t> m_keys; /**< Sorted lookup keys, parallel to the modes. */
+    std::vector<Mode> m_modes;
+    bool m_complete {false};
+  };
+}  // namespace display_device
@@ -0,0 +1,227 @@
+/**
+ * @file src/common/include/display_device/rational.h
+ * @brief Declarations for the exact Rational arithmetic.
+ */
+#pragma once
+
+// system includes
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+
+// local includes
+#include "types.h"
+
+/**
+ * @brief Exact arithmetic for the Rational values (refresh rates, scaling).
+ *
+ * Numerators and denominators are 32-bit, so the cross-multiplied values always fit into
+ * 64 bits and the products of those are computed with 128-bit precision. Nothing is
+ * converted to a floating point value, unless explicitly requested.
+ *
+ * A Rational with a zero denominator is considered invalid and never compares equal to anything.
+ */
+namespace display_device::rational {
+  namespace detail {
+    /**
+     * @brief Minimal unsigned 128-bit value for comparing the products of 64-bit values.
+     */
+    struct UInt128 {
+      std::uint64_t m_high {};
+      std::uint64_t m_low {};
+
+      /**
+       * @brief Comparator for the ordering.
+       */
+      friend constexpr auto operator<=>(const UInt128 &lhs, const UInt128 &rhs) = default;
+    };
+
+    /**
+     * @brief Multiply the 64-bit values without overflowing.
+     */
+    constexpr UInt128 multiply(const std::uint64_t lhs, const std::uint64_t rhs) {
+      constexpr std::uint64_t mask {0xFFFFFFFF};
+      const std::uint64_t lo_lo {(lhs & mask) * (rhs & mask)};
+      const std::uint64_t hi_lo {(lhs >> 32) * (rhs & mask)};
+      const std::uint64_t lo_hi {(lhs & mask) * (rhs >> 32)};
+      const std::uint64_t hi_hi {(lhs >> 32) * (rhs >> 32)};
+      const std::uint64_t cross {(lo_lo >> 32) + (hi_lo & mask) + lo_hi};
+      return {hi_hi + (hi_lo >> 32) + (cross >> 32), (cross << 32) | (lo_lo & mask)};
+    }
+
+    /**
+     * @brief Cross-multiply the values (lhs.num * rhs.den and rhs.num * lhs.den).
+     */
+    constexpr std::pair<std::uint64_t, std::uint64_t> crossMultiply(const Rational &lhs, const Rational &rhs) {
+      return {static_cast<std::uint64_t>(lhs.m_numerator) * rhs.m_denominator, static_cast<std::uint64_t>(rhs.m_numerator) * lhs.m_denominator};
+    }
+  }  // namespace detail
+
+  /**
+   * @brief Check if the value has a non-zero denominator.
+   */
+  constexpr bool isValid(const Rational &value) {
+    return value.m_denominator != 0;
+  }
+
+  /**
+   * @brief Reduce the value to the lowest terms.
+   * @param value Value to reduce.
+   * @returns Reduced value, or the same value if it is invalid.
+   * @examples
+   * static_assert(normalize({1200000, 10000}).m_numerator == 120);
+   * @examples_end
+   */
+  constexpr Rational normalize(const Rational &value) {
+    if (!isValid(value)) {
+      return value;
+    }
+
+    const auto divisor {std::gcd(value.m_numerator, value.m_denominator)};
+    return {value.m_numerator / divisor, value.m_denominator / divisor};
+  }
+
+  /**
+   * @brief Compare the values exactly.
+   * @returns Ordering of the values, unordered if any of them is invalid.
+   * @examples
+   * static_assert(compare({60000, 1001}, {5994, 100}) > 0);
+   * @examples_end
+   */
+  constexpr std::partial_ordering compare(const Rational &lhs, const Rational &rhs) {
+    if (!isValid(lhs) || !isValid(rhs)) {
+      return std::partial_ordering::unordered;
+    }
+
+    const auto [lhs_cross, rhs_cross] {detail::crossMultiply(lhs, rhs)};
+    return lhs_cross <=> rhs_cross;
+  }
+
+  /**
+   * @brief Check if the values are equal, regardless of their terms (e.g. 1/2 and 2/4).
+   */
+  constexpr bool isEquivalent(const Rational &lhs, const Rational &rhs) {
+    return compare(lhs, rhs) == std::partial_ordering::equivalent;
+  }
+
+  /**
+   * @brief Check if the absolute difference of the values is within the tolerance.
+   * @param lhs First value.
+   * @param rhs Second value.
+   * @param tolerance Maximum (inclusive) absolute difference.
+   * @returns True if all values are valid and |lhs - rhs| <= tolerance, false otherwise.
+   * @examples
+   * static_assert(isWithinTolerance({60, 1}, {5920, 100}, {9, 10}));
+   * @examples_end
+   */
+  constexpr bool isWithinTolerance(const Rational &lhs, const Rational &rhs, const Rational &tolerance) {
+    if (!isValid(lhs) || !isValid(rhs) || !isValid(tolerance)) {
+      return false;
+    }
+
+    // |a/b - c/d| <= t/u  <=>  |ad - cb| * u <= t * bd
+    const auto [lhs_cross, rhs_cross] {detail::crossMultiply(lhs, rhs)};
+    const std::uint64_t difference {std::max(lhs_cross, rhs_cross) - std::min(lhs_cross, rhs_cross)};
+    return detail::multiply(difference, tolerance.m_denominator) <= detail::multiply(tolerance.m_numerator, static_cast<std::uint64_t>(lhs.m_denominator) * rhs.m_denominator);
+  }
+
+  /**
+   * @brief Check if the relative difference of the values is within the tolerance.
+   * @param lhs First value.
+   * @param rhs Second value.
+   * @param tolerance_ppm Maximum (inclusive) difference in parts per million of the larger value.
+   * @returns True if both values are valid and within the tolerance, false otherwise.
+   * @examples
+   * static_assert(isWithinPpm({60000, 1001}, {5994, 100}, 10));
+   * @examples_end
+   */
+  constexpr bool isWithinPpm(const Rational &lhs, const Rational &rhs, const std::uint32_t tolerance_ppm) {
+    if (!isValid(lhs) || !isValid(rhs)) {
+      return false;
+    }
+
+    // |a/b - c/d| <= max(a/b, c/d) * ppm / 10^6  <=>  |ad - cb| * 10^6 <= max(ad, cb) * ppm
+    const auto [lhs_cross, rhs_cross] {detail::crossMultiply(lhs, rhs)};
+    const std::uint64_t difference {std::max(lhs_cross, rhs_cross) - std::min(lhs_cross, rhs_cross)};
+    return detail::multiply(difference, 1000000) <= detail::multiply(std::max(lhs_cross, rhs_cross), tolerance_ppm);
+  }
+
+  /**
+   * @brief Convert the value to double.
+   * @returns Converted value, or NaN if the value is invalid.
+   */
+  constexpr double toDouble(const Rational &value) {
+    if (!isValid(value)) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    return static_cast<double>(value.m_numerator) / static_cast<double>(value.m_denominator);
+  }
+
+  /**
+   * @brief Find the closest Rational with a bounded denominator to the double value.
+   *
+   * Uses the continued fraction expansion of the value, choosing between the last convergent
+   * and the best semiconvergent once the bound is reached (i.e. the best rational approximation).
+   *
+   * @param value Non-negative value to convert.
+   * @param max_denominator Maximum denominator of the result.
+   * @returns Reduced Rational closest to the value, or empty optional if the value is negative,
+   *          not finite, does not fit into the numerator or the `max_denominator` is 0.
+   * @examples
+   * static_assert(fromDouble(59.94, 1000)->m_numerator == 2997);  // 2997/50
+   * static_assert(fromDouble(59.94, 10)->m_numerator == 599);  // 599/10
+   * @examples_end
+   */
+  constexpr std::optional<Rational> fromDouble(const double value, const unsigned int max_denominator) {
+    constexpr std::uint64_t max_numerator {std::numeric_limits<unsigned int>::max()};
+    if (!(value >= 0.) || value > static_cast<double>(max_numerator) || max_denominator == 0) {
+      return std::nullopt;
+    }
+
+    // Convergents p/q, with the previous ones being p_prev/q_prev
+    std::uint64_t p_prev {0};
+    std::uint64_t q_prev {1};
+    std::uint64_t p {1};
+    std::uint64_t q {0};
+
+    double remainder {value};
+    while (true) {
+      // Past this point the term is just the floating point noise of an exactly representable value
+      if (remainder >= static_cast<double>(std::uint64_t {1} << 62)) {
+        break;
+      }
+
+      const auto term {static_cast<std::uint64_t>(remainder)};
+      const std::uint64_t term_limit {std::min(q == 0 ? term : (max_denominator - q_prev) / q, p == 0 ? term : (max_numerator - p_prev) / p)};
+      if (term > term_limit) {
+        // The bound has been reached - pick the closer one of the best semiconvergent and the last convergent
+        const Rational semiconvergent {static_cast<unsigned int>(p_prev + term_limit * p), static_cast<unsigned int>(q_prev + term_limit * q)};
+        const Rational convergent {static_cast<unsigned int>(p), static_cast<unsigned int>(q)};
+        const auto distance {[value](const Rational &candidate) {
+          const double difference {toDouble(candidate) - value};
+          return difference < 0. ? -difference : difference;
+        }};
+        return normalize(term_limit > 0 && distance(semiconvergent) < distance(convergent) ? semiconvergent : convergent);
+      }
+
+      const std::uint64_t p_next {p_prev + term * p};
+      const std::uint64_t q_next {q_prev + term * q};
+      p_prev = p;
+      q_prev = q;
+      p = p_next;
+      q = q_next;
+
+      const double fraction {remainder - static_cast<double>(term)};
+      if (fraction <= 0.) {
+        break;
+      }
+      remainder = 1. / fraction;
+    }
+
+    return normalize({static_cast<unsigned int>(p), static_cast<unsigned int>(q)});
+  }
+}  // namespace display_device::rational
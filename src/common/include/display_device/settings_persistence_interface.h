@@ -53,5 +53,22 @@ namespace display_device {
      * @examples_end
      */
     [[nodiscard]] virtual bool clear() = 0;
+
+    /**
+     * @brief Check whether the intermediate data of the multi-step operations should also be stored.
+     *
+     * Storing the data after every step allows recovering from a crash in the middle of the operation,
+     * but it multiplies the number of stores. This is only worth it for the implementations
+     * where a store is cheap, therefore it is opt-in.
+     *
+     * @returns True if every step should be stored, false if only the final data should be stored.
+     * @examples
+     * const SettingsPersistenceInterface* iface = getIface(...);
+     * const auto result = iface->prefersIntermediateStores();
+     * @examples_end
+     */
+    [[nodiscard]] virtual bool prefersIntermediateStores() const {
+      return false;
+    }
   };
 }  // namespace display_device
@@ -0,0 +1,102 @@
+/**
+ * @file src/common/include/display_device/shared_memory_settings_persistence.h
+ * @brief Declarations for the SharedMemorySettingsPersistence.
+ */
+#pragma once
+
+#ifndef _WIN32
+  // system includes
+  #include <string>
+
+  // local includes
+  #include "settings_persistence_interface.h"
+
+namespace display_device {
+  /**
+   * @brief Implementation of the SettingsPersistenceInterface,
+   *        that keeps the persistent settings in a POSIX shared memory object.
+   *
+   * The shared memory object contains a single slot protected by a sequence lock,
+   * allowing multiple local processes to read the latest data without any file I/O.
+   * Readers never block the writers and retry if the slot was modified while being read.
+   *
+   * The object is created and sized by the first store. Until then, the object is
+   * treated as empty by the other instances, which never resize it themselves.
+   *
+   * The data survives the process restart, but not the system reboot.
+   *
+   * @warning If a process crashes in the middle of a store, the slot remains locked
+   *          and all subsequent operations fail until the object is unlinked.
+   * @note The class is available on POSIX systems only.
+   */
+  class SharedMemorySettingsPersistence: public SettingsPersistenceInterface {
+  public:
+    /**
+     * Default constructor. Does not perform any operations on the shared memory yet.
+     * @param name Name of the shared memory object in the "/some_name" format. Throws on invalid name.
+     * @param capacity Maximum size of the data. Ignored if the object already exists. Throws on 0.
+     */
+    explicit SharedMemorySettingsPersistence(std::string name, std::size_t capacity = 64 * 1024);
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    SharedMemorySettingsPersistence(const SharedMemorySettingsPersistence &) = delete;
+
+    /**
+     * @brief Deleted copy operator.
+     */
+    SharedMemorySettingsPersistence &operator=(const SharedMemorySettingsPersistence &) = delete;
+
+    /**
+     * @brief Unmaps the shared memory object (the object itself is not removed).
+     */
+    ~SharedMemorySettingsPersistence() override;
+
+    /**
+     * Write the data to the shared memory slot.
+     * @note Fails if the data is larger than the capacity of the slot.
+     * @see SettingsPersistenceInterface::store for more details.
+     */
+    [[nodiscard]] bool store(const std::vector<std::uint8_t> &data) override;
+
+    /**
+     * Read a consistent copy of the data from the shared memory slot.
+     * @note If the object does not exist, an empty data list will be returned instead of null optional.
+     * @see SettingsPersistenceInterface::load for more details.
+     */
+    [[nodiscard]] std::optional<std::vector<std::uint8_t>> load() const override;
+
+    /**
+     * Write empty data to the shared memory slot (the object itself is not removed).
+     * @see SettingsPersistenceInterface::clear for more details.
+     */
+    [[nodiscard]] bool clear() override;
+
+    /**
+     * @brief Remove the shared memory object from the system.
+     * @param name Name of the shared memory object.
+     * @returns True if the object was removed or did not exist, false otherwise.
+     * @note The processes that have the object mapped can continue using it.
+     * @examples
+     * const auto result = SharedMemorySettingsPersistence::unlink("/my_state");
+     * @examples_end
+     */
+    [[nodiscard]] static bool unlink(const std::string &name);
+
+  private:
+    /**
+     * @brief Map the shared memory object if it is not mapped yet.
+     * @param create Specifies whether the object should be created if it does not exist.
+     * @returns True if the object is mapped (or if it does not exist or is not sized yet
+     *          and should not be created), false otherwise.
+     */
+    [[nodiscard]] bool ensureMapped(bool create) const;
+
+    std::string m_name;
+    std::size_t m_capacity;
+    mutable void *m_mapping {nullptr}; /**< Mapped shared memory object (null if not mapped). */
+    mutable std::size_t m_mapping_size {0}; /**< Size of the mapped shared memory object. */
+  };
+}  // namespace display_device
+#endif
@@ -7,10 +7,14 @@
 // system includes
 #include <cstdint>
 #include <optional>
+#include <span>
 #include <string>
 #include <variant>
 #include <vector>
 
+// local includes
+#include "device_id.h"
+
 namespace display_device {
   /**
    * @brief The device's HDR state in the operating system.
@@ -68,17 +72,109 @@ namespace display_device {
    * @brief Parsed EDID data.
    */
   struct EdidData {
+    /**
+     * @brief Detailed timing advertised by the display.
+     */
+    struct Timing {
+      Resolution m_resolution {}; /**< Active resolution (full frame height for interlaced timings). */
+      Rational m_refresh_rate {}; /**< Vertical refresh rate (field rate for interlaced timings). */
+      std::uint32_t m_pixel_clock_khz {}; /**< Pixel clock in kHz. */
+      bool m_interlaced {}; /**< Indicates whether the timing is interlaced. */
+
+      /**
+       * @brief Comparator for strict equality.
+       */
+      friend bool operator==(const Timing &lhs, const Timing &rhs);
+    };
+
+    /**
+     * @brief Display mode advertised without the detailed timing.
+     * @note The refresh rate is the nominal one from the specification, e.g. 60 Hz (or 59.94 Hz for
+     *       the CTA-861 modes that support both) for a mode that is actually refreshed at 59.95 Hz.
+     */
+    struct VideoMode {
+      Resolution m_resolution {}; /**< Active resolution. */
+      Rational m_refresh_rate {}; /**< Nominal vertical refresh rate. */
+
+      /**
+       * @brief Comparator for strict equality.
+       */
+      friend bool operator==(const VideoMode &lhs, const VideoMode &rhs);
+    };
+
+    /**
+     * @brief HDR static metadata from the CTA-861 extension block.
+     */
+    struct HdrStaticMetadata {
+      bool m_traditional_sdr {}; /**< Traditional gamma - SDR luminance range is supported. */
+      bool m_traditional_hdr {}; /**< Traditional gamma - HDR luminance range is supported. */
+      bool m_smpte_st2084 {}; /**< SMPTE ST 2084 (PQ) EOTF is supported. */
+      bool m_hlg {}; /**< Hybrid Log-Gamma EOTF is supported. */
+      std::optional<double> m_max_luminance {}; /**< Desired content max luminance in cd/m^2. */
+      std::optional<double> m_max_frame_average_luminance {}; /**< Desired content max frame-average luminance in cd/m^2. */
+      std::optional<double> m_min_luminance {}; /**< Desired content min luminance in cd/m^2. */
+
+      /**
+       * @brief Comparator for strict equality.
+       */
+      friend bool operator==(const HdrStaticMetadata &lhs, const HdrStaticMetadata &rhs);
+    };
+
+    /**
+     * @brief Range of the vertical refresh rates in Hz.
+     */
+    struct RefreshRateRange {
+      unsigned int m_min {}; /**< Minimum refresh rate. */
+      unsigned int m_max {}; /**< Maximum refresh rate. */
+
+      /**
+       * @brief Comparator for strict equality.
+       */
+      friend bool operator==(const RefreshRateRange &lhs, const RefreshRateRange &rhs);
+    };
+
     std::string m_manufacturer_id {};
     std::string m_product_code {};
     std::uint32_t m_serial_number {};
+    std::string m_monitor_name {}; /**< Name from the display descriptors, empty if not provided. */
+    std::optional<Timing> m_preferred_timing {}; /**< Preferred (native) timing of the display. */
+    std::vector<Timing> m_detailed_timings {}; /**< Unique detailed timings from all of the EDID blocks. */
+    std::optional<HdrStaticMetadata> m_hdr_static_metadata {}; /**< HDR capabilities of the display. */
+    std::optional<RefreshRateRange> m_refresh_rate_range {}; /**< Refresh rates from the display range limits descriptor. */
+    std::optional<RefreshRateRange> m_vrr_range {}; /**< Variable refresh rate range from the HDMI Forum data block. */
+    std::vector<VideoMode> m_video_modes {}; /**< Unique progressive modes from the established and standard timings and the CTA-861 short video descriptors. */
+    bool m_modes_complete {}; /**< Indicates whether every mode advertised by the EDID is listed in the detailed timings or the video modes. */
 
     /**
-     * @brief Parse EDID data.
+     * @brief Parse EDID data, including the descriptors and the extension blocks.
      * @param data Data to parse.
      * @return Parsed data or empty optional if failed to parse it.
      */
     static std::optional<EdidData> parse(const std::vector<std::byte> &data);
 
+    /**
+     * @brief Parse EDID data without requiring the caller to own a vector.
+     * @param data Data to parse.
+     * @return Parsed data or empty optional if failed to parse it.
+     * @examples
+     * const std::array<std::byte, 256> buffer { ... };
+     * const auto edid {EdidData::parse(std::span<const std::byte> {buffer})};
+     * @examples_end
+     */
+    static std::optional<EdidData> parse(std::span<const std::byte> data);
+
+    /**
+     * @brief Parse a batch of EDID data.
+     * @param data Views of the EDID data to parse.
+     * @return Parsed data (or empty optional if failed to parse it) for every input, in the same order.
+     * @note Large batches are parsed in parallel if the library was built with the parallel algorithm support.
+     * @examples
+     * const std::vector<std::span<const std::byte>> views {edid_a, edid_b};
+     * const auto edids {EdidData::parseMany(views)};
+     * @examples_end
+     */
+    static std::vector<std::optional<EdidData>> parseMany(std::span<const std::span<const std::byte>> data);
+
     /**
      * @brief Comparator for strict equality.
      */
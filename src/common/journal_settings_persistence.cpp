@@ -0,0 +1,197 @@
+/**
+ * @file src/common/journal_settings_persistence.cpp
+ * @brief Definitions for the JournalSettingsPersistence.
+ */
+// class header include
+#include "display_device/journal_settings_persistence.h"
+
+// system includes
+#include <stdexcept>
+
+// local includes
+#include "display_device/detail/checksum.h"
+#include "display_device/detail/file_utils.h"
+#include "display_device/detail/little_endian.h"
+#include "display_device/logging.h"
+
+namespace display_device {
+  namespace {
+    /**
+     * @brief Size of the record header: [4 bytes payload size][4 bytes payload CRC-32C], both little-endian.
+     */
+    constexpr std::size_t RECORD_HEADER_SIZE {8};
+
+    /**
+     * @brief Result of the journal scan.
+     */
+    struct JournalScan {
+      std::size_t m_valid_size {}; /**< Size of the journal containing only complete records. */
+      std::size_t m_record_count {}; /**< Number of complete records. */
+      std::span<const std::uint8_t> m_last_payload {}; /**< Payload of the latest complete record. */
+    };
+
+    /**
+     * @brief Encode the data as a journal record.
+     */
+    std::vector<std::uint8_t> makeRecord(const std::vector<std::uint8_t> &data) {
+      std::vector<std::uint8_t> record;
+      record.reserve(RECORD_HEADER_SIZE + data.size());
+      detail::appendLittleEndian(record, static_cast<std::uint32_t>(data.size()));
+      detail::appendLittleEndian(record, detail::crc32c(data));
+      record.insert(std::end(record), std::begin(data), std::end(data));
+      return record;
+    }
+
+    /**
+     * @brief Walk the records until the end of data or the first incomplete/corrupt record.
+     */
+    JournalScan scanJournal(const std::span<const std::uint8_t> data) {
+      JournalScan scan {};
+      while (data.size() - scan.m_valid_size >= RECORD_HEADER_SIZE) {
+        const auto header {data.subspan(scan.m_valid_size, RECORD_HEADER_SIZE)};
+        const std::size_t payload_size {detail::readLittleEndian<std::uint32_t>(header.first(4))};
+        if (data.size() - scan.m_valid_size - RECORD_HEADER_SIZE < payload_size) {
+          break;
+        }
+
+        const auto payload {data.subspan(scan.m_valid_size + RECORD_HEADER_SIZE, payload_size)};
+        if (detail::crc32c(payload) != detail::readLittleEndian<std::uint32_t>(header.last(4))) {
+          break;
+        }
+
+        scan.m_valid_size += RECORD_HEADER_SIZE + payload_size;
+        scan.m_record_count++;
+        scan.m_last_payload = payload;
+      }
+
+      return scan;
+    }
+
+    /**
+     * @brief Open the whole journal file.
+     * @return False on failure, true otherwise (the view is empty if the file does not exist).
+     */
+    bool openJournal(const std::filesystem::path &filepath, detail::FileView &file_view) {
+      if (const auto error_code {file_view.open(filepath)}) {
+        if (error_code == std::errc::no_such_file_or_directory) {
+          return true;
+        }
+
+        DD_LOG(error) << "Failed to load " << filepath << "! Error:\n"
+                      << "[" << error_code.value() << "] " << error_code.message();
+        return false;
+      }
+
+      return true;
+    }
+  }  // namespace
+
+  JournalSettingsPersistence::JournalSettingsPersistence(std::filesystem::path filepath, const std::size_t compaction_threshold):
+      m_filepath {std::move(filepath)},
+      m_compaction_threshold {compaction_threshold} {
+    if (m_filepath.empty()) {
+      throw std::runtime_error {"Empty filename provided for JournalSettingsPersistence!"};
+    }
+
+    if (m_compaction_threshold == 0) {
+      throw std::runtime_error {"Compaction threshold for JournalSettingsPersistence must be larger than 0!"};
+    }
+
+    detail::removeStaleTemporaryFiles(m_filepath);
+  }
+
+  bool JournalSettingsPersistence::store(const std::vector<std::uint8_t> &data) {
+    if (!m_record_count && !recoverJournal()) {
+      // Error already logged
+      return false;
+    }
+
+    const auto record {makeRecord(data)};
+    if (*m_record_count >= m_compaction_threshold) {
+      if (const auto error_code {detail::writeFileAtomically(m_filepath, record)}) {
+        DD_LOG(error) << "Failed to compact " << m_filepath << "! Error:\n"
+                      << "[" << error_code.value() << "] " << error_code.message();
+        m_record_count = std::nullopt;
+        return false;
+      }
+
+      m_record_count = 1;
+      return true;
+    }
+
+    if (const auto error_code {detail::writeAndSync(m_filepath, record, true)}) {
+      DD_LOG(error) << "Failed to append to " << m_filepath << "! Error:\n"
+                    << "[" << error_code.value() << "] " << error_code.message();
+      // The record might have been partially written, therefore the journal must be recovered before the next append.
+      m_record_count = std::nullopt;
+      return false;
+    }
+
+    *m_record_count += 1;
+    return true;
+  }
+
+  std::optional<std::vector<std::uint8_t>> JournalSettingsPersistence::load() const {
+    detail::FileView file_view;
+    if (!openJournal(m_filepath, file_view)) {
+      // Error already logged
+      return std::nullopt;
+    }
+
+    const auto scan {scanJournal(file_view.data())};
+    if (scan.m_valid_size != file_view.data().size()) {
+      if (scan.m_record_count == 0) {
+        DD_LOG(error) << "Journal " << m_filepath << " does not contain any valid records!";
+        return std::nullopt;
+      }
+
+      DD_LOG(warning) << "Journal " << m_filepath << " contains an incomplete record at its end. Using the previous record.";
+    }
+
+    return std::vector<std::uint8_t> {std::begin(scan.m_last_payload), std::end(scan.m_last_payload)};
+  }
+
+  bool JournalSettingsPersistence::clear() {
+    // Return value does not matter since we check the error code in case the file could NOT be removed.
+    std::error_code error_code;
+    std::filesystem::remove(m_filepath, error_code);
+
+    if (error_code) {
+      DD_LOG(error) << "Failed to remove " << m_filepath << "! Error:\n"
+                    << "[" << error_code.value() << "] " << error_code.message();
+      m_record_count = std::nullopt;
+      return false;
+    }
+
+    m_record_count = 0;
+    return true;
+  }
+
+  bool JournalSettingsPersistence::prefersIntermediateStores() const {
+    return true;
+  }
+
+  bool JournalSettingsPersistence::recoverJournal() {
+    detail::FileView file_view;
+    if (!openJournal(m_filepath, file_view)) {
+      // Error already logged
+      return false;
+    }
+
+    const auto scan {scanJournal(file_view.data())};
+    if (scan.m_valid_size != file_view.data().size()) {
+      DD_LOG(warning) << "Dropping incomplete record(s) from the end of " << m_filepath << ".";
+
+      std::error_code error_code;
+      std::filesystem::resize_file(m_filepath, scan.m_valid_size, error_code);
+      if (error_code) {
+        DD_LOG(error) << "Failed to truncate " << m_filepath << "! Error:\n"
+                      << "[" << error_code.value() << "] " << error_code.message();
+        return false;
+      }
+    }
+
+    m_record_count = scan.m_record_count;
+    return true;
+  }
+}  // namespace display_device
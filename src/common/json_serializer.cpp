@@ -15,11 +15,34 @@ namespace display_device {
   DD_JSON_DEFINE_SERIALIZE_ENUM_GCOVR_EXCL_BR_LINE(SingleDisplayConfiguration::DevicePreparation, {{SingleDisplayConfiguration::DevicePreparation::VerifyOnly, "VerifyOnly"}, {SingleDisplayConfiguration::DevicePreparation::EnsureActive, "EnsureActive"}, {SingleDisplayConfiguration::DevicePreparation::EnsurePrimary, "EnsurePrimary"}, {SingleDisplayConfiguration::DevicePreparation::EnsureOnlyDisplay, "EnsureOnlyDisplay"}})
   DD_JSON_DEFINE_SERIALIZE_ENUM_GCOVR_EXCL_BR_LINE(SingleDisplayConfiguration::Profile, {{SingleDisplayConfiguration::Profile::Primary, "Primary"}, {SingleDisplayConfiguration::Profile::Secondary, "Secondary"}})
 
+  // Interned types (serialized as the plain string)
+  void to_json(nlohmann::json &nlohmann_json_j, const DeviceId &nlohmann_json_t) {
+    nlohmann_json_j = nlohmann_json_t.str();
+  }
+
+  void from_json(const nlohmann::json &nlohmann_json_j, DeviceId &nlohmann_json_t) {
+    nlohmann_json_t = DeviceId {nlohmann_json_j.get<std::string_view>()};
+  }
+
   // Structs
   DD_JSON_DEFINE_SERIALIZE_STRUCT(Resolution, width, height)
   DD_JSON_DEFINE_SERIALIZE_STRUCT(Rational, numerator, denominator)
   DD_JSON_DEFINE_SERIALIZE_STRUCT(Point, x, y)
-  DD_JSON_DEFINE_SERIALIZE_STRUCT(EdidData, manufacturer_id, product_code, serial_number)
+  DD_JSON_DEFINE_SERIALIZE_STRUCT(EdidData::Timing, resolution, refresh_rate, pixel_clock_khz, interlaced)
+  DD_JSON_DEFINE_SERIALIZE_STRUCT(EdidData::VideoMode, resolution, refresh_rate)
+  DD_JSON_DEFINE_SERIALIZE_STRUCT(EdidData::HdrStaticMetadata, traditional_sdr, traditional_hdr, smpte_st2084, hlg, max_luminance, max_frame_average_luminance, min_luminance)
+  DD_JSON_DEFINE_SERIALIZE_STRUCT(EdidData::RefreshRateRange, min, max)
+
+  // Only the first 3 fields were serialized by the older versions, the rest are optional to keep parsing their output
+  void to_json(nlohmann::json &nlohmann_json_j, const EdidData &nlohmann_json_t) {
+    NLOHMANN_JSON_EXPAND(NLOHMANN_JSON_PASTE(DD_JSON_TO, manufacturer_id, product_code, serial_number, monitor_name, preferred_timing, detailed_timings, hdr_static_metadata, refresh_rate_range, vrr_range, video_modes, modes_complete))
+  }
+
+  void from_json(const nlohmann::json &nlohmann_json_j, EdidData &nlohmann_json_t) {
+    NLOHMANN_JSON_EXPAND(NLOHMANN_JSON_PASTE(DD_JSON_FROM, manufacturer_id, product_code, serial_number))
+    NLOHMANN_JSON_EXPAND(NLOHMANN_JSON_PASTE(DD_JSON_FROM_IF_PRESENT, monitor_name, preferred_timing, detailed_timings, hdr_static_metadata, refresh_rate_range, vrr_range, video_modes, modes_complete))
+  }
+
   DD_JSON_DEFINE_SERIALIZE_STRUCT(EnumeratedDevice::Info, resolution, resolution_scale, refresh_rate, primary, origin_point, hdr_state)
   DD_JSON_DEFINE_SERIALIZE_STRUCT(EnumeratedDevice, device_id, display_name, friendly_name, edid, info)
   DD_JSON_DEFINE_SERIALIZE_STRUCT(SingleDisplayConfiguration, device_id, profile, device_prep, resolution, refresh_rate, hdr_state)
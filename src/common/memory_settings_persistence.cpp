@@ -0,0 +1,25 @@
+/**
+ * @file src/common/memory_settings_persistence.cpp
+ * @brief Definitions for the MemorySettingsPersistence.
+ */
+// class header include
+#include "display_device/memory_settings_persistence.h"
+
+namespace display_device {
+  bool MemorySettingsPersistence::store(const std::vector<std::uint8_t> &data) {
+    std::lock_guard lock {m_mutex};
+    m_data = data;
+    return true;
+  }
+
+  std::optional<std::vector<std::uint8_t>> MemorySettingsPersistence::load() const {
+    std::lock_guard lock {m_mutex};
+    return m_data;
+  }
+
+  bool MemorySettingsPersistence::clear() {
+    std::lock_guard lock {m_mutex};
+    m_data = {};
+    return true;
+  }
+}  // namespace display_device
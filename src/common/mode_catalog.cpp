@@ -0,0 +1,161 @@
+/**
+ * @file src/common/mode_catalog.cpp
+ * @brief Definitions for the ModeCatalog.
+ */
+// class header include
+#include "display_device/mode_catalog.h"
+
+// system includes
+#include <algorithm>
+
+namespace display_device {
+  namespace {
+    constexpr std::uint64_t MAX_DIMENSION {0xFFFF};
+    constexpr std::uint64_t RESOLUTION_MASK {0xFFFFFFFF00000000};
+
+    /**
+     * @brief Convert the refresh rate to the rounded millihertz value.
+     * @return Millihertz value or empty optional if the rate is invalid or does not fit into 32 bits.
+     */
+    std::optional<std::uint32_t> toMillihertz(const Rational &refresh_rate) {
+      if (refresh_rate.m_denominator == 0) {
+        return std::nullopt;
+      }
+
+      const std::uint64_t millihertz {(static_cast<std::uint64_t>(refresh_rate.m_numerator) * 1000 + refresh_rate.m_denominator / 2) / refresh_rate.m_denominator};
+      if (millihertz > std::numeric_limits<std::uint32_t>::max()) {
+        return std::nullopt;
+      }
+
+      return static_cast<std::uint32_t>(millihertz);
+    }
+
+    /**
+     * @brief Pack the resolution and refresh rate into a key that sorts by width, height and then the refresh rate.
+     * @return Key or empty optional if the values do not fit.
+     */
+    std::optional<std::uint64_t> makeKey(const Resolution &resolution, const Rational &refresh_rate) {
+      if (resolution.m_width > MAX_DIMENSION || resolution.m_height > MAX_DIMENSION) {
+        return std::nullopt;
+      }
+
+      const auto millihertz {toMillihertz(refresh_rate)};
+      if (!millihertz) {
+        return std::nullopt;
+      }
+
+      return (static_cast<std::uint64_t>(resolution.m_width) << 48) | (static_cast<std::uint64_t>(resolution.m_height) << 32) | *millihertz;
+    }
+
+    /**
+     * @brief Get the refresh rate part of the key.
+     */
+    std::uint32_t getMillihertz(const std::uint64_t key) {
+      return static_cast<std::uint32_t>(key);
+    }
+  }  // namespace
+
+  bool operator==(const ModeCatalog::Mode &lhs, const ModeCatalog::Mode &rhs) {
+    return lhs.m_resolution == rhs.m_resolution && lhs.m_refresh_rate == rhs.m_refresh_rate;
+  }
+
+  ModeCatalog::ModeCatalog(const std::vector<Mode> &modes, const bool complete):
+      m_complete {complete} {
+    std::vector<std::pair<std::uint64_t, Mode>> entries;
+    entries.reserve(modes.size());
+    for (const auto &mode : modes) {
+      if (const auto key {makeKey(mode.m_resolution, mode.m_refresh_rate)}; key) {
+        entries.emplace_back(*key, mode);
+      }
+    }
+
+    // Stable sort so that the first of the duplicates is kept
+    std::ranges::stable_sort(entries, std::less {}, [](const auto &entry) {
+      return entry.first;
+    });
+    const auto duplicates {std::ranges::unique(entries, std::equal_to {}, [](const auto &entry) {
+      return entry.first;
+    })};
+    entries.erase(std::begin(duplicates), std::end(duplicates));
+
+    m_keys.reserve(entries.size());
+    m_modes.reserve(entries.size());
+    for (const auto &[key, mode] : entries) {
+      m_keys.push_back(key);
+      m_modes.push_back(mode);
+    }
+  }
+
+  ModeCatalog ModeCatalog::fromEdid(const EdidData &edid) {
+    std::vector<Mode> modes;
+    modes.reserve(edid.m_detailed_timings.size() + edid.m_video_modes.size() + 1);
+
+    const auto add_timing {[&modes](const EdidData::Timing &timing) {
+      // Interlaced modes are not exposed the same way by the OS, so they are not worth validating against
+      if (!timing.m_interlaced) {
+        modes.push_back({timing.m_resolution, timing.m_refresh_rate});
+      }
+    }};
+
+    if (edid.m_preferred_timing) {
+      add_timing(*edid.m_preferred_timing);
+    }
+    std::ranges::for_each(edid.m_detailed_timings, add_timing);
+    for (const auto &video_mode : edid.m_video_modes) {
+      modes.push_back({video_mode.m_resolution, video_mode.m_refresh_rate});
+    }
+
+    return ModeCatalog {modes, edid.m_modes_complete};
+  }
+
+  bool ModeCatalog::empty() const {
+    return m_keys.empty();
+  }
+
+  bool ModeCatalog::isComplete() const {
+    return m_complete;
+  }
+
+  std::size_t ModeCatalog::size() const {
+    return m_keys.size();
+  }
+
+  std::span<const ModeCatalog::Mode> ModeCatalog::getModes() const {
+    return m_modes;
+  }
+
+  std::optional<ModeCatalog::Mode> ModeCatalog::findNearest(const Resolution &resolution, const Rational &refresh_rate, const std::uint32_t max_difference_mhz) const {
+    const auto key {makeKey(resolution, refresh_rate)};
+    if (!key) {
+      return std::nullopt;
+    }
+
+    // The closest refresh rate is either the first one that is not lower or the one right before it,
+    // as long as the resolution part of the key still matches
+    const auto upper_it {std::ranges::lower_bound(m_keys, *key)};
+    const auto requested_mhz {getMillihertz(*key)};
+    std::optional<std::size_t> best_index;
+    std::uint32_t best_difference {std::numeric_limits<std::uint32_t>::max()};
+
+    const auto try_candidate {[&](const auto it, const std::uint32_t difference) {
+      if ((*it & RESOLUTION_MASK) == (*key & RESOLUTION_MASK) && difference <= max_difference_mhz && (!best_index || difference < best_difference)) {
+        best_index = static_cast<std::size_t>(std::distance(std::begin(m_keys), it));
+        best_difference = difference;
+      }
+    }};
+
+    if (upper_it != std::end(m_keys)) {
+      try_candidate(upper_it, getMillihertz(*upper_it) - requested_mhz);
+    }
+    if (upper_it != std::begin(m_keys)) {
+      const auto lower_it {std::prev(upper_it)};
+      try_candidate(lower_it, requested_mhz - getMillihertz(*lower_it));
+    }
+
+    if (!best_index) {
+      return std::nullopt;
+    }
+
+    return m_modes[*best_index];
+  }
+}  // namespace display_device
@@ -0,0 +1,243 @@
+/**
+ * @file src/common/shared_memory_settings_persistence.cpp
+ * @brief Definitions for the SharedMemorySettingsPersistence.
+ */
+#ifndef _WIN32
+  // class header include
+  #include "display_device/shared_memory_settings_persistence.h"
+
+  // system includes
+  #include <atomic>
+  #include <cerrno>
+  #include <cstring>
+  #include <fcntl.h>
+  #include <stdexcept>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <thread>
+  #include <unistd.h>
+
+  // local includes
+  #include "display_device/logging.h"
+
+namespace display_device {
+  namespace {
+    /**
+     * @brief Header of the shared memory slot, followed by the data.
+     * @note The fields are accessed via `std::atomic_ref` only.
+     */
+    struct SlotHeader {
+      std::uint64_t m_sequence; /**< Sequence lock counter (odd while the slot is being written). */
+      std::uint64_t m_size; /**< Size of the data. */
+    };
+
+    static_assert(std::atomic_ref<std::uint64_t>::is_always_lock_free, "Lock-free atomics are required for the inter-process access!");
+
+    /**
+     * @brief Number of attempts to acquire a consistent slot state before giving up.
+     */
+    constexpr int MAX_ATTEMPTS {100000};
+
+    /**
+     * @brief Log the last OS error.
+     */
+    void logLastError(const std::string &action, const std::string &name) {
+      const std::error_code error_code {errno, std::generic_category()};
+      DD_LOG(error) << "Failed to " << action << " shared memory object " << name << "! Error:\n"
+                    << "[" << error_code.value() << "] " << error_code.message();
+    }
+  }  // namespace
+
+  SharedMemorySettingsPersistence::SharedMemorySettingsPersistence(std::string name, const std::size_t capacity):
+      m_name {std::move(name)},
+      m_capacity {capacity} {
+    if (m_name.size() < 2 || m_name.front() != '/' || m_name.find('/', 1) != std::string::npos) {
+      throw std::runtime_error {"Invalid name provided for SharedMemorySettingsPersistence!"};
+    }
+
+    if (m_capacity == 0) {
+      throw std::runtime_error {"Capacity for SharedMemorySettingsPersistence must be larger than 0!"};
+    }
+  }
+
+  SharedMemorySettingsPersistence::~SharedMemorySettingsPersistence() {
+    if (m_mapping) {
+      ::munmap(m_mapping, m_mapping_size);
+    }
+  }
+
+  bool SharedMemorySettingsPersistence::store(const std::vector<std::uint8_t> &data) {
+    if (!ensureMapped(true)) {
+      // Error already logged
+      return false;
+    }
+
+    if (data.size() > m_mapping_size - sizeof(SlotHeader)) {
+      DD_LOG(error) << "Data size " << data.size() << " exceeds the capacity of shared memory object " << m_name << "!";
+      return false;
+    }
+
+    auto *header {static_cast<SlotHeader *>(m_mapping)};
+    std::atomic_ref sequence {header->m_sequence};
+
+    // Acquire the slot by making the sequence odd, which also excludes the other writers
+    for (int attempt = 0;; ++attempt) {
+      if (attempt >= MAX_ATTEMPTS) {
+        DD_LOG(error) << "Timed out while waiting for the writer of shared memory object " << m_name << "!";
+        return false;
+      }
+
+      auto current {sequence.load(std::memory_order_relaxed)};
+      if (current % 2 == 0 && sequence.compare_exchange_weak(current, current + 1, std::memory_order_relaxed)) {
+        std::atomic_thread_fence(std::memory_order_release);
+        std::atomic_ref {header->m_size}.store(data.size(), std::memory_order_relaxed);
+        std::memcpy(static_cast<std::uint8_t *>(m_mapping) + sizeof(SlotHeader), data.data(), data.size());
+        sequence.store(current + 2, std::memory_order_release);
+        return true;
+      }
+
+      std::this_thread::yield();
+    }
+  }
+
+  std::optional<std::vector<std::uint8_t>> SharedMemorySettingsPersistence::load() const {
+    if (!ensureMapped(false)) {
+      // Error already logged
+      return std::nullopt;
+    }
+
+    if (!m_mapping) {
+      return std::vector<std::uint8_t> {};
+    }
+
+    auto *header {static_cast<SlotHeader *>(m_mapping)};
+    std::atomic_ref sequence {header->m_sequence};
+    std::vector<std::uint8_t> data;
+    for (int attempt = 0; attempt < MAX_ATTEMPTS; ++attempt) {
+      const auto sequence_before {sequence.load(std::memory_order_acquire)};
+      if (sequence_before % 2 == 0) {
+        const auto size {std::atomic_ref {header->m_size}.load(std::memory_order_relaxed)};
+        if (size <= m_mapping_size - sizeof(SlotHeader)) {
+          data.resize(size);
+          std::memcpy(data.data(), static_cast<const std::uint8_t *>(m_mapping) + sizeof(SlotHeader), size);
+          std::atomic_thread_fence(std::memory_order_acquire);
+
+          if (sequence.load(std::memory_order_relaxed) == sequence_before) {
+            return data;
+          }
+        }
+      }
+
+      std::this_thread::yield();
+    }
+
+    DD_LOG(error) << "Timed out while waiting for a consistent state of shared memory object " << m_name << "!";
+    return std::nullopt;
+  }
+
+  bool SharedMemorySettingsPersistence::clear() {
+    if (!ensureMapped(false)) {
+      // Error already logged
+      return false;
+    }
+
+    return !m_mapping || store({});
+  }
+
+  bool SharedMemorySettingsPersistence::unlink(const std::string &name) {
+    if (::shm_unlink(name.c_str()) != 0 && errno != ENOENT) {
+      logLastError("unlink", name);
+      return false;
+    }
+
+    return true;
+  }
+
+  bool SharedMemorySettingsPersistence::ensureMapped(const bool create) const {
+    if (m_mapping) {
+      return true;
+    }
+
+    // The object is created exclusively, so that only its creator sizes it and
+    // the concurrent creators with different capacities cannot disagree on the size.
+    bool created {false};
+    int object {-1};
+    if (create) {
+      object = ::shm_open(m_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+      created = object >= 0;
+      if (!created && errno != EEXIST) {
+        logLastError("create", m_name);
+        return false;
+      }
+    }
+
+    if (!created) {
+      object = ::shm_open(m_name.c_str(), O_RDWR, 0);
+      if (object < 0) {
+        if (!create && errno == ENOENT) {
+          return true;
+        }
+
+        logLastError("open", m_name);
+        return false;
+      }
+    }
+
+    std::size_t object_size {0};
+    if (created) {
+      // A newly created object is zero-filled, which corresponds to an unlocked slot with empty data
+      object_size = sizeof(SlotHeader) + m_capacity;
+      if (::ftruncate(object, static_cast<off_t>(object_size)) != 0) {
+        logLastError("resize", m_name);
+
+        // Let the next store create it again instead of leaving behind an object that is never sized
+        static_cast<void>(::shm_unlink(m_name.c_str()));
+        ::close(object);
+        return false;
+      }
+    } else {
+      // The object might have just been created by someone else, who is yet to size it
+      for (int attempt = 0;; ++attempt) {
+        struct stat object_stat {};
+        if (::fstat(object, &object_stat) != 0) {
+          logLastError("query", m_name);
+          ::close(object);
+          return false;
+        }
+
+        object_size = static_cast<std::size_t>(object_stat.st_size);
+        if (object_size > 0 || !create || attempt >= MAX_ATTEMPTS) {
+          break;
+        }
+
+        std::this_thread::yield();
+      }
+
+      if (object_size == 0) {
+        ::close(object);
+        if (!create) {
+          // Nothing has been stored yet
+          return true;
+        }
+
+        DD_LOG(error) << "Timed out while waiting for the creator of shared memory object " << m_name << " to size it!";
+        return false;
+      }
+    }
+
+    bool success {false};
+    if (object_size < sizeof(SlotHeader)) {
+      DD_LOG(error) << "Shared memory object " << m_name << " is too small!";
+    } else if (void *mapping {::mmap(nullptr, object_size, PROT_READ | PROT_WRITE, MAP_SHARED, object, 0)}; mapping != MAP_FAILED) {
+      m_mapping = mapping;
+      m_mapping_size = object_size;
+      success = true;
+    } else {
+      logLastError("map", m_name);
+    }
+
+    ::close(object);
+    return success;
+  }
+}  // namespace display_device
+#endif
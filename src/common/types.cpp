@@ -6,14 +6,23 @@
 #include "display_device/types.h"
 
 // system includes
+#include <algorithm>
 #include <array>
-#include <iomanip>
-#include <sstream>
+#ifdef DD_PARALLEL_ALGORITHMS_AVAILABLE
+  #include <execution>
+#endif
 
 // local includes
+#include "display_device/detail/edid_decoder.h"
 #include "display_device/logging.h"
 
 namespace {
+  /**
+   * @brief Minimum batch size for which the EDID data is parsed in parallel.
+   * @note Below this size the cost of scheduling the work outweighs the parsing itself.
+   */
+  constexpr std::size_t PARALLEL_PARSE_THRESHOLD {256};
+
   bool fuzzyCompare(const double lhs, const double rhs) {
     return std::abs(lhs - rhs) * 1000000000000. <= std::min(std::abs(lhs), std::abs(rhs));
   }
@@ -28,6 +37,13 @@ namespace {
     return false;
   }
 
+  bool fuzzyCompare(const std::optional<double> &lhs, const std::optional<double> &rhs) {
+    if (lhs && rhs) {
+      return fuzzyCompare(*lhs, *rhs);
+    }
+    return lhs == rhs;
+  }
+
   std::byte operator+(const std::byte lhs, const std::byte &rhs) {
     return std::byte {static_cast<std::uint8_t>(static_cast<int>(lhs) + static_cast<int>(rhs))};
   }
@@ -62,33 +78,29 @@ namespace display_device {
   }
 
   std::optional<EdidData> EdidData::parse(const std::vector<std::byte> &data) {
+    return parse(std::span<const std::byte> {data});
+  }
+
+  std::optional<EdidData> EdidData::parse(const std::span<const std::byte> data) {
     if (data.empty()) {
       return std::nullopt;
     }
 
-    if (data.size() < 128) {
+    if (data.size() < detail::EDID_BLOCK_SIZE) {
       DD_LOG(warning) << "EDID data size is too small: " << data.size();
       return std::nullopt;
     }
 
     // ---- Verify fixed header
-    static const std::vector fixed_header {std::byte {0x00}, std::byte {0xFF}, std::byte {0xFF}, std::byte {0xFF}, std::byte {0xFF}, std::byte {0xFF}, std::byte {0xFF}, std::byte {0x00}};
-    if (!std::equal(std::begin(fixed_header), std::end(fixed_header), std::begin(data))) {
+    if (!std::equal(std::begin(detail::EDID_FIXED_HEADER), std::end(detail::EDID_FIXED_HEADER), std::begin(data))) {
       DD_LOG(warning) << "EDID data does not contain fixed header.";
       return std::nullopt;
     }
 
     // ---- Verify checksum
-    {
-      int sum = 0;
-      for (std::size_t i = 0; i < 128; ++i) {
-        sum += static_cast<int>(data[i]);
-      }
-
-      if (sum % 256 != 0) {
-        DD_LOG(warning) << "EDID checksum verification failed.";
-        return std::nullopt;
-      }
+    if (!detail::isEdidBlockChecksumValid(data.first(detail::EDID_BLOCK_SIZE))) {
+      DD_LOG(warning) << "EDID checksum verification failed.";
+      return std::nullopt;
     }
 
     EdidData edid {};
@@ -121,9 +133,8 @@ namespace display_device {
       prod_num |= static_cast<int>(data[10]) << 0;
       prod_num |= static_cast<int>(data[11]) << 8;
 
-      std::stringstream stream;
-      stream << std::setfill('0') << std::setw(4) << std::hex << std::uppercase << prod_num;
-      edid.m_product_code = stream.str();
+      const auto hex_digits {detail::formatHex16(prod_num)};
+      edid.m_product_code = {std::begin(hex_digits), std::end(hex_digits)};
     }
 
     // ---- Serial number
@@ -137,11 +148,56 @@ namespace display_device {
       edid.m_serial_number = serial_num;
     }
 
+    // ---- Descriptors and extension blocks
+    detail::decodeEdidBlocks(data, edid);
+
     return edid;
   }
 
+  std::vector<std::optional<EdidData>> EdidData::parseMany(const std::span<const std::span<const std::byte>> data) {
+#ifdef DD_PARALLEL_ALGORITHMS_AVAILABLE
+    if (data.size() >= PARALLEL_PARSE_THRESHOLD) {
+      std::vector<std::optional<EdidData>> edids(data.size());
+      std::transform(std::execution::par, std::begin(data), std::end(data), std::begin(edids), [](const std::span<const std::byte> item) {
+        return parse(item);
+      });
+      return edids;
+    }
+#endif
+
+    std::vector<std::optional<EdidData>> edids;
+    edids.reserve(data.size());
+    for (const auto item : data) {
+      edids.push_back(parse(item));
+    }
+    return edids;
+  }
+
+  bool operator==(const EdidData::Timing &lhs, const EdidData::Timing &rhs) {
+    return lhs.m_resolution == rhs.m_resolution && lhs.m_refresh_rate == rhs.m_refresh_rate && lhs.m_pixel_clock_khz == rhs.m_pixel_clock_khz && lhs.m_interlaced == rhs.m_interlaced;
+  }
+
+  bool operator==(const EdidData::VideoMode &lhs, const EdidData::VideoMode &rhs) {
+    return lhs.m_resolution == rhs.m_resolution && lhs.m_refresh_rate == rhs.m_refresh_rate;
+  }
+
+  bool operator==(const EdidData::HdrStaticMetadata &lhs, const EdidData::HdrStaticMetadata &rhs) {
+    return lhs.m_traditional_sdr == rhs.m_traditional_sdr && lhs.m_traditional_hdr == rhs.m_traditional_hdr &&
+           lhs.m_smpte_st2084 == rhs.m_smpte_st2084 && lhs.m_hlg == rhs.m_hlg &&
+           fuzzyCompare(lhs.m_max_luminance, rhs.m_max_luminance) &&
+           fuzzyCompare(lhs.m_max_frame_average_luminance, rhs.m_max_frame_average_luminance) &&
+           fuzzyCompare(lhs.m_min_luminance, rhs.m_min_luminance);
+  }
+
+  bool operator==(const EdidData::RefreshRateRange &lhs, const EdidData::RefreshRateRange &rhs) {
+    return lhs.m_min == rhs.m_min && lhs.m_max == rhs.m_max;
+  }
+
   bool operator==(const EdidData &lhs, const EdidData &rhs) {
-    return lhs.m_manufacturer_id == rhs.m_manufacturer_id && lhs.m_product_code == rhs.m_product_code && lhs.m_serial_number == rhs.m_serial_number;
+    return lhs.m_manufacturer_id == rhs.m_manufacturer_id && lhs.m_product_code == rhs.m_product_code && lhs.m_serial_number == rhs.m_serial_number &&
+           lhs.m_monitor_name == rhs.m_monitor_name && lhs.m_preferred_timing == rhs.m_preferred_timing && lhs.m_detailed_timings == rhs.m_detailed_timings &&
+           lhs.m_hdr_static_metadata == rhs.m_hdr_static_metadata && lhs.m_refresh_rate_range == rhs.m_refresh_rate_range && lhs.m_vrr_range == rhs.m_vrr_range &&
+           lhs.m_video_modes == rhs.m_video_modes && lhs.m_modes_complete == rhs.m_modes_complete;
   }
 
   bool operator==(const EnumeratedDevice::Info &lhs, const EnumeratedDevice::Info &rhs) {
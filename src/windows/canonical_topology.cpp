@@ -0,0 +1,75 @@
+/**
+ * @file src/windows/canonical_topology.cpp
+ * @brief Definitions for the CanonicalTopology.
+ */
+// class header include
+#include "display_device/windows/canonical_topology.h"
+
+// system includes
+#include <algorithm>
+
+namespace display_device {
+  namespace {
+    /**
+     * @brief Order the device ids by their handles, which is cheap and enough for the canonical form.
+     */
+    bool isHandleLess(const DeviceId &lhs, const DeviceId &rhs) {
+      return lhs.getHandle() < rhs.getHandle();
+    }
+
+    /**
+     * @brief Order the groups by their size first and then by the device id handles.
+     */
+    bool isGroupLess(const CanonicalTopology::Group &lhs, const CanonicalTopology::Group &rhs) {
+      if (lhs.m_size != rhs.m_size) {
+        return lhs.m_size < rhs.m_size;
+      }
+      return std::ranges::lexicographical_compare(lhs.getDeviceIds(), rhs.getDeviceIds(), isHandleLess);
+    }
+
+    /**
+     * @brief Mix the value into the hash.
+     */
+    std::size_t combineHash(const std::size_t hash, const std::size_t value) {
+      return hash ^ (value + 0x9E3779B97F4A7C15 + (hash << 6) + (hash >> 2));
+    }
+  }  // namespace
+
+  std::span<const DeviceId> CanonicalTopology::Group::getDeviceIds() const {
+    return {m_device_ids.data(), m_size};
+  }
+
+  std::optional<CanonicalTopology> CanonicalTopology::fromTopology(const ActiveTopology &topology) {
+    CanonicalTopology canonical;
+    canonical.m_groups.reserve(topology.size());
+    for (const auto &device_ids : topology) {
+      if (device_ids.size() > MAX_GROUP_SIZE) {
+        return std::nullopt;
+      }
+
+      Group group {};
+      std::ranges::copy(device_ids, std::begin(group.m_device_ids));
+      group.m_size = static_cast<std::uint8_t>(device_ids.size());
+      std::sort(std::begin(group.m_device_ids), std::begin(group.m_device_ids) + group.m_size, isHandleLess);
+      canonical.m_groups.push_back(group);
+    }
+    std::ranges::sort(canonical.m_groups, isGroupLess);
+    return canonical;
+  }
+
+  std::span<const CanonicalTopology::Group> CanonicalTopology::getGroups() const {
+    return m_groups;
+  }
+
+  std::size_t CanonicalTopology::getHash() const {
+    std::size_t hash {m_groups.size()};
+    for (const auto &group : m_groups) {
+      hash = combineHash(hash, group.m_size);
+      for (const auto &device_id : group.getDeviceIds()) {
+        hash = combineHash(hash, std::hash<DeviceId> {}(device_id));
+      }
+    }
+
+    return hash;
+  }
+}  // namespace display_device
@@ -0,0 +1,99 @@
+/**
+ * @file src/windows/include/display_device/windows/canonical_topology.h
+ * @brief Declarations for the CanonicalTopology.
+ */
+#pragma once
+
+// system includes
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+// local includes
+#include "types.h"
+
+namespace display_device {
+  /**
+   * @brief An order-independent representation of the ActiveTopology.
+   *
+   * The device ids within the groups and the groups themselves are sorted on construction,
+   * so that comparing two canonical topologies only needs to compare the fixed-size groups,
+   * without copying or sorting anything. The groups store the device ids inline.
+   *
+   * @note The sort order is based on the device id handles and is therefore only stable
+   *       within the same process. It is not meant to be persisted.
+   */
+  class CanonicalTopology {
+  public:
+    /**
+     * @brief Maximum number of devices in a group (a Windows' limitation).
+     */
+    static constexpr std::size_t MAX_GROUP_SIZE {2};
+
+    /**
+     * @brief A group of duplicated devices with inline storage.
+     */
+    struct Group {
+      std::array<DeviceId, MAX_GROUP_SIZE> m_device_ids {}; /**< Sorted device ids, unused slots are empty. */
+      std::uint8_t m_size {}; /**< Number of used slots. */
+
+      /**
+       * @brief Get the device ids of the group.
+       */
+      [[nodiscard]] std::span<const DeviceId> getDeviceIds() const;
+
+      /**
+       * @brief Comparator for strict equality.
+       */
+      friend bool operator==(const Group &lhs, const Group &rhs) = default;
+    };
+
+    /**
+     * Default constructor for an empty topology.
+     */
+    CanonicalTopology() = default;
+
+    /**
+     * @brief Make a canonical topology.
+     * @param topology Topology to be canonicalized.
+     * @returns Canonical topology or empty optional if any of the groups exceed MAX_GROUP_SIZE.
+     * @examples
+     * const auto lhs {CanonicalTopology::fromTopology({{"DeviceId1"_id, "DeviceId2"_id}, {"DeviceId3"_id}})};
+     * const auto rhs {CanonicalTopology::fromTopology({{"DeviceId3"_id}, {"DeviceId2"_id, "DeviceId1"_id}})};
+     * const bool is_the_same {lhs == rhs};  // true
+     * @examples_end
+     */
+    [[nodiscard]] static std::optional<CanonicalTopology> fromTopology(const ActiveTopology &topology);
+
+    /**
+     * @brief Get the sorted groups.
+     */
+    [[nodiscard]] std::span<const Group> getGroups() const;
+
+    /**
+     * @brief Compute the hash of the sorted groups.
+     * @note The hash is not cached, since the sameness checks only need the comparison.
+     */
+    [[nodiscard]] std::size_t getHash() const;
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const CanonicalTopology &lhs, const CanonicalTopology &rhs) = default;
+
+  private:
+    std::vector<Group> m_groups;
+  };
+}  // namespace display_device
+
+/**
+ * @brief Hash specialization for using the canonical topology as a key.
+ */
+template<>
+struct std::hash<display_device::CanonicalTopology> {
+  std::size_t operator()(const display_device::CanonicalTopology &topology) const noexcept {
+    return topology.getHash();
+  }
+};
@@ -16,5 +16,6 @@ namespace display_device {
   DD_JSON_DECLARE_SERIALIZE_TYPE(SingleDisplayConfigState)
   DD_JSON_DECLARE_SERIALIZE_TYPE(WinWorkarounds)
   DD_JSON_DECLARE_SERIALIZE_TYPE(DisplaySettingsSnapshot)
+  DD_JSON_DECLARE_SERIALIZE_TYPE(DisplaySettingsSnapshotDiff)
 }  // namespace display_device
 #endif
@@ -16,4 +16,8 @@ namespace display_device {
   DD_JSON_DECLARE_CONVERTER(SingleDisplayConfigState)
   DD_JSON_DECLARE_CONVERTER(WinWorkarounds)
   DD_JSON_DECLARE_CONVERTER(DisplaySettingsSnapshot)
+  DD_JSON_DECLARE_CONVERTER(DisplaySettingsSnapshotDiff)
+
+  // Versioned converters for the persisted data
+  DD_JSON_DECLARE_VERSIONED_CONVERTER(SingleDisplayConfigState)
 }  // namespace display_device
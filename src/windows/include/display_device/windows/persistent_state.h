@@ -21,8 +21,16 @@ namespace display_device {
      * Default constructor for the class.
      * @param settings_persistence_api [Optional] A pointer to the Settings Persistence interface.
      * @param throw_on_load_error Specify whether to throw exception in constructor in case settings fail to load.
+     * @param json_indent Indentation of the stored JSON. Use std::nullopt for the compact output.
+     * @note Settings persisted by an older version are migrated while loading. The file itself is
+     *       only rewritten (in the latest version) once the state changes.
+     * @note The migrations are applied to the parsed JSON document as a whole rather than while
+     *       streaming it, since the persisted state is small and the converters work on documents.
+     * @warning Once rewritten, the state is wrapped in the versioned envelope, which the builds
+     *          predating it cannot parse. Such a build discards the state as invalid and is
+     *          no longer able to revert the settings it describes.
      */
-    explicit PersistentState(std::shared_ptr<SettingsPersistenceInterface> settings_persistence_api, bool throw_on_load_error = false);
+    explicit PersistentState(std::shared_ptr<SettingsPersistenceInterface> settings_persistence_api, bool throw_on_load_error = false, const std::optional<unsigned int> &json_indent = 2u);
 
     /**
      * @brief Store the new state via the interface and cache it.
@@ -37,10 +45,18 @@ namespace display_device {
      */
     [[nodiscard]] const std::optional<SingleDisplayConfigState> &getState() const;
 
+    /**
+     * @brief Check whether the intermediate states of a multi-step operation should also be persisted.
+     * @return True if the Settings Persistence interface prefers the intermediate stores, false otherwise.
+     * @see SettingsPersistenceInterface::prefersIntermediateStores
+     */
+    [[nodiscard]] bool prefersIntermediateStates() const;
+
   protected:
     std::shared_ptr<SettingsPersistenceInterface> m_settings_persistence_api;
 
   private:
     std::optional<SingleDisplayConfigState> m_cached_state;
+    std::optional<unsigned int> m_json_indent;
   };
 }  // namespace display_device
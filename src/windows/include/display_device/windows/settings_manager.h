@@ -68,9 +68,9 @@ namespace display_device {
      * @param topology_before_changes The current topology before any changes.
      * @param release_context Specifies whether the audio context should be released at the very end IF everything else has succeeded.
      * @param system_settings_touched Inticates whether a "write" operation could have been performed on the OS.
-     * @return A tuple of (new_state that is to be updated/persisted, device_to_configure, additional_devices_to_configure).
+     * @return A tuple of (new_state that is to be updated/persisted, device_to_configure, additional_devices_to_configure, mode_catalogs).
      */
-    [[nodiscard]] std::optional<std::tuple<SingleDisplayConfigState, std::string, std::set<std::string>>> prepareTopology(const SingleDisplayConfiguration &config, const ActiveTopology &topology_before_changes, bool &release_context, bool &system_settings_touched);
+    [[nodiscard]] std::optional<std::tuple<SingleDisplayConfigState, std::string, std::set<std::string>, DeviceModeCatalogMap>> prepareTopology(const SingleDisplayConfiguration &config, const ActiveTopology &topology_before_changes, bool &release_context, bool &system_settings_touched);
 
     /**
      * @brief Changes or restores the primary device based on the cached state, new state and configuration.
@@ -88,12 +88,13 @@ namespace display_device {
      * @param config Configuration to be used for preparing display modes.
      * @param device_to_configure The main device to be used for preparation.
      * @param additional_devices_to_configure Additional devices that should be configured.
+     * @param mode_catalogs Supported modes of the devices enumerated while preparing the topology.
      * @param guard_fn Reference to the guard function which will be set to restore original state (if needed) in case something else fails down the line.
      * @param new_state Reference to the new state which is to be updated accordingly.
      * @param system_settings_touched Inticates whether a "write" operation could have been performed on the OS.
      * @return True if no errors have occured, false otherwise.
      */
-    [[nodiscard]] bool prepareDisplayModes(const SingleDisplayConfiguration &config, const std::string &device_to_configure, const std::set<std::string> &additional_devices_to_configure, DdGuardFn &guard_fn, SingleDisplayConfigState &new_state, bool &system_settings_touched);
+    [[nodiscard]] bool prepareDisplayModes(const SingleDisplayConfiguration &config, const std::string &device_to_configure, const std::set<std::string> &additional_devices_to_configure, const DeviceModeCatalogMap &mode_catalogs, DdGuardFn &guard_fn, SingleDisplayConfigState &new_state, bool &system_settings_touched);
 
     /**
      * @brief Changes or restores the HDR states based on the cached state, new state and configuration.
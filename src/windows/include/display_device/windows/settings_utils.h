@@ -21,11 +21,11 @@ namespace display_device::win_utils {
    * @param topology Topology to be "flattened".
    * @return Device ids found in the topology.
    * @examples
-   * const ActiveTopology topology { { "DeviceId1", "DeviceId2" }, { "DeviceId3" } };
+   * const ActiveTopology topology { { "DeviceId1"_id, "DeviceId2"_id }, { "DeviceId3"_id } };
    * const auto device_ids { flattenTopology(topology) };
    * @examples_end
    */
-  std::set<std::string> flattenTopology(const ActiveTopology &topology);
+  DeviceIdSet flattenTopology(const ActiveTopology &topology);
 
   /**
    * @brief Create extended topology from all the available devices.
@@ -45,7 +45,7 @@ namespace display_device::win_utils {
    * @return Id of a primary device or an empty string if not found or an error has occured.
    * @examples
    * const WinDisplayDeviceInterface* iface = getIface(...);
-   * const ActiveTopology topology { { "DeviceId1", "DeviceId2" }, { "DeviceId3" } };
+   * const ActiveTopology topology { { "DeviceId1"_id, "DeviceId2"_id }, { "DeviceId3"_id } };
    * const auto primary_device_id { getPrimaryDevice(*iface, topology) };
    * @examples_end
    */
@@ -58,8 +58,8 @@ namespace display_device::win_utils {
    * @param devices Currently available device list.
    * @return New initial state that should be used.
    * @examples
-   * const SingleDisplayConfigState::Initial prev_state { { { "DeviceId1", "DeviceId2" }, { "DeviceId3" } } };
-   * const ActiveTopology topology_before_changes { { "DeviceId3" } };
+   * const SingleDisplayConfigState::Initial prev_state { { { "DeviceId1"_id, "DeviceId2"_id }, { "DeviceId3"_id } } };
+   * const ActiveTopology topology_before_changes { { "DeviceId3"_id } };
    * const EnumeratedDeviceList devices { ... };
    *
    * const auto new_initial_state { computeInitialState(prev_state, topology_before_changes, devices) };
@@ -107,6 +107,35 @@ namespace display_device::win_utils {
    */
   DeviceDisplayModeMap computeNewDisplayModes(const std::optional<Resolution> &resolution, const std::optional<FloatingPoint> &refresh_rate, bool configuring_primary_devices, const std::string &device_to_configure, const std::set<std::string> &additional_devices_to_configure, const DeviceDisplayModeMap &original_modes);
 
+  /**
+   * @brief Snap the refresh rates of the changed modes to the modes listed in the complete mode catalogs.
+   *
+   * Only the devices with a complete catalog are checked, since a rate missing from an incomplete
+   * catalog could still be supported. A refresh rate that is listed exactly is kept as is, otherwise
+   * it is snapped to the closest supported one if it is within the fuzzy comparison tolerance.
+   * The resolutions are never rejected, as the OS can still accept the modes that are not in the EDID
+   * (e.g. GPU-scaled or driver-added modes).
+   *
+   * @param new_modes Display modes that were requested.
+   * @param original_modes Display modes that were used as a base (these are not checked).
+   * @param mode_catalogs Supported modes of the devices.
+   * @return New display modes with the snapped refresh rates.
+   * @examples
+   * const auto snapped_modes {snapDisplayModes(new_modes, original_modes, computeModeCatalogs(devices))};
+   * @examples_end
+   */
+  DeviceDisplayModeMap snapDisplayModes(const DeviceDisplayModeMap &new_modes, const DeviceDisplayModeMap &original_modes, const DeviceModeCatalogMap &mode_catalogs);
+
+  /**
+   * @brief Build the mode catalogs from the EDID data of the enumerated devices.
+   * @param devices Enumerated devices.
+   * @return Catalogs for the devices that have non-empty catalogs.
+   * @examples
+   * const auto catalogs {computeModeCatalogs(iface->enumAvailableDevices())};
+   * @examples_end
+   */
+  DeviceModeCatalogMap computeModeCatalogs(const EnumeratedDeviceList &devices);
+
   /**
    * @brief Compute new HDR states from arbitrary data.
    * @param hdr_state Specify state that should be used to override the original states.
@@ -118,6 +147,35 @@ namespace display_device::win_utils {
    */
   HdrStateMap computeNewHdrStates(const std::optional<HdrState> &hdr_state, bool configuring_primary_devices, const std::string &device_to_configure, const std::set<std::string> &additional_devices_to_configure, const HdrStateMap &original_states);
 
+  /**
+   * @brief Compute the structural difference between two snapshots.
+   * @param from Snapshot to be used as a base.
+   * @param to Snapshot to be compared against the base.
+   * @return Diff that turns `from` into `to` once applied.
+   * @examples
+   * const DisplaySettingsSnapshot old_snapshot { ... };
+   * const DisplaySettingsSnapshot new_snapshot { ... };
+   *
+   * const auto diff { computeSnapshotDiff(old_snapshot, new_snapshot) };
+   * const auto json_patch { toJson(diff) };
+   * @examples_end
+   */
+  DisplaySettingsSnapshotDiff computeSnapshotDiff(const DisplaySettingsSnapshot &from, const DisplaySettingsSnapshot &to);
+
+  /**
+   * @brief Apply the structural difference to the snapshot.
+   * @param snapshot Snapshot to be used as a base.
+   * @param diff Diff to be applied.
+   * @return New snapshot with the diff applied.
+   * @examples
+   * const DisplaySettingsSnapshot old_snapshot { ... };
+   * const DisplaySettingsSnapshotDiff diff { ... };
+   *
+   * const auto new_snapshot { applySnapshotDiff(old_snapshot, diff) };
+   * @examples_end
+   */
+  DisplaySettingsSnapshot applySnapshotDiff(const DisplaySettingsSnapshot &snapshot, const DisplaySettingsSnapshotDiff &diff);
+
   /**
    * @brief Toggle enabled HDR states off and on again if quick succession.
    *
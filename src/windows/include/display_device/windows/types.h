@@ -13,10 +13,12 @@
 // system includes
 #include <chrono>
 #include <functional>
-#include <map>
 #include <set>
 
 // local includes
+#include "display_device/display_config.h"
+#include "display_device/flat_map.h"
+#include "display_device/mode_catalog.h"
 #include "display_device/types.h"
 
 namespace display_device {
@@ -36,55 +38,6 @@ namespace display_device {
     std::vector<DISPLAYCONFIG_MODE_INFO> m_modes {}; /**< Display modes for ACTIVE displays. */
   };
 
-  /**
-   * @brief Specifies additional constraints for the validated device.
-   */
-  enum class ValidatedPathType {
-    Active, /**< The device path must be active. */
-    Any /**< The device path can be active or inactive. */
-  };
-
-  /**
-   * @brief Contains the device path and the id for a VALID device.
-   * @see win_utils::getDeviceInfoForValidPath for what is considered a valid device.
-   * @see WinApiLayerInterface::getDeviceId for how we make the device id.
-   */
-  struct ValidatedDeviceInfo {
-    std::string m_device_path {}; /**< Unique device path string. */
-    std::string m_device_id {}; /**< A device id (made up by us) that identifies the device. */
-  };
-
-  /**
-   * @brief Contains information about sources with identical adapter ids from matching paths.
-   */
-  struct PathSourceIndexData {
-    std::map<UINT32, std::size_t> m_source_id_to_path_index {}; /**< Maps source ids to its index in the path list. */
-    LUID m_adapter_id {}; /**< Adapter id shared by all source ids. */
-    std::optional<UINT32> m_active_source {}; /**< Currently active source id. */
-  };
-
-  /**
-   * @brief Ordered map of [DEVICE_ID -> PathSourceIndexData].
-   * @see PathSourceIndexData
-   */
-  using PathSourceIndexDataMap = std::map<std::string, PathSourceIndexData>;
-
-  /**
-   * @brief A LIST[LIST[DEVICE_ID]] structure which represents an active topology.
-   *
-   * Single display:
-   *     [[DISPLAY_1]]
-   * 2 extended displays:
-   *     [[DISPLAY_1], [DISPLAY_2]]
-   * 2 duplicated displays:
-   *     [[DISPLAY_1, DISPLAY_2]]
-   * Mixed displays:
-   *     [[EXTENDED_DISPLAY_1], [DUPLICATED_DISPLAY_1, DUPLICATED_DISPLAY_2], [EXTENDED_DISPLAY_2]]
-   *
-   * @note On Windows the order does not matter of both device ids or the inner lists.
-   */
-  using ActiveTopology = std::vector<std::vector<std::string>>;
-
   /**
    * @brief Display's mode (resolution + refresh rate).
    */
@@ -100,13 +53,20 @@ namespace display_device {
 
   /**
    * @brief Ordered map of [DEVICE_ID -> DisplayMode].
+   * @note A flat map, since it only ever holds a handful of displays and is copied and compared on every apply/revert.
+   */
+  using DeviceDisplayModeMap = FlatMap<DeviceId, DisplayMode>;
+
+  /**
+   * @brief Ordered map of [DEVICE_ID -> ModeCatalog].
    */
-  using DeviceDisplayModeMap = std::map<std::string, DisplayMode>;
+  using DeviceModeCatalogMap = FlatMap<DeviceId, ModeCatalog>;
 
   /**
    * @brief Ordered map of [DEVICE_ID -> std::optional<HdrState>].
+   * @note A flat map for the same reasons as DeviceDisplayModeMap.
    */
-  using HdrStateMap = std::map<std::string, std::optional<HdrState>>;
+  using HdrStateMap = FlatMap<DeviceId, std::optional<HdrState>>;
 
   /**
    * @brief Arbitrary data for making and undoing changes.
@@ -140,10 +100,10 @@ namespace display_device {
        * @return True if DisplayMode, HDR or primary device has been changed, false otherwise.
        * @examples
        * SingleDisplayConfigState state;
-       * const no_modifications = state.hasModifications();
+       * const bool no_modifications = state.m_modified.hasModifications();
        *
-       * state.modified.original_primary_device = "DeviceId2";
-       * const has_modifications = state.hasModifications();
+       * state.m_modified.m_original_primary_device = "DeviceId2";
+       * const bool has_modifications = state.m_modified.hasModifications();
        * @examples_end
        */
       [[nodiscard]] bool hasModifications() const;
@@ -193,4 +153,34 @@ namespace display_device {
 
     friend bool operator==(const DisplaySettingsSnapshot &lhs, const DisplaySettingsSnapshot &rhs);
   };
+
+  /**
+   * @brief Structural difference between two DisplaySettingsSnapshot objects.
+   *
+   * Only the changed parts are stored, therefore the size of the diff scales with
+   * the amount of changes. The diff is serialized as a RFC 6902 (JSON Patch) style
+   * operation list that can be applied to the JSON of the base snapshot.
+   *
+   * @see win_utils::computeSnapshotDiff for how the diff is computed.
+   * @see win_utils::applySnapshotDiff for how the diff is applied.
+   */
+  struct DisplaySettingsSnapshotDiff {
+    std::optional<ActiveTopology> m_topology {}; /**< New topology (if it has changed). */
+    DeviceDisplayModeMap m_modes {}; /**< Added or changed display modes. */
+    std::set<std::string> m_removed_modes {}; /**< Devices that no longer have a display mode. */
+    HdrStateMap m_hdr_states {}; /**< Added or changed HDR states. */
+    std::set<std::string> m_removed_hdr_states {}; /**< Devices that no longer have a HDR state. */
+    std::optional<std::string> m_primary_device {}; /**< New primary device (if it has changed). */
+
+    /**
+     * @brief Check if the diff contains any changes.
+     * @return True if there are no changes, false otherwise.
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const DisplaySettingsSnapshotDiff &lhs, const DisplaySettingsSnapshotDiff &rhs);
+  };
 }  // namespace display_device
@@ -8,6 +8,7 @@
 #include <memory>
 
 // local includes
+#include "display_device/edid_cache.h"
 #include "win_api_layer_interface.h"
 #include "win_display_device_interface.h"
 
@@ -53,7 +54,7 @@ namespace display_device {
     [[nodiscard]] bool setTopology(const ActiveTopology &new_topology) override;
 
     /** For details @see WinDisplayDeviceInterface::getCurrentDisplayModes */
-    [[nodiscard]] DeviceDisplayModeMap getCurrentDisplayModes(const std::set<std::string> &device_ids) const override;
+    [[nodiscard]] DeviceDisplayModeMap getCurrentDisplayModes(const DeviceIdSet &device_ids) const override;
 
     /** For details @see WinDisplayDeviceInterface::setDisplayModes */
     [[nodiscard]] bool setDisplayModes(const DeviceDisplayModeMap &modes) override;
@@ -68,13 +69,14 @@ namespace display_device {
     [[nodiscard]] bool setAsPrimary(const std::string &device_id) override;
 
     /** For details @see WinDisplayDeviceInterface::getCurrentHdrStates */
-    [[nodiscard]] HdrStateMap getCurrentHdrStates(const std::set<std::string> &device_ids) const override;
+    [[nodiscard]] HdrStateMap getCurrentHdrStates(const DeviceIdSet &device_ids) const override;
 
     /** For details @see WinDisplayDeviceInterface::setHdrStates */
     [[nodiscard]] bool setHdrStates(const HdrStateMap &states) override;
 
   private:
     std::shared_ptr<WinApiLayerInterface> m_w_api;
+    mutable EdidCache m_edid_cache; /**< Unchanged monitors are not re-parsed on every enumeration. */
 
     // Global preference for persistence of display changes.
     static inline bool s_persist_to_database = true;
@@ -117,11 +117,11 @@ namespace display_device {
      *          Empty map can also be returned if an error has occurred.
      * @examples
      * const WinDisplayDeviceInterface* iface = getIface(...);
-     * const std::set<std::string> device_ids { "DEVICE_ID_1", "DEVICE_ID_2" };
+     * const DeviceIdSet device_ids { "DEVICE_ID_1"_id, "DEVICE_ID_2"_id };
      * const auto current_modes = iface->getCurrentDisplayModes(device_ids);
      * @examples_end
      */
-    [[nodiscard]] virtual DeviceDisplayModeMap getCurrentDisplayModes(const std::set<std::string> &device_ids) const = 0;
+    [[nodiscard]] virtual DeviceDisplayModeMap getCurrentDisplayModes(const DeviceIdSet &device_ids) const = 0;
 
     /**
      * @brief Set new display modes for the devices.
@@ -131,8 +131,8 @@ namespace display_device {
      *          for duplicates too!
      * @examples
      * WinDisplayDeviceInterface* iface = getIface(...);
-     * const std::string display_a { "MY_ID_1" };
-     * const std::string display_b { "MY_ID_2" };
+     * const DeviceId display_a { "MY_ID_1" };
+     * const DeviceId display_b { "MY_ID_2" };
      * const auto success = iface->setDisplayModes({ { display_a, { { 1920, 1080 }, { 60, 1 } } },
      *                                               { display_b, { { 1920, 1080 }, { 120, 1 } } } });
      * @examples_end
@@ -185,11 +185,11 @@ namespace display_device {
      * @note On Windows the state cannot be retrieved until the device is active even if it supports it.
      * @examples
      * const WinDisplayDeviceInterface* iface = getIface(...);
-     * const std::unordered_set<std::string> device_ids { "DEVICE_ID_1", "DEVICE_ID_2" };
+     * const DeviceIdSet device_ids { "DEVICE_ID_1"_id, "DEVICE_ID_2"_id };
      * const auto current_hdr_states = iface->getCurrentHdrStates(device_ids);
      * @examples_end
      */
-    [[nodiscard]] virtual HdrStateMap getCurrentHdrStates(const std::set<std::string> &device_ids) const = 0;
+    [[nodiscard]] virtual HdrStateMap getCurrentHdrStates(const DeviceIdSet &device_ids) const = 0;
 
     /**
      * @brief Set HDR states for the devices.
@@ -199,8 +199,8 @@ namespace display_device {
      *       and current state will not be changed.
      * @examples
      * WinDisplayDeviceInterface* iface = getIface(...);
-     * const std::string display_a { "MY_ID_1" };
-     * const std::string display_b { "MY_ID_2" };
+     * const DeviceId display_a { "MY_ID_1" };
+     * const DeviceId display_b { "MY_ID_2" };
      * const auto success = iface->setHdrStates({ { display_a, HdrState::Enabled },
      *                                            { display_b, HdrState::Disabled } });
      * @examples_end
@@ -5,6 +5,9 @@
 // header include
 #include "display_device/windows/json.h"
 
+// system includes
+#include <array>
+
 // special ordered include of details
 #define DD_JSON_DETAIL
 // clang-format off
@@ -13,6 +16,18 @@
 // clang-format on
 
 namespace display_device {
+  namespace {
+    /**
+     * @brief Migration steps for the persisted SingleDisplayConfigState, indexed by the version they upgrade from.
+     * @note New steps must be appended to the end, existing steps must never be modified!
+     */
+    const std::array<JsonMigrationStep, 1> SINGLE_DISPLAY_CONFIG_STATE_MIGRATIONS {
+      // v0 -> v1: data was stored without the envelope, but the layout itself is unchanged.
+      [](nlohmann::json &) {
+      }
+    };
+  }  // namespace
+
   const std::optional<unsigned int> JSON_COMPACT {std::nullopt};
 
   DD_JSON_DEFINE_CONVERTER(ActiveTopology)
@@ -21,4 +36,7 @@ namespace display_device {
   DD_JSON_DEFINE_CONVERTER(SingleDisplayConfigState)
   DD_JSON_DEFINE_CONVERTER(WinWorkarounds)
   DD_JSON_DEFINE_CONVERTER(DisplaySettingsSnapshot)
+  DD_JSON_DEFINE_CONVERTER(DisplaySettingsSnapshotDiff)
+
+  DD_JSON_DEFINE_VERSIONED_CONVERTER(SingleDisplayConfigState, SINGLE_DISPLAY_CONFIG_STATE_MIGRATIONS)
 }  // namespace display_device
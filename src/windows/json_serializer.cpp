@@ -10,6 +10,92 @@
 // clang-format on
 
 namespace display_device {
+  namespace {
+    /**
+     * @brief Escape the reference token for the JSON pointer (RFC 6901).
+     */
+    std::string escapePointerToken(const std::string &token) {
+      std::string escaped;
+      escaped.reserve(token.size());
+      for (const char ch : token) {
+        if (ch == '~') {
+          escaped += "~0";
+        } else if (ch == '/') {
+          escaped += "~1";
+        } else {
+          escaped += ch;
+        }
+      }
+      return escaped;
+    }
+
+    /**
+     * @brief Unescape the reference token of the JSON pointer (RFC 6901).
+     */
+    std::string unescapePointerToken(const std::string_view token) {
+      std::string unescaped;
+      unescaped.reserve(token.size());
+      for (std::size_t i = 0; i < token.size(); ++i) {
+        if (token[i] != '~') {
+          unescaped += token[i];
+          continue;
+        }
+
+        if (i + 1 < token.size() && (token[i + 1] == '0' || token[i + 1] == '1')) {
+          unescaped += token[i + 1] == '0' ? '~' : '/';
+          ++i;
+          continue;
+        }
+
+        throw std::runtime_error {"Invalid escape sequence in JSON pointer token \"" + std::string {token} + "\"!"};
+      }
+      return unescaped;
+    }
+
+    /**
+     * @brief Append a single RFC 6902 operation to the list.
+     */
+    void appendPatchOperation(nlohmann::json &operations, const std::string_view op, const std::string &path, const nlohmann::json *value = nullptr) {
+      nlohmann::json operation;
+      operation["op"] = op;
+      operation["path"] = path;
+      if (value) {
+        operation["value"] = *value;
+      }
+      operations.push_back(std::move(operation));
+    }
+
+    /**
+     * @brief Append the map changes for the specific snapshot member.
+     */
+    template<class Map>
+    void appendMapPatchOperations(nlohmann::json &operations, const std::string &member, const Map &changed, const std::set<std::string> &removed) {
+      for (const auto &device_id : removed) {
+        appendPatchOperation(operations, "remove", "/" + member + "/" + escapePointerToken(device_id));
+      }
+
+      for (const auto &[device_id, value] : changed) {
+        const nlohmann::json json_value = value;
+        appendPatchOperation(operations, "add", "/" + member + "/" + escapePointerToken(device_id), &json_value);
+      }
+    }
+
+    /**
+     * @brief Apply the map operation for the specific snapshot member.
+     */
+    template<class Map>
+    void applyMapPatchOperation(const std::string_view op, const std::string &device_id, const nlohmann::json &operation, Map &changed, std::set<std::string> &removed) {
+      if (op == "remove") {
+        changed.erase(DeviceId::find(device_id));
+        removed.insert(device_id);
+        return;
+      }
+
+      removed.erase(device_id);
+      changed[DeviceId {device_id}] = operation.at("value").get<typename Map::mapped_type>();
+    }
+  }  // namespace
+
   // Structs
   DD_JSON_DEFINE_SERIALIZE_STRUCT(DisplayMode, resolution, refresh_rate)
   DD_JSON_DEFINE_SERIALIZE_STRUCT(SingleDisplayConfigState::Initial, topology, primary_devices)
@@ -17,4 +103,52 @@ namespace display_device {
   DD_JSON_DEFINE_SERIALIZE_STRUCT(SingleDisplayConfigState, initial, modified)
   DD_JSON_DEFINE_SERIALIZE_STRUCT(WinWorkarounds, hdr_blank_delay)
   DD_JSON_DEFINE_SERIALIZE_STRUCT(DisplaySettingsSnapshot, topology, modes, hdr_states, primary_device)
+
+  // The diff is serialized as a RFC 6902 operation list with paths matching the DisplaySettingsSnapshot members.
+  void to_json(nlohmann::json &nlohmann_json_j, const DisplaySettingsSnapshotDiff &nlohmann_json_t) {
+    nlohmann_json_j = nlohmann::json::array();
+
+    if (nlohmann_json_t.m_topology) {
+      const nlohmann::json value = *nlohmann_json_t.m_topology;
+      appendPatchOperation(nlohmann_json_j, "replace", "/topology", &value);
+    }
+
+    appendMapPatchOperations(nlohmann_json_j, "modes", nlohmann_json_t.m_modes, nlohmann_json_t.m_removed_modes);
+    appendMapPatchOperations(nlohmann_json_j, "hdr_states", nlohmann_json_t.m_hdr_states, nlohmann_json_t.m_removed_hdr_states);
+
+    if (nlohmann_json_t.m_primary_device) {
+      const nlohmann::json value = *nlohmann_json_t.m_primary_device;
+      appendPatchOperation(nlohmann_json_j, "replace", "/primary_device", &value);
+    }
+  }
+
+  void from_json(const nlohmann::json &nlohmann_json_j, DisplaySettingsSnapshotDiff &nlohmann_json_t) {
+    static constexpr std::string_view modes_prefix {"/modes/"};
+    static constexpr std::string_view hdr_states_prefix {"/hdr_states/"};
+
+    if (!nlohmann_json_j.is_array()) {
+      throw std::runtime_error {"JSON patch must be an array of operations!"};
+    }
+
+    DisplaySettingsSnapshotDiff diff {};
+    for (const auto &operation : nlohmann_json_j) {
+      const auto op {operation.at("op").get<std::string>()};
+      const auto path {operation.at("path").get<std::string>()};
+      const bool is_upsert {op == "add" || op == "replace"};
+
+      if (is_upsert && path == "/topology") {
+        diff.m_topology = operation.at("value").get<ActiveTopology>();
+      } else if (is_upsert && path == "/primary_device") {
+        diff.m_primary_device = operation.at("value").get<std::string>();
+      } else if ((is_upsert || op == "remove") && path.starts_with(modes_prefix)) {
+        applyMapPatchOperation(op, unescapePointerToken(std::string_view {path}.substr(modes_prefix.size())), operation, diff.m_modes, diff.m_removed_modes);
+      } else if ((is_upsert || op == "remove") && path.starts_with(hdr_states_prefix)) {
+        applyMapPatchOperation(op, unescapePointerToken(std::string_view {path}.substr(hdr_states_prefix.size())), operation, diff.m_hdr_states, diff.m_removed_hdr_states);
+      } else {
+        throw std::runtime_error {"Unsupported JSON patch operation \"" + op + "\" for path \"" + path + "\"!"};
+      }
+    }
+
+    nlohmann_json_t = std::move(diff);
+  }
 }  // namespace display_device
@@ -11,8 +11,9 @@
 #include "display_device/windows/json.h"
 
 namespace display_device {
-  PersistentState::PersistentState(std::shared_ptr<SettingsPersistenceInterface> settings_persistence_api, const bool throw_on_load_error):
-      m_settings_persistence_api {std::move(settings_persistence_api)} {
+  PersistentState::PersistentState(std::shared_ptr<SettingsPersistenceInterface> settings_persistence_api, const bool throw_on_load_error, const std::optional<unsigned int> &json_indent):
+      m_settings_persistence_api {std::move(settings_persistence_api)},
+      m_json_indent {json_indent} {
     if (!m_settings_persistence_api) {
       m_settings_persistence_api = std::make_shared<NoopSettingsPersistence>();
     }
@@ -21,7 +22,7 @@ namespace display_device {
     if (const auto persistent_settings {m_settings_persistence_api->load()}) {
       if (!persistent_settings->empty()) {
         m_cached_state = SingleDisplayConfigState {};
-        if (!fromJson({std::begin(*persistent_settings), std::end(*persistent_settings)}, *m_cached_state, &error_message)) {
+        if (!fromVersionedJson({std::begin(*persistent_settings), std::end(*persistent_settings)}, *m_cached_state, &error_message)) {
           error_message = "Failed to parse persistent settings! Error:\n" + error_message;
         }
       }
@@ -54,7 +55,7 @@ namespace display_device {
     }
 
     bool success {false};
-    const auto json_string {toJson(*state, 2, &success)};
+    const auto json_string {toVersionedJson(*state, m_json_indent, &success)};
     if (!success) {
       DD_LOG(error) << "Failed to serialize new persistent state! Error:\n"
                     << json_string;
@@ -72,4 +73,8 @@ namespace display_device {
   const std::optional<SingleDisplayConfigState> &PersistentState::getState() const {
     return m_cached_state;
   }
+
+  bool PersistentState::prefersIntermediateStates() const {
+    return m_settings_persistence_api->prefersIntermediateStores();
+  }
 }  // namespace display_device
@@ -21,6 +21,15 @@ namespace display_device {
      */
     void noopFn() {
     }
+
+    /**
+     * @brief Steps of the apply that are persisted individually, in the order they are done.
+     */
+    enum class ApplyStep {
+      Topology,
+      PrimaryDevice,
+      DisplayModes
+    };
   }  // namespace
 
   SettingsManager::ApplyResult SettingsManager::applySettings(const SingleDisplayConfiguration &config) {
@@ -49,6 +58,50 @@ namespace display_device {
       }
     }};
 
+    // If the persistence prefers it (e.g. a journal), the state is persisted after every step once the system settings
+    // are touched, so that a crash between the steps still leaves behind a state that knows what has to be undone.
+    // Other persistence implementations only store the final state, as every store might be an expensive durable write.
+    //
+    // Should the apply fail, the guards undo the changes and the state from before the first step record is persisted again.
+    // It is captured only then, because the topology preparation might have reverted (and persisted) the previous settings.
+    std::optional<SingleDisplayConfigState> state_before_steps;
+    bool step_persisted {false};
+    boost::scope::scope_exit persistence_guard {[this, &state_before_steps, &step_persisted]() {
+      if (step_persisted && !m_persistence_state->persistState(state_before_steps)) {
+        DD_LOG(error) << "Failed to restore the persistent state after failing to apply the settings!";
+      }
+    }};
+    const auto persist_step {[this, &system_settings_touched, &state_before_steps, &step_persisted](const SingleDisplayConfigState &state, const ApplyStep completed_step) {
+      if (!system_settings_touched || !m_persistence_state->prefersIntermediateStates()) {
+        return true;
+      }
+
+      if (!step_persisted) {
+        state_before_steps = m_persistence_state->getState();
+      }
+
+      // The steps that are yet to be done read their original settings from the persisted state
+      // and these settings must also be kept in case they still need to be undone after a crash.
+      auto step_state {state};
+      if (const auto &cached_state {m_persistence_state->getState()}; cached_state) {
+        if (completed_step < ApplyStep::PrimaryDevice) {
+          step_state.m_modified.m_original_primary_device = cached_state->m_modified.m_original_primary_device;
+        }
+        if (completed_step < ApplyStep::DisplayModes) {
+          step_state.m_modified.m_original_modes = cached_state->m_modified.m_original_modes;
+        }
+        step_state.m_modified.m_original_hdr_states = cached_state->m_modified.m_original_hdr_states;
+      }
+
+      if (!m_persistence_state->persistState(step_state)) {
+        DD_LOG(error) << "Failed to save the intermediate settings! Undoing everything...";
+        return false;
+      }
+
+      step_persisted = true;
+      return true;
+    }};
+
     bool release_context {false};
     boost::scope::scope_exit topology_prep_guard {[this, topology = topology_before_changes, was_captured = m_audio_context_api->isCaptured(), &release_context]() {
       // It is possible that during topology preparation, some settings will be reverted for the modified topology.
@@ -75,7 +128,11 @@ namespace display_device {
       // Error already logged
       return ApplyResult::DevicePrepFailed;
     }
-    auto [new_state, device_to_configure, additional_devices_to_configure] = *prepped_topology_data;
+    auto [new_state, device_to_configure, additional_devices_to_configure, mode_catalogs] = *prepped_topology_data;
+    if (!persist_step(new_state, ApplyStep::Topology)) {
+      // Error already logged
+      return ApplyResult::PersistenceSaveFailed;
+    }
 
     DdGuardFn primary_guard_fn {noopFn};
     boost::scope::scope_exit<DdGuardFn &> primary_guard {primary_guard_fn};
@@ -83,13 +140,21 @@ namespace display_device {
       // Error already logged
       return ApplyResult::PrimaryDevicePrepFailed;
     }
+    if (!persist_step(new_state, ApplyStep::PrimaryDevice)) {
+      // Error already logged
+      return ApplyResult::PersistenceSaveFailed;
+    }
 
     DdGuardFn mode_guard_fn {noopFn};
     boost::scope::scope_exit<DdGuardFn &> mode_guard {mode_guard_fn};
-    if (!prepareDisplayModes(config, device_to_configure, additional_devices_to_configure, mode_guard_fn, new_state, system_settings_touched)) {
+    if (!prepareDisplayModes(config, device_to_configure, additional_devices_to_configure, mode_catalogs, mode_guard_fn, new_state, system_settings_touched)) {
       // Error already logged
       return ApplyResult::DisplayModePrepFailed;
     }
+    if (!persist_step(new_state, ApplyStep::DisplayModes)) {
+      // Error already logged
+      return ApplyResult::PersistenceSaveFailed;
+    }
 
     DdGuardFn hdr_state_guard_fn {noopFn};
     boost::scope::scope_exit<DdGuardFn &> hdr_state_guard {hdr_state_guard_fn};
@@ -111,6 +176,7 @@ namespace display_device {
     }
 
     // Disable all guards before returning
+    persistence_guard.set_active(false);
     topology_prep_guard.set_active(false);
     primary_guard.set_active(false);
     mode_guard.set_active(false);
@@ -211,7 +277,7 @@ namespace display_device {
     return true;
   }
 
-  std::optional<std::tuple<SingleDisplayConfigState, std::string, std::set<std::string>>> SettingsManager::prepareTopology(const SingleDisplayConfiguration &config, const ActiveTopology &topology_before_changes, bool &release_context, bool &system_settings_touched) {
+  std::optional<std::tuple<SingleDisplayConfigState, std::string, std::set<std::string>, DeviceModeCatalogMap>> SettingsManager::prepareTopology(const SingleDisplayConfiguration &config, const ActiveTopology &topology_before_changes, bool &release_context, bool &system_settings_touched) {
     const EnumeratedDeviceList devices {m_dd_api->enumAvailableDevices()};
     if (devices.empty()) {
       DD_LOG(error) << "Failed to enumerate display devices!";
@@ -256,7 +322,7 @@ namespace display_device {
 
     // This check is mainly to cover the case for "config.device_prep == VerifyOnly" as we at least
     // have to validate that the device exists, but it doesn't hurt to double-check it in all cases.
-    if (!win_utils::flattenTopology(new_topology).contains(device_to_configure)) {
+    if (!win_utils::flattenTopology(new_topology).contains(DeviceId::find(device_to_configure))) {
       DD_LOG(error) << "Device " << toJson(device_to_configure, JSON_COMPACT) << " is not active!";
       return std::nullopt;
     }
@@ -301,7 +367,7 @@ namespace display_device {
     }
 
     new_state.m_modified.m_topology = new_topology;
-    return std::make_tuple(new_state, device_to_configure, additional_devices_to_configure);
+    return std::make_tuple(new_state, device_to_configure, additional_devices_to_configure, win_utils::computeModeCatalogs(devices));
   }
 
   bool SettingsManager::preparePrimaryDevice(const SingleDisplayConfiguration &config, const std::string &device_to_configure, DdGuardFn &guard_fn, SingleDisplayConfigState &new_state, bool &system_settings_touched) {
@@ -360,7 +426,7 @@ namespace display_device {
     return true;
   }
 
-  bool SettingsManager::prepareDisplayModes(const SingleDisplayConfiguration &config, const std::string &device_to_configure, const std::set<std::string> &additional_devices_to_configure, DdGuardFn &guard_fn, SingleDisplayConfigState &new_state, bool &system_settings_touched) {
+  bool SettingsManager::prepareDisplayModes(const SingleDisplayConfiguration &config, const std::string &device_to_configure, const std::set<std::string> &additional_devices_to_configure, const DeviceModeCatalogMap &mode_catalogs, DdGuardFn &guard_fn, SingleDisplayConfigState &new_state, bool &system_settings_touched) {
     const auto &cached_state {m_persistence_state->getState()};
     const auto cached_display_modes {cached_state ? cached_state->m_modified.m_original_modes : DeviceDisplayModeMap {}};
     const bool change_required {config.m_resolution || config.m_refresh_rate};
@@ -402,7 +468,10 @@ namespace display_device {
       const auto original_display_modes {cached_display_modes.empty() ? current_display_modes : cached_display_modes};
       const auto new_display_modes {win_utils::computeNewDisplayModes(config.m_resolution, config.m_refresh_rate, configuring_primary_devices, device_to_configure, additional_devices_to_configure, original_display_modes)};
 
-      if (!try_change(new_display_modes, "Changing display modes to:\n", "Failed to apply new configuration, because new display modes could not be set!", true)) {
+      // The refresh rates are snapped before the OS is asked to set the modes, so that the exact supported mode is set on the first try.
+      // Whether the mode is supported at all is still up to the OS.
+      const auto snapped_display_modes {win_utils::snapDisplayModes(new_display_modes, original_display_modes, mode_catalogs)};
+      if (!try_change(snapped_display_modes, "Changing display modes to:\n", "Failed to apply new configuration, because new display modes could not be set!", true)) {
         // Error already logged
         return false;
       }
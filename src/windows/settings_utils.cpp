@@ -16,6 +16,12 @@
 
 namespace display_device::win_utils {
   namespace {
+    /**
+     * @brief Maximum refresh rate difference for snapping to the supported mode.
+     * @note Matches the tolerance of fuzzyCompareRefreshRates.
+     */
+    constexpr std::uint32_t MODE_SNAP_TOLERANCE_MHZ {900};
+
     /**
      * @brief predicate for getDeviceIds.
      */
@@ -64,7 +70,7 @@ namespace display_device::win_utils {
 
       ActiveTopology stripped_topology;
       for (const auto &group : topology) {
-        std::vector<std::string> stripped_group;
+        std::vector<DeviceId> stripped_group;
         for (const auto &device_id : group) {
           if (available_device_ids.contains(device_id)) {
             stripped_group.push_back(device_id);
@@ -119,15 +125,54 @@ namespace display_device::win_utils {
     /**
      * @brief Merge the configurable devices into a vector.
      */
-    std::vector<std::string> joinConfigurableDevices(const std::string &device_to_configure, const std::set<std::string> &additional_devices_to_configure) {
-      std::vector<std::string> devices {device_to_configure};
-      devices.insert(std::end(devices), std::begin(additional_devices_to_configure), std::end(additional_devices_to_configure));
+    std::vector<DeviceId> joinConfigurableDevices(const std::string &device_to_configure, const std::set<std::string> &additional_devices_to_configure) {
+      std::vector<DeviceId> devices {DeviceId {device_to_configure}};
+      for (const auto &device_id : additional_devices_to_configure) {
+        devices.emplace_back(device_id);
+      }
       return devices;
     }
+
+    /**
+     * @brief Compute the added/changed and removed entries between two maps.
+     * @param from_map Map to be used as a base.
+     * @param to_map Map to be compared against the base.
+     * @param changed Map to be filled with added or changed entries.
+     * @param removed Set to be filled with keys that are missing in `to_map`.
+     */
+    template<class Map>
+    void diffMaps(const Map &from_map, const Map &to_map, Map &changed, std::set<std::string> &removed) {
+      for (const auto &[key, value] : to_map) {
+        const auto from_it {from_map.find(key)};
+        if (from_it == std::end(from_map) || !(from_it->second == value)) {
+          changed.insert_or_assign(key, value);
+        }
+      }
+
+      for (const auto &[key, value] : from_map) {
+        if (!to_map.contains(key)) {
+          removed.insert(key);
+        }
+      }
+    }
+
+    /**
+     * @brief Apply the added/changed and removed entries to the map.
+     */
+    template<class Map>
+    void patchMap(Map &map, const Map &changed, const std::set<std::string> &removed) {
+      for (const auto &key : removed) {
+        map.erase(DeviceId::find(key));
+      }
+
+      for (const auto &[key, value] : changed) {
+        map.insert_or_assign(key, value);
+      }
+    }
   }  // namespace
 
-  std::set<std::string> flattenTopology(const ActiveTopology &topology) {
-    std::set<std::string> flattened_topology;
+  DeviceIdSet flattenTopology(const ActiveTopology &topology) {
+    DeviceIdSet flattened_topology;
     for (const auto &group : topology) {
       for (const auto &device_id : group) {
         flattened_topology.insert(device_id);
@@ -146,7 +191,7 @@ namespace display_device::win_utils {
 
     ActiveTopology topology;
     for (const auto &device : devices) {
-      topology.push_back({device.m_device_id});
+      topology.push_back({DeviceId {device.m_device_id}});
     }
 
     return topology;
@@ -202,14 +247,14 @@ namespace display_device::win_utils {
           return ActiveTopology {joinConfigurableDevices(device_to_configure, additional_devices_to_configure)};
         }
 
-        return ActiveTopology {{device_to_configure}};
+        return ActiveTopology {{DeviceId {device_to_configure}}};
       }
 
       //  The device needs to be active at least for `DevicePrep::EnsureActive || DevicePrep::EnsurePrimary`.
-      if (!flattenTopology(initial_topology).contains(device_to_configure)) {
+      if (!flattenTopology(initial_topology).contains(DeviceId::find(device_to_configure))) {
         // Create an extended topology as it's probably what makes sense the most...
         ActiveTopology new_topology {initial_topology};
-        new_topology.push_back({device_to_configure});
+        new_topology.push_back({DeviceId {device_to_configure}});
         return new_topology;
       }
     }
@@ -303,18 +348,63 @@ namespace display_device::win_utils {
         // Even if we have duplicate devices, their refresh rate may differ
         // and since the device was specified, let's apply the refresh
         // rate only to the specified device.
-        new_modes[device_to_configure].m_refresh_rate = from_floating_point(*refresh_rate);
+        new_modes[DeviceId {device_to_configure}].m_refresh_rate = from_floating_point(*refresh_rate);
       }
     }
 
     return new_modes;
   }
 
+  DeviceDisplayModeMap snapDisplayModes(const DeviceDisplayModeMap &new_modes, const DeviceDisplayModeMap &original_modes, const DeviceModeCatalogMap &mode_catalogs) {
+    DeviceDisplayModeMap snapped_modes {new_modes};
+
+    // Only the changed modes are checked, as the original ones were already accepted by the OS.
+    // The snapped rate is within the range that is considered the same mode anyway.
+    //
+    // A resolution that is not listed in the catalog is left for the OS to decide, since
+    // GPU-scaled modes and the modes added by the drivers are never listed in the EDID.
+    for (auto &[device_id, mode] : snapped_modes) {
+      const auto catalog_it {mode_catalogs.find(device_id)};
+      const auto original_it {original_modes.find(device_id)};
+      if (catalog_it == std::end(mode_catalogs) || !catalog_it->second.isComplete() || (original_it != std::end(original_modes) && original_it->second == mode)) {
+        continue;
+      }
+
+      const auto &catalog {catalog_it->second};
+      if (catalog.findNearest(mode.m_resolution, mode.m_refresh_rate, 0)) {
+        // Listed exactly
+        continue;
+      }
+
+      if (const auto supported_mode {catalog.findNearest(mode.m_resolution, mode.m_refresh_rate, MODE_SNAP_TOLERANCE_MHZ)}; supported_mode) {
+        mode.m_refresh_rate = supported_mode->m_refresh_rate;
+      }
+    }
+
+    return snapped_modes;
+  }
+
+  DeviceModeCatalogMap computeModeCatalogs(const EnumeratedDeviceList &devices) {
+    DeviceModeCatalogMap catalogs;
+    for (const auto &device : devices) {
+      if (!device.m_edid) {
+        continue;
+      }
+
+      auto catalog {ModeCatalog::fromEdid(*device.m_edid)};
+      if (!catalog.empty()) {
+        catalogs.emplace(device.m_device_id, std::move(catalog));
+      }
+    }
+
+    return catalogs;
+  }
+
   HdrStateMap computeNewHdrStates(const std::optional<HdrState> &hdr_state, bool configuring_primary_devices, const std::string &device_to_configure, const std::set<std::string> &additional_devices_to_configure, const HdrStateMap &original_states) {
     HdrStateMap new_states {original_states};
 
     if (hdr_state) {
-      const auto try_update_new_state = [&new_states, &hdr_state](const std::string &device_id) {
+      const auto try_update_new_state = [&new_states, &hdr_state](const DeviceId &device_id) {
         const auto current_state {new_states[device_id]};
         if (!current_state) {
           return;
@@ -334,13 +424,45 @@ namespace display_device::win_utils {
         // Even if we have duplicate devices, their HDR states may differ
         // and since the device was specified, let's apply the HDR state
         // only to the specified device.
-        try_update_new_state(device_to_configure);
+        try_update_new_state(DeviceId {device_to_configure});
       }
     }
 
     return new_states;
   }
 
+  DisplaySettingsSnapshotDiff computeSnapshotDiff(const DisplaySettingsSnapshot &from, const DisplaySettingsSnapshot &to) {
+    DisplaySettingsSnapshotDiff diff {};
+    if (from.m_topology != to.m_topology) {
+      diff.m_topology = to.m_topology;
+    }
+
+    diffMaps(from.m_modes, to.m_modes, diff.m_modes, diff.m_removed_modes);
+    diffMaps(from.m_hdr_states, to.m_hdr_states, diff.m_hdr_states, diff.m_removed_hdr_states);
+
+    if (from.m_primary_device != to.m_primary_device) {
+      diff.m_primary_device = to.m_primary_device;
+    }
+
+    return diff;
+  }
+
+  DisplaySettingsSnapshot applySnapshotDiff(const DisplaySettingsSnapshot &snapshot, const DisplaySettingsSnapshotDiff &diff) {
+    DisplaySettingsSnapshot new_snapshot {snapshot};
+    if (diff.m_topology) {
+      new_snapshot.m_topology = *diff.m_topology;
+    }
+
+    patchMap(new_snapshot.m_modes, diff.m_modes, diff.m_removed_modes);
+    patchMap(new_snapshot.m_hdr_states, diff.m_hdr_states, diff.m_removed_hdr_states);
+
+    if (diff.m_primary_device) {
+      new_snapshot.m_primary_device = *diff.m_primary_device;
+    }
+
+    return new_snapshot;
+  }
+
   void blankHdrStates(WinDisplayDeviceInterface &win_dd, const std::optional<std::chrono::milliseconds> &delay) {
     if (!delay) {
       return;
@@ -33,4 +33,12 @@ namespace display_device {
   bool operator==(const DisplaySettingsSnapshot &lhs, const DisplaySettingsSnapshot &rhs) {
     return lhs.m_topology == rhs.m_topology && lhs.m_modes == rhs.m_modes && lhs.m_hdr_states == rhs.m_hdr_states && lhs.m_primary_device == rhs.m_primary_device;
   }
+
+  bool DisplaySettingsSnapshotDiff::empty() const {
+    return !m_topology && m_modes.empty() && m_removed_modes.empty() && m_hdr_states.empty() && m_removed_hdr_states.empty() && !m_primary_device;
+  }
+
+  bool operator==(const DisplaySettingsSnapshotDiff &lhs, const DisplaySettingsSnapshotDiff &rhs) {
+    return lhs.m_topology == rhs.m_topology && lhs.m_modes == rhs.m_modes && lhs.m_removed_modes == rhs.m_removed_modes && lhs.m_hdr_states == rhs.m_hdr_states && lhs.m_removed_hdr_states == rhs.m_removed_hdr_states && lhs.m_primary_device == rhs.m_primary_device;
+  }
 }  // namespace display_device
@@ -5,53 +5,80 @@
 // header include
 #include "display_device/windows/win_api_utils.h"
 
-// system includes
-#include <unordered_set>
-
 // local includes
+#include "display_device/display_config_utils.h"
 #include "display_device/logging.h"
+#include "display_device/rational.h"
 
 namespace {
   /**
-   * @brief Check if adapter ids are NOT equal.
-   * @param lhs First id to check.
-   * @param rhs Second id to check.
-   * @return True if NOT equal, false otherwise.
-   * @examples
-   * const bool not_equal = (LUID{ 12, 34 }) != (LUID{ 12, 56 });
-   * @examples_end
+   * @brief Maximum difference of the refresh rates that are still considered the same.
+   */
+  constexpr display_device::Rational REFRESH_RATE_TOLERANCE {9, 10};
+
+  /**
+   * @brief Convert the Windows adapter id to the platform-neutral one.
+   * @param id Id to convert.
+   * @return Converted adapter id.
+   */
+  display_device::AdapterId toAdapterId(const LUID &id) {
+    return {static_cast<std::uint32_t>(id.LowPart), static_cast<std::int32_t>(id.HighPart)};
+  }
+
+  /**
+   * @brief Convert the Windows paths to the platform-neutral ones.
+   * @param paths Paths to convert.
+   * @return Converted paths with the same order.
    */
-  bool operator!=(const LUID &lhs, const LUID &rhs) {
-    return lhs.HighPart != rhs.HighPart || lhs.LowPart != rhs.LowPart;
+  std::vector<display_device::DisplayPath> toDisplayPaths(const std::vector<DISPLAYCONFIG_PATH_INFO> &paths) {
+    std::vector<display_device::DisplayPath> display_paths;
+    display_paths.reserve(paths.size());
+    for (const auto &path : paths) {
+      const UINT32 source_mode_index {path.sourceInfo.sourceModeInfoIdx};
+      display_paths.push_back({
+        toAdapterId(path.sourceInfo.adapterId),
+        path.sourceInfo.id,
+        path.targetInfo.id,
+        display_device::win_utils::isAvailable(path),
+        display_device::win_utils::isActive(path),
+        source_mode_index == DISPLAYCONFIG_PATH_SOURCE_MODE_IDX_INVALID ? std::nullopt : std::make_optional(source_mode_index)
+      });
+    }
+    return display_paths;
   }
 
   /**
-   * @brief Stringify adapter id.
-   * @param id Id to stringify.
-   * @return String representation of the id.
-   * @examples
-   * const bool id_string = to_string({ 12, 34 });
-   * @examples_end
+   * @brief Convert the Windows modes to the platform-neutral source modes.
+   * @param modes Modes to convert.
+   * @return Converted modes with the same order (empty for non-source modes).
    */
-  std::string toString(const LUID &id) {
-    return std::to_string(id.HighPart) + std::to_string(id.LowPart);
+  std::vector<std::optional<display_device::DisplaySourceMode>> toDisplaySourceModes(const std::vector<DISPLAYCONFIG_MODE_INFO> &modes) {
+    std::vector<std::optional<display_device::DisplaySourceMode>> source_modes;
+    source_modes.reserve(modes.size());
+    for (const auto &mode : modes) {
+      if (mode.infoType != DISPLAYCONFIG_MODE_INFO_TYPE_SOURCE) {
+        source_modes.emplace_back(std::nullopt);
+        continue;
+      }
+
+      source_modes.emplace_back(display_device::DisplaySourceMode {
+        {static_cast<int>(mode.sourceMode.position.x), static_cast<int>(mode.sourceMode.position.y)},
+        {mode.sourceMode.width, mode.sourceMode.height}
+      });
+    }
+    return source_modes;
   }
 
   /**
-   * @brief Check if the source modes are duplicated (cloned).
-   * @param lhs First mode to check.
-   * @param rhs Second mode to check.
-   * @returns True if both mode have the same origin point, false otherwise.
-   * @note Windows enforces the behaviour that only the duplicate devices can
-   *       have the same origin point as otherwise the configuration is considered invalid by the OS.
-   * @examples
-   * DISPLAYCONFIG_SOURCE_MODE mode_a;
-   * DISPLAYCONFIG_SOURCE_MODE mode_b;
-   * const bool are_duplicated = are_modes_duplicated(mode_a, mode_b);
-   * @examples_end
+   * @brief Make a device info resolver for the Windows paths.
+   * @param w_api Reference to the Windows API layer.
+   * @param paths Paths to resolve the device info for.
+   * @return Resolver that queries the device info only when needed.
    */
-  bool are_modes_duplicated(const DISPLAYCONFIG_SOURCE_MODE &lhs, const DISPLAYCONFIG_SOURCE_MODE &rhs) {
-    return lhs.position.x == rhs.position.x && lhs.position.y == rhs.position.y;
+  display_device::DeviceInfoResolver makeDeviceInfoResolver(const display_device::WinApiLayerInterface &w_api, const std::vector<DISPLAYCONFIG_PATH_INFO> &paths) {
+    return [&w_api, &paths](const std::size_t path_index) {
+      return display_device::win_utils::getDeviceInfoForValidPath(w_api, paths[path_index], display_device::ValidatedPathType::Any);
+    };
   }
 }  // namespace
 
@@ -226,240 +253,40 @@ namespace display_device::win_utils {
   }
 
   PathSourceIndexDataMap collectSourceDataForMatchingPaths(const WinApiLayerInterface &w_api, const std::vector<DISPLAYCONFIG_PATH_INFO> &paths) {
-    PathSourceIndexDataMap path_data;
-
-    std::unordered_map<std::string, std::string> paths_to_ids;
-    for (std::size_t index = 0; index < paths.size(); ++index) {
-      const auto &path {paths[index]};
-
-      const auto device_info {getDeviceInfoForValidPath(w_api, path, ValidatedPathType::Any)};
-      if (!device_info) {
-        // Path is not valid
-        continue;
-      }
-
-      const auto prev_device_id_for_path_it {paths_to_ids.find(device_info->m_device_path)};
-      if (prev_device_id_for_path_it != std::end(paths_to_ids)) {
-        if (prev_device_id_for_path_it->second != device_info->m_device_id) {
-          DD_LOG(error) << "Duplicate display device id found: " << device_info->m_device_id << " (device path: " << device_info->m_device_path << ")";
-          return {};
-        }
-      } else {
-        for (const auto &[device_path, device_id] : paths_to_ids) {
-          if (device_id == device_info->m_device_id) {
-            DD_LOG(error) << "Device id " << device_info->m_device_id << " is shared between 2 different paths: " << device_path << " and " << device_info->m_device_path;
-            return {};
-          }
-        }
-
-        paths_to_ids[device_info->m_device_path] = device_info->m_device_id;
-      }
-
-      auto path_data_it {path_data.find(device_info->m_device_id)};
-      if (path_data_it != std::end(path_data)) {
-        if (path_data_it->second.m_adapter_id != path.sourceInfo.adapterId) {
-          // Sanity check, should not be possible since adapter in embedded in the device path
-          DD_LOG(error) << "Device path " << device_info->m_device_path << " has different adapters!";
-          return {};
-        } else if (isActive(path)) {
-          // Sanity check, should not be possible as all active paths are in the front
-          DD_LOG(error) << "Device path " << device_info->m_device_path << " is active, but not the first entry in the list!";
-          return {};
-        } else if (path_data_it->second.m_source_id_to_path_index.contains(path.sourceInfo.id)) {
-          // Sanity check, should not be possible unless Windows goes bonkers
-          DD_LOG(error) << "Device path " << device_info->m_device_path << " has duplicate source ids!";
-          return {};
-        }
-
-        path_data_it->second.m_source_id_to_path_index[path.sourceInfo.id] = index;
-      } else {
-        path_data[device_info->m_device_id] = {
-          {{path.sourceInfo.id, index}},
-          path.sourceInfo.adapterId,
-          // Since active paths are always in the front, this is the only time we set it
-          isActive(path) ? std::make_optional(path.sourceInfo.id) : std::nullopt
-        };
-      }
-
-      DD_LOG(verbose) << "Device " << device_info->m_device_id << " (active: " << isActive(path) << ") at index " << index << " added to the source data list.";
-    }
-
-    if (path_data.empty()) {
-      DD_LOG(error) << "Failed to collect path source data or none was available!";
-    }
-    return path_data;
+    return config_utils::collectSourceDataForMatchingPaths(toDisplayPaths(paths), makeDeviceInfoResolver(w_api, paths));
   }
 
   std::vector<DISPLAYCONFIG_PATH_INFO> makePathsForNewTopology(const ActiveTopology &new_topology, const PathSourceIndexDataMap &path_source_data, const std::vector<DISPLAYCONFIG_PATH_INFO> &paths) {
     std::vector<DISPLAYCONFIG_PATH_INFO> new_paths;
+    for (const auto &topology_path : config_utils::makePathsForNewTopology(new_topology, path_source_data, paths.size())) {
+      auto selected_path {paths[topology_path.m_path_index]};
 
-    UINT32 group_id {0};
-    std::unordered_map<std::string, std::unordered_set<UINT32>> used_source_ids_per_adapter;
-    const auto is_source_id_already_used = [&used_source_ids_per_adapter](const LUID &adapter_id, UINT32 source_id) {
-      auto entry_it {used_source_ids_per_adapter.find(toString(adapter_id))};
-      if (entry_it != std::end(used_source_ids_per_adapter)) {
-        return entry_it->second.contains(source_id);
-      }
-
-      return false;
-    };
-
-    for (const auto &group : new_topology) {
-      std::unordered_map<std::string, UINT32> used_source_ids_per_adapter_per_group;
-      const auto get_already_used_source_id_in_group = [&used_source_ids_per_adapter_per_group](const LUID &adapter_id) -> std::optional<UINT32> {
-        auto entry_it {used_source_ids_per_adapter_per_group.find(toString(adapter_id))};
-        if (entry_it != std::end(used_source_ids_per_adapter_per_group)) {
-          return entry_it->second;
-        }
-
-        return std::nullopt;
-      };
-
-      for (const std::string &device_id : group) {
-        auto path_source_data_it {path_source_data.find(device_id)};
-        if (path_source_data_it == std::end(path_source_data)) {
-          DD_LOG(error) << "Device " << device_id << " does not exist in the available path source data!";
-          return {};
-        }
-
-        std::size_t selected_path_index {};
-        const auto &source_data {path_source_data_it->second};
-
-        const auto already_used_source_id {get_already_used_source_id_in_group(source_data.m_adapter_id)};
-        if (already_used_source_id) {
-          // Some device in the group is already using the source id, and we belong to the same adapter.
-          // This means we must also use the path with matching source id.
-          auto path_index_it {source_data.m_source_id_to_path_index.find(*already_used_source_id)};
-          if (path_index_it == std::end(source_data.m_source_id_to_path_index)) {
-            DD_LOG(error) << "Device " << device_id << " does not have a path with a source id " << *already_used_source_id << "!";
-            return {};
-          }
-
-          selected_path_index = path_index_it->second;
-        } else {
-          // Here we want to select a path index that has the lowest index (the "best" of paths), but only
-          // if the source id is still free. Technically we should not need to find the lowest index, but that's
-          // what will match the Windows' behaviour the closest if we need to create new topology in the end.
-          std::optional<std::size_t> path_index_candidate;
-          UINT32 used_source_id {};
-          for (const auto [source_id, index] : source_data.m_source_id_to_path_index) {
-            if (is_source_id_already_used(source_data.m_adapter_id, source_id)) {
-              continue;
-            }
-
-            if (!path_index_candidate || index < *path_index_candidate) {
-              path_index_candidate = index;
-              used_source_id = source_id;
-            }
-          }
-
-          if (!path_index_candidate) {
-            // Apparently nvidia GPU can only render 4 different sources at a time (according to Google).
-            // However, it seems to be true only for physical connections as we also have virtual displays.
-            //
-            // Virtual displays have different adapter ids than the physical connection ones, but GPU still
-            // has to render them, so I don't know how this 4 source limitation makes sense then?
-            //
-            // In short, this arbitrary limitation should not affect virtual displays when the GPU is at its limit.
-            DD_LOG(error) << "Device " << device_id << " cannot be enabled as the adapter has no more free source ids (GPU limitation)!";
-            return {};
-          }
-
-          selected_path_index = *path_index_candidate;
-          used_source_ids_per_adapter[toString(source_data.m_adapter_id)].insert(used_source_id);
-          used_source_ids_per_adapter_per_group[toString(source_data.m_adapter_id)] = used_source_id;
-        }
-
-        if (selected_path_index >= paths.size()) {
-          DD_LOG(error) << "Selected path index " << selected_path_index << " is out of range! List size: " << paths.size();
-          return {};
-        }
-
-        auto selected_path {paths[selected_path_index]};
-
-        // All the indexes must be cleared and only the group id specified
-        win_utils::setSourceIndex(selected_path, std::nullopt);
-        win_utils::setTargetIndex(selected_path, std::nullopt);
-        win_utils::setDesktopIndex(selected_path, std::nullopt);
-        win_utils::setCloneGroupId(selected_path, group_id);
-        win_utils::setActive(selected_path);  // We also need to mark it as active...
-
-        new_paths.push_back(selected_path);
-      }
+      // All the indexes must be cleared and only the group id specified
+      win_utils::setSourceIndex(selected_path, std::nullopt);
+      win_utils::setTargetIndex(selected_path, std::nullopt);
+      win_utils::setDesktopIndex(selected_path, std::nullopt);
+      win_utils::setCloneGroupId(selected_path, topology_path.m_clone_group_id);
+      win_utils::setActive(selected_path);  // We also need to mark it as active...
 
-      group_id++;
+      new_paths.push_back(selected_path);
     }
 
-    if (new_paths.empty()) {
-      DD_LOG(error) << "Failed to make paths for new topology!";
-    }
     return new_paths;
   }
 
-  std::set<std::string> getAllDeviceIdsAndMatchingDuplicates(const WinApiLayerInterface &w_api, const std::set<std::string> &device_ids) {
+  DeviceIdSet getAllDeviceIdsAndMatchingDuplicates(const WinApiLayerInterface &w_api, const DeviceIdSet &device_ids) {
     const auto display_data {w_api.queryDisplayConfig(QueryType::Active)};
     if (!display_data) {
       // Error already logged
       return {};
     }
 
-    std::set<std::string> all_device_ids;
-    for (const auto &device_id : device_ids) {
-      if (device_id.empty()) {
-        DD_LOG(error) << "Device it is empty!";
-        return {};
-      }
-
-      const auto provided_path {getActivePath(w_api, device_id, display_data->m_paths)};
-      if (!provided_path) {
-        DD_LOG(warning) << "Failed to find device for " << device_id << "!";
-        return {};
-      }
-
-      const auto provided_path_source_mode {getSourceMode(getSourceIndex(*provided_path, display_data->m_modes), display_data->m_modes)};
-      if (!provided_path_source_mode) {
-        DD_LOG(error) << "Active device does not have a source mode: " << device_id << "!";
-        return {};
-      }
-
-      // We will now iterate over all the active paths (provided path included) and check if
-      // any of them are duplicated.
-      for (const auto &path : display_data->m_paths) {
-        const auto device_info {getDeviceInfoForValidPath(w_api, path, ValidatedPathType::Active)};
-        if (!device_info) {
-          continue;
-        }
-
-        if (all_device_ids.contains(device_info->m_device_id)) {
-          // Already checked
-          continue;
-        }
-
-        const auto source_mode {getSourceMode(getSourceIndex(path, display_data->m_modes), display_data->m_modes)};
-        if (!source_mode) {
-          DD_LOG(error) << "Active device does not have a source mode: " << device_info->m_device_id << "!";
-          return {};
-        }
-
-        if (!are_modes_duplicated(*provided_path_source_mode, *source_mode)) {
-          continue;
-        }
-
-        all_device_ids.insert(device_info->m_device_id);
-      }
-    }
-
-    return all_device_ids;
+    const DisplayConfigData active_config {toDisplayPaths(display_data->m_paths), toDisplaySourceModes(display_data->m_modes)};
+    return config_utils::getAllDeviceIdsAndMatchingDuplicates(active_config, device_ids, makeDeviceInfoResolver(w_api, display_data->m_paths));
   }
 
   bool fuzzyCompareRefreshRates(const Rational &lhs, const Rational &rhs) {
-    if (lhs.m_denominator > 0 && rhs.m_denominator > 0) {
-      const double lhs_f {static_cast<double>(lhs.m_numerator) / static_cast<double>(lhs.m_denominator)};
-      const double rhs_f {static_cast<double>(rhs.m_numerator) / static_cast<double>(rhs.m_denominator)};
-      return (std::abs(lhs_f - rhs_f) <= 0.9);
-    }
-
-    return false;
+    return rational::isWithinTolerance(lhs, rhs, REFRESH_RATE_TOLERANCE);
   }
 
   bool fuzzyCompareModes(const DisplayMode &lhs, const DisplayMode &rhs) {
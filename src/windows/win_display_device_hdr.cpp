@@ -66,7 +66,7 @@ namespace display_device {
 
   }  // namespace
 
-  HdrStateMap WinDisplayDevice::getCurrentHdrStates(const std::set<std::string> &device_ids) const {
+  HdrStateMap WinDisplayDevice::getCurrentHdrStates(const DeviceIdSet &device_ids) const {
     if (device_ids.empty()) {
       DD_LOG(error) << "Device id set is empty!";
       return {};
@@ -11,6 +11,7 @@
 
 // local includes
 #include "display_device/logging.h"
+#include "display_device/windows/canonical_topology.h"
 #include "display_device/windows/win_api_utils.h"
 
 namespace display_device {
@@ -51,6 +52,25 @@ namespace display_device {
 
       return true;
     }
+
+    /**
+     * @brief Compare the topologies by sorting their copies.
+     * @note Only used for the topologies that cannot be canonicalized.
+     */
+    bool isOversizedTopologyTheSame(ActiveTopology lhs, ActiveTopology rhs) {
+      const auto sort_topology = [](ActiveTopology &topology) {
+        for (auto &group : topology) {
+          std::sort(std::begin(group), std::end(group));
+        }
+
+        std::sort(std::begin(topology), std::end(topology));
+      };
+
+      sort_topology(lhs);
+      sort_topology(rhs);
+
+      return lhs == rhs;
+    }
   }  // namespace
 
   ActiveTopology WinDisplayDevice::getCurrentTopology() const {
@@ -82,9 +102,9 @@ namespace display_device {
 
       if (index_it == std::end(position_to_topology_index)) {
         position_to_topology_index[lazy_lookup] = topology.size();
-        topology.push_back({device_info->m_device_id});
+        topology.push_back({DeviceId {device_info->m_device_id}});
       } else {
-        topology.at(index_it->second).push_back(device_info->m_device_id);
+        topology.at(index_it->second).emplace_back(device_info->m_device_id);
       }
     }
 
@@ -97,7 +117,7 @@ namespace display_device {
       return false;
     }
 
-    std::unordered_set<std::string> device_ids;
+    std::unordered_set<DeviceId> device_ids;
     for (const auto &group : topology) {
       // Size 2 is a Windows' limitation.
       // You CAN set the group to be more than 2, but then
@@ -119,22 +139,19 @@ namespace display_device {
   }
 
   bool WinDisplayDevice::isTopologyTheSame(const ActiveTopology &lhs, const ActiveTopology &rhs) const {
-    const auto sort_topology = [](ActiveTopology &topology) {
-      for (auto &group : topology) {
-        std::sort(std::begin(group), std::end(group));
-      }
-
-      std::sort(std::begin(topology), std::end(topology));
-    };
-
-    auto lhs_copy {lhs};
-    auto rhs_copy {rhs};
+    if (lhs.size() != rhs.size()) {
+      return false;
+    }
 
     // On Windows order does not matter.
-    sort_topology(lhs_copy);
-    sort_topology(rhs_copy);
+    const auto lhs_canonical {CanonicalTopology::fromTopology(lhs)};
+    const auto rhs_canonical {CanonicalTopology::fromTopology(rhs)};
+    if (lhs_canonical || rhs_canonical) {
+      return lhs_canonical == rhs_canonical;
+    }
 
-    return lhs_copy == rhs_copy;
+    // Both topologies have oversized groups and cannot be canonicalized (they are invalid anyway).
+    return isOversizedTopologyTheSame(lhs, rhs);
   }
 
   bool WinDisplayDevice::setTopology(const ActiveTopology &new_topology) {
@@ -149,7 +166,8 @@ namespace display_device {
       return false;
     }
 
-    if (isTopologyTheSame(current_topology, new_topology)) {
+    const auto new_canonical_topology {CanonicalTopology::fromTopology(new_topology)};
+    if (CanonicalTopology::fromTopology(current_topology) == new_canonical_topology) {
       DD_LOG(debug) << "Same topology provided.";
       return true;
     }
@@ -163,7 +181,7 @@ namespace display_device {
     if (doSetTopology(*m_w_api, new_topology, *original_data)) {
       const auto updated_topology {getCurrentTopology()};
       if (isTopologyValid(updated_topology)) {
-        if (isTopologyTheSame(new_topology, updated_topology)) {
+        if (CanonicalTopology::fromTopology(updated_topology) == new_canonical_topology) {
           return true;
         } else {
           // There is an interesting bug in Windows when you have nearly
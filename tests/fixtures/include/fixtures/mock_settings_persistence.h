@@ -12,5 +12,6 @@ namespace display_device {
     MOCK_METHOD(bool, store, (const std::vector<std::uint8_t> &), (override));
     MOCK_METHOD(std::optional<std::vector<std::uint8_t>>, load, (), (const, override));
     MOCK_METHOD(bool, clear, (), (override));
+    MOCK_METHOD(bool, prefersIntermediateStores, (), (const, override));
   };
 }  // namespace display_device
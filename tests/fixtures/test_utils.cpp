@@ -37,7 +37,12 @@ namespace ut_consts {
   const display_device::EdidData DEFAULT_EDID_DATA {
     .m_manufacturer_id = "ACI",
     .m_product_code = "27EC",
-    .m_serial_number = 21930
+    .m_serial_number = 21930,
+    .m_monitor_name = "ROG PG279Q",
+    .m_preferred_timing = display_device::EdidData::Timing {{2560, 1440}, {59951, 1000}, 241500, false},
+    .m_detailed_timings = {{{2560, 1440}, {59951, 1000}, 241500, false}},
+    .m_refresh_rate_range = display_device::EdidData::RefreshRateRange {30, 144},
+    .m_video_modes = {{{640, 480}, {60, 1}}, {{800, 600}, {60, 1}}, {{1024, 768}, {60, 1}}}
   };
 }  // namespace ut_consts
 
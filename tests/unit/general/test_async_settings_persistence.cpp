@@ -0,0 +1,275 @@
+// system includes
+#include <atomic>
+#include <future>
+#include <gmock/gmock.h>
+
+// local includes
+#include "display_device/async_settings_persistence.h"
+#include "fixtures/fixtures.h"
+#include "fixtures/mock_settings_persistence.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+  using ::testing::InSequence;
+  using ::testing::Return;
+  using ::testing::StrictMock;
+  using namespace std::chrono_literals;
+
+  // Test fixture(s) for this file
+  class AsyncSettingsPersistenceMocked: public BaseTest {
+  public:
+    display_device::AsyncSettingsPersistence &getImpl(const std::chrono::milliseconds flush_delay = 1h) {
+      if (!m_impl) {
+        m_impl = std::make_unique<display_device::AsyncSettingsPersistence>(m_settings_persistence_api, flush_delay);
+      }
+
+      return *m_impl;
+    }
+
+    void resetImpl() {
+      m_impl = nullptr;
+    }
+
+    std::shared_ptr<StrictMock<display_device::MockSettingsPersistence>> m_settings_persistence_api {std::make_shared<StrictMock<display_device::MockSettingsPersistence>>()};
+
+  private:
+    std::unique_ptr<display_device::AsyncSettingsPersistence> m_impl;
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S_MOCKED(...) DD_MAKE_TEST(TEST_F, AsyncSettingsPersistenceMocked, __VA_ARGS__)
+
+  // Additional convenience global const(s)
+  const std::vector<std::uint8_t> DATA_1 {'D', 'A', 'T', 'A', ' ', '1'};
+  const std::vector<std::uint8_t> DATA_2 {'D', 'A', 'T', 'A', ' ', '2'};
+  const std::vector<std::uint8_t> DATA_3 {'D', 'A', 'T', 'A', ' ', '3'};
+}  // namespace
+
+TEST_F_S_MOCKED(NullptrPersistenceProvided) {
+  EXPECT_THAT([]() {
+    const display_device::AsyncSettingsPersistence persistence {nullptr};
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Nullptr provided for SettingsPersistenceInterface in AsyncSettingsPersistence!")));
+}
+
+TEST_F_S_MOCKED(InvalidFlushDelayProvided) {
+  EXPECT_THAT([this]() {
+    const display_device::AsyncSettingsPersistence persistence(m_settings_persistence_api, 0ms);
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Flush delay provided in AsyncSettingsPersistence must be larger than a 0!")));
+}
+
+TEST_F_S_MOCKED(Store, Coalesced) {
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_3))
+    .Times(1)
+    .WillOnce(Return(true));
+
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_TRUE(getImpl().store(DATA_2));
+  EXPECT_TRUE(getImpl().store(DATA_3));
+  EXPECT_TRUE(getImpl().flush());
+  EXPECT_TRUE(getImpl().flush());
+}
+
+TEST_F_S_MOCKED(Store, ForwardedAfterDelay) {
+  std::atomic_bool stored {false};
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_2))
+    .Times(1)
+    .WillOnce([&](const auto &) {
+      stored = true;
+      return true;
+    });
+
+  EXPECT_TRUE(getImpl(10ms).store(DATA_1));
+  EXPECT_TRUE(getImpl().store(DATA_2));
+
+  for (int i = 0; i < 1000 && !stored; ++i) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_TRUE(stored);
+  EXPECT_TRUE(getImpl().flush());
+}
+
+TEST_F_S_MOCKED(Store, ForwardedOnDestruction) {
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_1))
+    .Times(1)
+    .WillOnce(Return(true));
+
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  resetImpl();
+}
+
+TEST_F_S_MOCKED(Clear, Coalesced) {
+  EXPECT_CALL(*m_settings_persistence_api, clear())
+    .Times(1)
+    .WillOnce(Return(true));
+
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_TRUE(getImpl().clear());
+  EXPECT_TRUE(getImpl().flush());
+}
+
+TEST_F_S_MOCKED(Flush, NothingPending) {
+  EXPECT_TRUE(getImpl().flush());
+}
+
+TEST_F_S_MOCKED(Flush, FailedOperationRetained) {
+  InSequence sequence;
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_1))
+    .Times(2)
+    .WillOnce(Return(false))
+    .WillOnce(Return(true));
+
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_FALSE(getImpl().flush());
+  EXPECT_EQ(getImpl().load(), DATA_1);
+  EXPECT_TRUE(getImpl().flush());
+}
+
+TEST_F_S_MOCKED(Flush, FailedOperationSuperseded) {
+  InSequence sequence;
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_1))
+    .Times(1)
+    .WillOnce(Return(false));
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_2))
+    .Times(1)
+    .WillOnce(Return(true));
+
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_FALSE(getImpl().flush());
+  EXPECT_TRUE(getImpl().store(DATA_2));
+  EXPECT_TRUE(getImpl().flush());
+}
+
+TEST_F_S_MOCKED(Flush, FailedOperationNotRescheduledOverNewerOne) {
+  std::promise<void> store_started;
+  std::promise<void> store_released;
+  auto store_released_future {store_released.get_future()};
+
+  InSequence sequence;
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_1))
+    .Times(1)
+    .WillOnce([&](const auto &) {
+      store_started.set_value();
+      store_released_future.wait();
+      return false;
+    });
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_2))
+    .Times(1)
+    .WillOnce(Return(true));
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(DATA_2));
+
+  // The background thread takes the first operation and blocks while forwarding it
+  EXPECT_TRUE(getImpl(1ms).store(DATA_1));
+  store_started.get_future().wait();
+
+  // Flush takes the newer operation and waits for the one in progress
+  EXPECT_TRUE(getImpl().store(DATA_2));
+  auto flush_result {std::async(std::launch::async, [this]() {
+    return getImpl().flush();
+  })};
+  std::this_thread::sleep_for(50ms);
+
+  // The stale operation fails after the newer one was taken and must not be retried over it
+  store_released.set_value();
+  EXPECT_TRUE(flush_result.get());
+  EXPECT_EQ(getImpl().load(), DATA_2);
+  resetImpl();
+}
+
+TEST_F_S_MOCKED(Flush, BackgroundFailureRetried) {
+  std::promise<void> store_started;
+  std::promise<void> store_released;
+  auto store_released_future {store_released.get_future()};
+  std::atomic_int store_calls {0};
+
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_1))
+    .Times(2)
+    .WillOnce([&](const auto &) {
+      store_started.set_value();
+      store_released_future.wait();
+      ++store_calls;
+      return false;
+    })
+    .WillOnce([&](const auto &) {
+      ++store_calls;
+      return true;
+    });
+
+  // The background thread takes the operation and blocks while forwarding it
+  EXPECT_TRUE(getImpl(1ms).store(DATA_1));
+  store_started.get_future().wait();
+
+  // Nothing is pending, so the flush can only wait for the operation in progress
+  auto flush_result {std::async(std::launch::async, [this]() {
+    return getImpl().flush();
+  })};
+
+  // The failed operation must be retried before the flush is allowed to report the success
+  store_released.set_value();
+  EXPECT_TRUE(flush_result.get());
+  EXPECT_EQ(store_calls, 2);
+  resetImpl();
+}
+
+TEST_F_S_MOCKED(Load, PendingStoreReturned) {
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_1))
+    .Times(1)
+    .WillOnce(Return(true));
+
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_EQ(getImpl().load(), DATA_1);
+  EXPECT_TRUE(getImpl().flush());
+}
+
+TEST_F_S_MOCKED(Load, PendingClearReturned) {
+  EXPECT_CALL(*m_settings_persistence_api, clear())
+    .Times(1)
+    .WillOnce(Return(true));
+
+  EXPECT_TRUE(getImpl().clear());
+  EXPECT_EQ(getImpl().load(), std::vector<std::uint8_t> {});
+  EXPECT_TRUE(getImpl().flush());
+}
+
+TEST_F_S_MOCKED(Load, NothingPending) {
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(std::nullopt));
+
+  EXPECT_EQ(getImpl().load(), std::nullopt);
+}
+
+TEST_F_S_MOCKED(Load, StoreNotBlocked) {
+  std::promise<void> load_started;
+  std::promise<void> load_released;
+  auto load_released_future {load_released.get_future()};
+
+  InSequence sequence;
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce([&]() {
+      load_started.set_value();
+      load_released_future.wait();
+      return DATA_1;
+    });
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_2))
+    .Times(1)
+    .WillOnce(Return(true));
+
+  auto load_result {std::async(std::launch::async, [this]() {
+    return getImpl().load();
+  })};
+  load_started.get_future().wait();
+
+  // The store is accepted while the wrapped interface is still loading
+  EXPECT_TRUE(getImpl().store(DATA_2));
+  EXPECT_EQ(getImpl().load(), DATA_2);
+
+  load_released.set_value();
+  EXPECT_EQ(load_result.get(), DATA_1);
+  EXPECT_TRUE(getImpl().flush());
+}
@@ -0,0 +1,89 @@
+// system includes
+#include <gmock/gmock.h>
+#include <numeric>
+#include <string_view>
+
+// local includes
+#include "display_device/detail/checksum.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, ChecksumTest, __VA_ARGS__)
+
+  std::span<const std::uint8_t> toBytes(const std::string_view &value) {
+    return {reinterpret_cast<const std::uint8_t *>(value.data()), value.size()};
+  }
+
+  std::uint32_t referenceCrc32c(const std::span<const std::uint8_t> data) {
+    std::uint32_t crc {0xFFFFFFFF};
+    for (const auto byte : data) {
+      crc ^= byte;
+      for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc & 1) ? (crc >> 1) ^ 0x82F63B78 : crc >> 1;
+      }
+    }
+    return ~crc;
+  }
+}  // namespace
+
+TEST_S(Crc32c, KnownValues) {
+  EXPECT_EQ(display_device::detail::crc32c({}), 0x00000000);
+  EXPECT_EQ(display_device::detail::crc32c(toBytes("123456789")), 0xE3069283);
+  EXPECT_EQ(display_device::detail::crc32c(std::vector<std::uint8_t>(32, 0x00)), 0x8A9136AA);
+  EXPECT_EQ(display_device::detail::crc32c(std::vector<std::uint8_t>(32, 0xFF)), 0x62A8AB43);
+}
+
+TEST_S(Crc32c, MatchesReference) {
+  std::vector<std::uint8_t> data(1024);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<std::uint8_t>(i * 131 + 7);
+  }
+
+  // Different sizes and offsets to cover both the bulk and the tail processing
+  for (std::size_t offset = 0; offset < 8; ++offset) {
+    for (std::size_t size = 0; size < 40; ++size) {
+      const auto chunk {std::span<const std::uint8_t> {data}.subspan(offset, size)};
+      EXPECT_EQ(display_device::detail::crc32c(chunk), referenceCrc32c(chunk));
+    }
+  }
+  EXPECT_EQ(display_device::detail::crc32c(data), referenceCrc32c(data));
+}
+
+TEST_S(Crc32c, Incremental) {
+  const auto data {toBytes("The quick brown fox jumps over the lazy dog")};
+  for (std::size_t split = 0; split <= data.size(); ++split) {
+    EXPECT_EQ(display_device::detail::crc32c(data.subspan(split), display_device::detail::crc32c(data.first(split))), display_device::detail::crc32c(data));
+  }
+}
+
+TEST_S(Fnv1a64, KnownValues) {
+  EXPECT_EQ(display_device::detail::fnv1a64({}), 0xCBF29CE484222325);
+  EXPECT_EQ(display_device::detail::fnv1a64(toBytes("a")), 0xAF63DC4C8601EC8C);
+  EXPECT_EQ(display_device::detail::fnv1a64(toBytes("foobar")), 0x85944171F73967E8);
+}
+
+TEST_S(SumBytes, KnownValues) {
+  EXPECT_EQ(display_device::detail::sumBytes({}), 0);
+  EXPECT_EQ(display_device::detail::sumBytes(toBytes("a")), 97);
+
+  const std::vector<std::uint8_t> ones(128, 0xFF);
+  EXPECT_EQ(display_device::detail::sumBytes(ones), 128 * 255);
+}
+
+TEST_S(SumBytes, MatchesReference) {
+  std::vector<std::uint8_t> data(1024);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<std::uint8_t>(i * 31 + 7);
+  }
+
+  // Covers the unaligned starts and the scalar tails
+  const std::span<const std::uint8_t> view {data};
+  for (std::size_t offset = 0; offset < 16; ++offset) {
+    for (std::size_t size = 0; size + offset <= 64; ++size) {
+      const auto sub {view.subspan(offset, size)};
+      EXPECT_EQ(display_device::detail::sumBytes(sub), std::accumulate(std::begin(sub), std::end(sub), std::uint32_t {0}));
+    }
+  }
+  EXPECT_EQ(display_device::detail::sumBytes(view), std::accumulate(std::begin(view), std::end(view), std::uint32_t {0}));
+}
@@ -30,6 +30,39 @@ TEST_S(EdidData) {
   EXPECT_NE(display_device::EdidData({"LOL", "1337", 1234}), display_device::EdidData({"MEH", "1337", 1234}));
   EXPECT_NE(display_device::EdidData({"LOL", "1337", 1234}), display_device::EdidData({"LOL", "1338", 1234}));
   EXPECT_NE(display_device::EdidData({"LOL", "1337", 1234}), display_device::EdidData({"LOL", "1337", 1235}));
+  EXPECT_NE(display_device::EdidData({"LOL", "1337", 1234}), display_device::EdidData({"LOL", "1337", 1234, "NAME"}));
+  EXPECT_NE(display_device::EdidData({"LOL", "1337", 1234}), display_device::EdidData({"LOL", "1337", 1234, "", display_device::EdidData::Timing {}}));
+  EXPECT_NE(display_device::EdidData({"LOL", "1337", 1234}), display_device::EdidData({"LOL", "1337", 1234, "", std::nullopt, {display_device::EdidData::Timing {}}}));
+  EXPECT_NE(display_device::EdidData({"LOL", "1337", 1234}), display_device::EdidData({"LOL", "1337", 1234, "", std::nullopt, {}, display_device::EdidData::HdrStaticMetadata {}}));
+  EXPECT_NE(display_device::EdidData({"LOL", "1337", 1234}), display_device::EdidData({"LOL", "1337", 1234, "", std::nullopt, {}, std::nullopt, display_device::EdidData::RefreshRateRange {}}));
+  EXPECT_NE(display_device::EdidData({"LOL", "1337", 1234}), display_device::EdidData({"LOL", "1337", 1234, "", std::nullopt, {}, std::nullopt, std::nullopt, display_device::EdidData::RefreshRateRange {}}));
+}
+
+TEST_S(EdidData, Timing) {
+  EXPECT_EQ(display_device::EdidData::Timing({{1, 1}, {1, 1}, 1, true}), display_device::EdidData::Timing({{1, 1}, {1, 1}, 1, true}));
+  EXPECT_NE(display_device::EdidData::Timing({{1, 1}, {1, 1}, 1, true}), display_device::EdidData::Timing({{1, 0}, {1, 1}, 1, true}));
+  EXPECT_NE(display_device::EdidData::Timing({{1, 1}, {1, 1}, 1, true}), display_device::EdidData::Timing({{1, 1}, {1, 0}, 1, true}));
+  EXPECT_NE(display_device::EdidData::Timing({{1, 1}, {1, 1}, 1, true}), display_device::EdidData::Timing({{1, 1}, {1, 1}, 0, true}));
+  EXPECT_NE(display_device::EdidData::Timing({{1, 1}, {1, 1}, 1, true}), display_device::EdidData::Timing({{1, 1}, {1, 1}, 1, false}));
+}
+
+TEST_S(EdidData, HdrStaticMetadata) {
+  using Hdr = display_device::EdidData::HdrStaticMetadata;
+  EXPECT_EQ(Hdr({true, true, true, true, 1., 1., 1.}), Hdr({true, true, true, true, 1., 1., 1.}));
+  EXPECT_EQ(Hdr({true, true, true, true, 1., 1., 1.}), Hdr({true, true, true, true, 1.000000000000001, 1., 1.}));
+  EXPECT_NE(Hdr({true, true, true, true, 1., 1., 1.}), Hdr({false, true, true, true, 1., 1., 1.}));
+  EXPECT_NE(Hdr({true, true, true, true, 1., 1., 1.}), Hdr({true, false, true, true, 1., 1., 1.}));
+  EXPECT_NE(Hdr({true, true, true, true, 1., 1., 1.}), Hdr({true, true, false, true, 1., 1., 1.}));
+  EXPECT_NE(Hdr({true, true, true, true, 1., 1., 1.}), Hdr({true, true, true, false, 1., 1., 1.}));
+  EXPECT_NE(Hdr({true, true, true, true, 1., 1., 1.}), Hdr({true, true, true, true, std::nullopt, 1., 1.}));
+  EXPECT_NE(Hdr({true, true, true, true, 1., 1., 1.}), Hdr({true, true, true, true, 1., 1.1, 1.}));
+  EXPECT_NE(Hdr({true, true, true, true, 1., 1., 1.}), Hdr({true, true, true, true, 1., 1., 0.}));
+}
+
+TEST_S(EdidData, RefreshRateRange) {
+  EXPECT_EQ(display_device::EdidData::RefreshRateRange({1, 1}), display_device::EdidData::RefreshRateRange({1, 1}));
+  EXPECT_NE(display_device::EdidData::RefreshRateRange({1, 1}), display_device::EdidData::RefreshRateRange({0, 1}));
+  EXPECT_NE(display_device::EdidData::RefreshRateRange({1, 1}), display_device::EdidData::RefreshRateRange({1, 0}));
 }
 
 TEST_S(EnumeratedDevice, Info) {
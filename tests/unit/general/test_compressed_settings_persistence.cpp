@@ -0,0 +1,155 @@
+// local includes
+#include "display_device/compressed_settings_persistence.h"
+#include "display_device/memory_settings_persistence.h"
+#include "fixtures/fixtures.h"
+#include "fixtures/mock_settings_persistence.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::_;
+  using ::testing::DoAll;
+  using ::testing::HasSubstr;
+  using ::testing::Return;
+  using ::testing::SaveArg;
+  using ::testing::StrictMock;
+
+  // Test fixture(s) for this file
+  class CompressedSettingsPersistenceMocked: public BaseTest {
+  public:
+    display_device::CompressedSettingsPersistence &getImpl() {
+      if (!m_impl) {
+        m_impl = std::make_unique<display_device::CompressedSettingsPersistence>(m_settings_persistence_api);
+      }
+
+      return *m_impl;
+    }
+
+    std::shared_ptr<StrictMock<display_device::MockSettingsPersistence>> m_settings_persistence_api {std::make_shared<StrictMock<display_device::MockSettingsPersistence>>()};
+
+  private:
+    std::unique_ptr<display_device::CompressedSettingsPersistence> m_impl;
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, CompressedSettingsPersistence, __VA_ARGS__)
+#define TEST_F_S_MOCKED(...) DD_MAKE_TEST(TEST_F, CompressedSettingsPersistenceMocked, __VA_ARGS__)
+
+  // Additional convenience global const(s)
+  const std::string DATA_STRING {R"({"version":2,"data":{"initial":{"topology":[["DeviceId1"],["DeviceId2"]]},"modified":{"topology":[["DeviceId1"],["DeviceId2"]]}}})"};
+  const std::vector<std::uint8_t> DATA {std::begin(DATA_STRING), std::end(DATA_STRING)};
+  const std::vector<std::uint8_t> ZSTD_MAGIC {0x28, 0xB5, 0x2F, 0xFD};
+}  // namespace
+
+TEST_F_S_MOCKED(NullptrPersistenceProvided) {
+  EXPECT_THAT([]() {
+    const display_device::CompressedSettingsPersistence persistence {nullptr};
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Nullptr provided for SettingsPersistenceInterface in CompressedSettingsPersistence!")));
+}
+
+TEST_F_S_MOCKED(Store) {
+  std::vector<std::uint8_t> stored_data;
+  EXPECT_CALL(*m_settings_persistence_api, store(_))
+    .Times(1)
+    .WillOnce(DoAll(SaveArg<0>(&stored_data), Return(true)));
+
+  EXPECT_TRUE(getImpl().store(DATA));
+  if (display_device::CompressedSettingsPersistence::isCompressionAvailable()) {
+    ASSERT_GE(stored_data.size(), ZSTD_MAGIC.size());
+    EXPECT_TRUE(std::equal(std::begin(ZSTD_MAGIC), std::end(ZSTD_MAGIC), std::begin(stored_data)));
+  } else {
+    EXPECT_EQ(stored_data, DATA);
+  }
+}
+
+TEST_F_S_MOCKED(Store, Failed) {
+  EXPECT_CALL(*m_settings_persistence_api, store(_))
+    .Times(1)
+    .WillOnce(Return(false));
+
+  EXPECT_FALSE(getImpl().store(DATA));
+}
+
+TEST_F_S_MOCKED(Load, UncompressedData) {
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(DATA));
+
+  EXPECT_EQ(getImpl().load(), DATA);
+}
+
+TEST_F_S_MOCKED(Load, EmptyData) {
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(std::vector<std::uint8_t> {}));
+
+  EXPECT_EQ(getImpl().load(), std::vector<std::uint8_t> {});
+}
+
+TEST_F_S_MOCKED(Load, Failed) {
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(std::nullopt));
+
+  EXPECT_EQ(getImpl().load(), std::nullopt);
+}
+
+TEST_F_S_MOCKED(Load, CorruptedCompressedData) {
+  auto corrupted_data {ZSTD_MAGIC};
+  corrupted_data.insert(std::end(corrupted_data), {0xFF, 0xFF, 0xFF, 0xFF});
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(corrupted_data));
+
+  EXPECT_EQ(getImpl().load(), std::nullopt);
+}
+
+TEST_F_S_MOCKED(Clear) {
+  EXPECT_CALL(*m_settings_persistence_api, clear())
+    .Times(2)
+    .WillOnce(Return(true))
+    .WillOnce(Return(false));
+
+  EXPECT_TRUE(getImpl().clear());
+  EXPECT_FALSE(getImpl().clear());
+}
+
+TEST_F_S_MOCKED(PrefersIntermediateStores) {
+  EXPECT_CALL(*m_settings_persistence_api, prefersIntermediateStores())
+    .Times(2)
+    .WillOnce(Return(true))
+    .WillOnce(Return(false));
+
+  EXPECT_TRUE(getImpl().prefersIntermediateStores());
+  EXPECT_FALSE(getImpl().prefersIntermediateStores());
+}
+
+TEST_S(RoundTrip) {
+  const auto memory_persistence {std::make_shared<display_device::MemorySettingsPersistence>()};
+  display_device::CompressedSettingsPersistence persistence {memory_persistence};
+
+  EXPECT_TRUE(persistence.store(DATA));
+  EXPECT_EQ(persistence.load(), DATA);
+  EXPECT_TRUE(persistence.store({}));
+  EXPECT_EQ(persistence.load(), std::vector<std::uint8_t> {});
+}
+
+TEST_S(RoundTrip, SmallerThanOriginal) {
+  if (!display_device::CompressedSettingsPersistence::isCompressionAvailable()) {
+    GTEST_SKIP() << "Library was built without the compression support.";
+  }
+
+  std::string repetitive_string;
+  for (int i = 0; i < 64; ++i) {
+    repetitive_string += DATA_STRING;
+  }
+  const std::vector<std::uint8_t> repetitive_data {std::begin(repetitive_string), std::end(repetitive_string)};
+
+  const auto memory_persistence {std::make_shared<display_device::MemorySettingsPersistence>()};
+  display_device::CompressedSettingsPersistence persistence {memory_persistence};
+
+  EXPECT_TRUE(persistence.store(repetitive_data));
+  EXPECT_LT(memory_persistence->load()->size(), repetitive_data.size());
+  EXPECT_EQ(persistence.load(), repetitive_data);
+}
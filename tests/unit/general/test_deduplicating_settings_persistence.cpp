@@ -0,0 +1,154 @@
+// local includes
+#include "display_device/deduplicating_settings_persistence.h"
+#include "fixtures/fixtures.h"
+#include "fixtures/mock_settings_persistence.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+  using ::testing::InSequence;
+  using ::testing::Return;
+  using ::testing::StrictMock;
+
+  // Test fixture(s) for this file
+  class DeduplicatingSettingsPersistenceMocked: public BaseTest {
+  public:
+    display_device::DeduplicatingSettingsPersistence &getImpl() {
+      if (!m_impl) {
+        m_impl = std::make_unique<display_device::DeduplicatingSettingsPersistence>(m_settings_persistence_api);
+      }
+
+      return *m_impl;
+    }
+
+    std::shared_ptr<StrictMock<display_device::MockSettingsPersistence>> m_settings_persistence_api {std::make_shared<StrictMock<display_device::MockSettingsPersistence>>()};
+
+  private:
+    std::unique_ptr<display_device::DeduplicatingSettingsPersistence> m_impl;
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S_MOCKED(...) DD_MAKE_TEST(TEST_F, DeduplicatingSettingsPersistenceMocked, __VA_ARGS__)
+
+  // Additional convenience global const(s)
+  const std::vector<std::uint8_t> DATA_1 {'D', 'A', 'T', 'A', ' ', '1'};
+  const std::vector<std::uint8_t> DATA_2 {'D', 'A', 'T', 'A', ' ', '2'};
+}  // namespace
+
+TEST_F_S_MOCKED(NullptrPersistenceProvided) {
+  EXPECT_THAT([]() {
+    const display_device::DeduplicatingSettingsPersistence persistence {nullptr};
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Nullptr provided for SettingsPersistenceInterface in DeduplicatingSettingsPersistence!")));
+}
+
+TEST_F_S_MOCKED(Store, IdenticalDataSkipped) {
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_1))
+    .Times(1)
+    .WillOnce(Return(true));
+
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_EQ(getImpl().getStats(), (display_device::DeduplicatingSettingsPersistence::Stats {2, 1}));
+}
+
+TEST_F_S_MOCKED(Store, DifferentDataStored) {
+  InSequence sequence;
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_1))
+    .Times(1)
+    .WillOnce(Return(true))
+    .RetiresOnSaturation();
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_2))
+    .Times(1)
+    .WillOnce(Return(true))
+    .RetiresOnSaturation();
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_1))
+    .Times(1)
+    .WillOnce(Return(true))
+    .RetiresOnSaturation();
+
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_TRUE(getImpl().store(DATA_2));
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_EQ(getImpl().getStats(), (display_device::DeduplicatingSettingsPersistence::Stats {0, 3}));
+}
+
+TEST_F_S_MOCKED(Store, FailedStoreRetried) {
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_1))
+    .Times(2)
+    .WillOnce(Return(false))
+    .WillOnce(Return(true));
+
+  EXPECT_FALSE(getImpl().store(DATA_1));
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_EQ(getImpl().getStats(), (display_device::DeduplicatingSettingsPersistence::Stats {0, 2}));
+}
+
+TEST_F_S_MOCKED(Store, LoadedDataSkipped) {
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(DATA_1));
+
+  EXPECT_EQ(getImpl().load(), DATA_1);
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_EQ(getImpl().getStats(), (display_device::DeduplicatingSettingsPersistence::Stats {1, 0}));
+}
+
+TEST_F_S_MOCKED(Store, FailedLoadNotCached) {
+  InSequence sequence;
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_1))
+    .Times(1)
+    .WillOnce(Return(true))
+    .RetiresOnSaturation();
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(std::nullopt));
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_1))
+    .Times(1)
+    .WillOnce(Return(true))
+    .RetiresOnSaturation();
+
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_EQ(getImpl().load(), std::nullopt);
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_EQ(getImpl().getStats(), (display_device::DeduplicatingSettingsPersistence::Stats {0, 2}));
+}
+
+TEST_F_S_MOCKED(Clear, CachedDataForgotten) {
+  InSequence sequence;
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_1))
+    .Times(1)
+    .WillOnce(Return(true))
+    .RetiresOnSaturation();
+  EXPECT_CALL(*m_settings_persistence_api, clear())
+    .Times(1)
+    .WillOnce(Return(true));
+  EXPECT_CALL(*m_settings_persistence_api, store(DATA_1))
+    .Times(1)
+    .WillOnce(Return(true))
+    .RetiresOnSaturation();
+
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_TRUE(getImpl().clear());
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_EQ(getImpl().getStats(), (display_device::DeduplicatingSettingsPersistence::Stats {0, 2}));
+}
+
+TEST_F_S_MOCKED(Clear, FailedToClear) {
+  EXPECT_CALL(*m_settings_persistence_api, clear())
+    .Times(1)
+    .WillOnce(Return(false));
+
+  EXPECT_FALSE(getImpl().clear());
+}
+
+TEST_F_S_MOCKED(PrefersIntermediateStores) {
+  EXPECT_CALL(*m_settings_persistence_api, prefersIntermediateStores())
+    .Times(2)
+    .WillOnce(Return(true))
+    .WillOnce(Return(false));
+
+  EXPECT_TRUE(getImpl().prefersIntermediateStores());
+  EXPECT_FALSE(getImpl().prefersIntermediateStores());
+}
@@ -0,0 +1,133 @@
+// system includes
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
+
+// local includes
+#include "display_device/device_id.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, DeviceId, __VA_ARGS__)
+
+  // Additional convenience global const(s)
+  const std::string DEVICE_ID_1 {"{77f67f3e-754f-5d31-af64-ee037e18100a}"};
+  const std::string DEVICE_ID_2 {"{daeac860-f4db-5208-b1f5-cf59444fb768}"};
+}  // namespace
+
+TEST_S(Empty) {
+  const display_device::DeviceId id;
+  EXPECT_TRUE(id.empty());
+  EXPECT_EQ(id.getHandle(), 0);
+  EXPECT_EQ(id.str(), "");
+  EXPECT_EQ(id, display_device::DeviceId {""});
+  EXPECT_EQ(id, display_device::DeviceId {static_cast<const char *>(nullptr)});
+}
+
+TEST_S(Interning) {
+  const display_device::DeviceId id_1 {DEVICE_ID_1};
+  const display_device::DeviceId id_1_copy {std::string_view {DEVICE_ID_1}};
+  const display_device::DeviceId id_2 {DEVICE_ID_2.c_str()};
+
+  EXPECT_FALSE(id_1.empty());
+  EXPECT_EQ(id_1.getHandle(), id_1_copy.getHandle());
+  EXPECT_NE(id_1.getHandle(), id_2.getHandle());
+  EXPECT_EQ(id_1, id_1_copy);
+  EXPECT_NE(id_1, id_2);
+  EXPECT_EQ(&id_1.str(), &id_1_copy.str());
+  EXPECT_EQ(std::hash<display_device::DeviceId> {}(id_1), std::hash<display_device::DeviceId> {}(id_1_copy));
+}
+
+TEST_S(StringAdapters) {
+  const display_device::DeviceId id {DEVICE_ID_1};
+  const std::string &string {id};
+  EXPECT_EQ(string, DEVICE_ID_1);
+  EXPECT_EQ(id, DEVICE_ID_1);
+  EXPECT_EQ(DEVICE_ID_2, display_device::DeviceId {DEVICE_ID_2});
+
+  std::ostringstream stream;
+  stream << id;
+  EXPECT_EQ(stream.str(), DEVICE_ID_1);
+}
+
+TEST_S(Find) {
+  const display_device::DeviceId id {DEVICE_ID_1};
+  EXPECT_EQ(display_device::DeviceId::find(DEVICE_ID_1), id);
+  EXPECT_TRUE(display_device::DeviceId::find("").empty());
+}
+
+TEST_S(Find, DoesNotIntern) {
+  const std::string unknown_id {"FindDoesNotIntern"};
+  EXPECT_TRUE(display_device::DeviceId::find(unknown_id).empty());
+  EXPECT_TRUE(display_device::DeviceId::find(unknown_id).empty());
+
+  const display_device::DeviceId id {unknown_id};
+  EXPECT_FALSE(id.empty());
+  EXPECT_EQ(display_device::DeviceId::find(unknown_id), id);
+}
+
+TEST_S(CompareWithString) {
+  const display_device::DeviceId id {DEVICE_ID_1};
+  EXPECT_TRUE(id == std::string_view {DEVICE_ID_1});
+  EXPECT_FALSE(id == std::string_view {DEVICE_ID_2});
+  EXPECT_TRUE(display_device::DeviceId {} == std::string_view {});
+
+  const std::string unknown_id {"CompareWithStringDoesNotIntern"};
+  EXPECT_FALSE(id == unknown_id);
+  EXPECT_TRUE(display_device::DeviceId::find(unknown_id).empty());
+}
+
+TEST_S(Literal) {
+  using namespace display_device::literals;
+  EXPECT_EQ("DeviceIdLiteral"_id, display_device::DeviceId {"DeviceIdLiteral"});
+  EXPECT_TRUE(""_id.empty());
+}
+
+TEST_S(OrderedAsStrings) {
+  // Intern in the reverse order to make sure that the handles do not affect the ordering
+  const std::vector<std::string> strings {"DeviceId3", "DeviceId20", "DeviceId1", ""};
+  std::map<display_device::DeviceId, int> map;
+  for (const auto &string : strings) {
+    map[display_device::DeviceId {string}] = 0;
+  }
+
+  std::vector<std::string> sorted_strings {strings};
+  std::ranges::sort(sorted_strings);
+
+  std::vector<std::string> map_keys;
+  for (const auto &[key, value] : map) {
+    map_keys.push_back(key);
+  }
+  EXPECT_EQ(map_keys, sorted_strings);
+  EXPECT_TRUE(display_device::DeviceId {"DeviceId1"} < display_device::DeviceId {"DeviceId20"});
+  EXPECT_EQ(display_device::DeviceId {"DeviceId1"} <=> display_device::DeviceId {"DeviceId1"}, std::strong_ordering::equal);
+}
+
+TEST_S(ConcurrentInterning) {
+  constexpr int thread_count {4};
+  constexpr int id_count {1000};
+
+  std::vector<std::vector<std::uint32_t>> handles(thread_count);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < thread_count; ++i) {
+    threads.emplace_back([&handles, i]() {
+      for (int j = 0; j < id_count; ++j) {
+        handles[i].push_back(display_device::DeviceId {"ConcurrentId" + std::to_string(j)}.getHandle());
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (int i = 1; i < thread_count; ++i) {
+    EXPECT_EQ(handles[i], handles[0]);
+  }
+  EXPECT_EQ(std::unordered_set<std::uint32_t>(std::begin(handles[0]), std::end(handles[0])).size(), id_count);
+  for (int j = 0; j < id_count; ++j) {
+    EXPECT_EQ(display_device::DeviceId {"ConcurrentId" + std::to_string(j)}.str(), "ConcurrentId" + std::to_string(j));
+  }
+}
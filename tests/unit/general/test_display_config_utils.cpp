@@ -0,0 +1,336 @@
+// local includes
+#include "display_device/display_config_utils.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, DisplayConfigUtils, __VA_ARGS__)
+
+  // Convenience keywords
+  using namespace display_device::literals;
+
+  // Packed adapter ids must not be ambiguous
+  static_assert(display_device::packAdapterId({23, 1}) != display_device::packAdapterId({3, 12}));
+  static_assert(display_device::packAdapterId({0, -1}) == 0xFFFFFFFF00000000);
+
+  // Additional convenience global const(s)
+  const display_device::DisplayPath AVAILABLE_AND_ACTIVE_PATH {{}, 0, 0, true, true, std::nullopt};
+  const display_device::DisplayPath AVAILABLE_AND_INACTIVE_PATH {{}, 0, 0, true, false, std::nullopt};
+  const std::vector<display_device::DisplayPath> PATHS_WITH_SOURCE_IDS {
+    []() {
+      // Contains the following:
+      //    - 4 paths for the same adapter (1 active and 3 inactive)
+      //        Note: source ids are out of order which is OK
+      //    - 1 active path for a different adapter
+      //    - 2 inactive path for yet another different adapter
+      std::vector<display_device::DisplayPath> paths;
+
+      paths.push_back(AVAILABLE_AND_ACTIVE_PATH);
+      paths.back().m_adapter_id = {1, 1};
+      paths.back().m_source_id = 1;
+
+      paths.push_back(AVAILABLE_AND_ACTIVE_PATH);
+      paths.back().m_adapter_id = {2, 2};
+      paths.back().m_source_id = 0;
+
+      paths.push_back(AVAILABLE_AND_INACTIVE_PATH);
+      paths.back().m_adapter_id = {1, 1};
+      paths.back().m_source_id = 0;
+
+      paths.push_back(AVAILABLE_AND_INACTIVE_PATH);
+      paths.back().m_adapter_id = {3, 3};
+      paths.back().m_source_id = 4;
+
+      paths.push_back(AVAILABLE_AND_INACTIVE_PATH);
+      paths.back().m_adapter_id = {2, 2};
+      paths.back().m_source_id = 1;
+
+      paths.push_back(AVAILABLE_AND_INACTIVE_PATH);
+      paths.back().m_adapter_id = {1, 1};
+      paths.back().m_source_id = 0;
+
+      paths.push_back(AVAILABLE_AND_INACTIVE_PATH);
+      paths.back().m_adapter_id = {1, 1};
+      paths.back().m_source_id = 1;
+
+      return paths;
+    }()
+  };
+  const std::vector<std::optional<display_device::ValidatedDeviceInfo>> DEVICE_INFO_FOR_PATHS {
+    display_device::ValidatedDeviceInfo {"Path1", "DeviceId1"},
+    display_device::ValidatedDeviceInfo {"Path2", "DeviceId2"},
+    display_device::ValidatedDeviceInfo {"Path1", "DeviceId1"},
+    display_device::ValidatedDeviceInfo {"Path3", "DeviceId3"},
+    display_device::ValidatedDeviceInfo {"Path2", "DeviceId2"},
+    display_device::ValidatedDeviceInfo {"Path4", "DeviceId4"},
+    display_device::ValidatedDeviceInfo {"Path4", "DeviceId4"}
+  };
+  const display_device::PathSourceIndexDataMap EXPECTED_SOURCE_INDEX_DATA {
+    {"DeviceId1"_id, {{{0, 2}, {1, 0}}, {1, 1}, {1}}},
+    {"DeviceId2"_id, {{{0, 1}, {1, 4}}, {2, 2}, {0}}},
+    {"DeviceId3"_id, {{{4, 3}}, {3, 3}, std::nullopt}},
+    {"DeviceId4"_id, {{{0, 5}, {1, 6}}, {1, 1}, std::nullopt}}
+  };
+
+  // Helper functions
+  display_device::DeviceInfoResolver makeResolver(const std::vector<std::optional<display_device::ValidatedDeviceInfo>> &device_info, std::size_t *call_count = nullptr) {
+    return [&device_info, call_count](const std::size_t path_index) {
+      if (call_count) {
+        ++(*call_count);
+      }
+      return device_info.at(path_index);
+    };
+  }
+
+  display_device::DisplayConfigData makeActiveConfig(const std::vector<display_device::Point> &positions) {
+    display_device::DisplayConfigData data;
+    for (const auto &position : positions) {
+      data.m_paths.push_back(AVAILABLE_AND_ACTIVE_PATH);
+      data.m_paths.back().m_source_mode_index = static_cast<std::uint32_t>(data.m_source_modes.size() + 1);
+
+      // Source modes are interleaved with the non-source ones
+      data.m_source_modes.emplace_back(std::nullopt);
+      data.m_source_modes.emplace_back(display_device::DisplaySourceMode {position, {1920, 1080}});
+    }
+    return data;
+  }
+
+  std::vector<std::optional<display_device::ValidatedDeviceInfo>> makeDeviceInfo(const std::size_t count) {
+    std::vector<std::optional<display_device::ValidatedDeviceInfo>> device_info;
+    for (std::size_t i = 1; i <= count; ++i) {
+      device_info.emplace_back(display_device::ValidatedDeviceInfo {"Path" + std::to_string(i), "DeviceId" + std::to_string(i)});
+    }
+    return device_info;
+  }
+}  // namespace
+
+TEST_S(GetSourceMode) {
+  using display_device::config_utils::getSourceMode;
+
+  const std::vector<std::optional<display_device::DisplaySourceMode>> modes {std::nullopt, display_device::DisplaySourceMode {{1, 2}, {3, 4}}};
+  auto path {AVAILABLE_AND_ACTIVE_PATH};
+
+  path.m_source_mode_index = 1;
+  ASSERT_NE(getSourceMode(path, modes), nullptr);
+  EXPECT_EQ(*getSourceMode(path, modes), (display_device::DisplaySourceMode {{1, 2}, {3, 4}}));
+
+  path.m_source_mode_index = 0;
+  EXPECT_EQ(getSourceMode(path, modes), nullptr);
+
+  path.m_source_mode_index = 2;
+  EXPECT_EQ(getSourceMode(path, modes), nullptr);
+
+  path.m_source_mode_index = std::nullopt;
+  EXPECT_EQ(getSourceMode(path, modes), nullptr);
+}
+
+TEST_S(GetDeviceInfoForValidPath) {
+  using display_device::config_utils::getDeviceInfoForValidPath;
+  using enum display_device::ValidatedPathType;
+
+  std::vector<display_device::DisplayPath> paths {AVAILABLE_AND_ACTIVE_PATH, AVAILABLE_AND_INACTIVE_PATH, AVAILABLE_AND_ACTIVE_PATH};
+  paths.at(2).m_available = false;
+
+  std::size_t call_count {0};
+  const auto device_info {makeDeviceInfo(3)};
+  const auto resolver {makeResolver(device_info, &call_count)};
+  EXPECT_EQ(getDeviceInfoForValidPath(paths, 0, Active, resolver)->m_device_id, "DeviceId1");
+  EXPECT_EQ(getDeviceInfoForValidPath(paths, 1, Active, resolver), std::nullopt);
+  EXPECT_EQ(getDeviceInfoForValidPath(paths, 1, Any, resolver)->m_device_id, "DeviceId2");
+  EXPECT_EQ(getDeviceInfoForValidPath(paths, 2, Any, resolver), std::nullopt);
+
+  // The resolver is only called for the paths that passed the other checks
+  EXPECT_EQ(call_count, 2);
+}
+
+TEST_S(GetActivePathIndex) {
+  using display_device::config_utils::getActivePathIndex;
+
+  const auto device_info {makeDeviceInfo(7)};
+  EXPECT_EQ(getActivePathIndex(PATHS_WITH_SOURCE_IDS, "DeviceId2"_id, makeResolver(device_info)), 1);
+  EXPECT_EQ(getActivePathIndex(PATHS_WITH_SOURCE_IDS, "DeviceId3"_id, makeResolver(device_info)), std::nullopt);
+  EXPECT_EQ(getActivePathIndex(PATHS_WITH_SOURCE_IDS, "DeviceIdX"_id, makeResolver(device_info)), std::nullopt);
+}
+
+TEST_S(CollectSourceDataForMatchingPaths) {
+  using display_device::config_utils::collectSourceDataForMatchingPaths;
+
+  EXPECT_EQ(collectSourceDataForMatchingPaths(PATHS_WITH_SOURCE_IDS, makeResolver(DEVICE_INFO_FOR_PATHS)), EXPECTED_SOURCE_INDEX_DATA);
+}
+
+TEST_S(CollectSourceDataForMatchingPaths, TransientPathIssues) {
+  using display_device::config_utils::collectSourceDataForMatchingPaths;
+
+  auto device_info {DEVICE_INFO_FOR_PATHS};
+  device_info.at(3) = std::nullopt;
+
+  auto expected_data {EXPECTED_SOURCE_INDEX_DATA};
+  expected_data.erase("DeviceId3"_id);
+
+  EXPECT_EQ(collectSourceDataForMatchingPaths(PATHS_WITH_SOURCE_IDS, makeResolver(device_info)), expected_data);
+}
+
+TEST_S(CollectSourceDataForMatchingPaths, DuplicatePathsWithDifferentIds) {
+  using display_device::config_utils::collectSourceDataForMatchingPaths;
+
+  auto device_info {DEVICE_INFO_FOR_PATHS};
+  device_info.at(1)->m_device_path = "Path1";
+
+  EXPECT_EQ(collectSourceDataForMatchingPaths(PATHS_WITH_SOURCE_IDS, makeResolver(device_info)), display_device::PathSourceIndexDataMap {});
+}
+
+TEST_S(CollectSourceDataForMatchingPaths, DifferentPathsWithSameId) {
+  using display_device::config_utils::collectSourceDataForMatchingPaths;
+
+  auto device_info {DEVICE_INFO_FOR_PATHS};
+  device_info.at(2)->m_device_path = "Path3";
+
+  EXPECT_EQ(collectSourceDataForMatchingPaths(PATHS_WITH_SOURCE_IDS, makeResolver(device_info)), display_device::PathSourceIndexDataMap {});
+}
+
+TEST_S(CollectSourceDataForMatchingPaths, MismatchingAdapterIdsForPaths) {
+  using display_device::config_utils::collectSourceDataForMatchingPaths;
+
+  auto paths {PATHS_WITH_SOURCE_IDS};
+  paths.at(2).m_adapter_id.m_high_part++;
+  EXPECT_EQ(collectSourceDataForMatchingPaths(paths, makeResolver(DEVICE_INFO_FOR_PATHS)), display_device::PathSourceIndexDataMap {});
+
+  paths = PATHS_WITH_SOURCE_IDS;
+  paths.at(2).m_adapter_id.m_low_part++;
+  EXPECT_EQ(collectSourceDataForMatchingPaths(paths, makeResolver(DEVICE_INFO_FOR_PATHS)), display_device::PathSourceIndexDataMap {});
+}
+
+TEST_S(CollectSourceDataForMatchingPaths, ActiveDeviceNotFirst) {
+  using display_device::config_utils::collectSourceDataForMatchingPaths;
+
+  auto paths {PATHS_WITH_SOURCE_IDS};
+  std::swap(paths.at(0), paths.at(2));
+
+  EXPECT_EQ(collectSourceDataForMatchingPaths(paths, makeResolver(DEVICE_INFO_FOR_PATHS)), display_device::PathSourceIndexDataMap {});
+}
+
+TEST_S(CollectSourceDataForMatchingPaths, DuplicateSourceIds) {
+  using display_device::config_utils::collectSourceDataForMatchingPaths;
+
+  auto paths {PATHS_WITH_SOURCE_IDS};
+  paths.at(0).m_source_id = paths.at(2).m_source_id;
+
+  EXPECT_EQ(collectSourceDataForMatchingPaths(paths, makeResolver(DEVICE_INFO_FOR_PATHS)), display_device::PathSourceIndexDataMap {});
+}
+
+TEST_S(CollectSourceDataForMatchingPaths, EmptyList) {
+  using display_device::config_utils::collectSourceDataForMatchingPaths;
+
+  EXPECT_EQ(collectSourceDataForMatchingPaths({}, makeResolver(DEVICE_INFO_FOR_PATHS)), display_device::PathSourceIndexDataMap {});
+}
+
+TEST_S(MakePathsForNewTopology) {
+  using display_device::config_utils::makePathsForNewTopology;
+
+  const display_device::ActiveTopology new_topology {{"DeviceId1"_id}, {"DeviceId2"_id}, {"DeviceId3"_id, "DeviceId4"_id}};
+  const std::vector<display_device::TopologyPath> expected_paths {{0, 0}, {1, 1}, {3, 2}, {5, 2}};
+
+  EXPECT_EQ(makePathsForNewTopology(new_topology, EXPECTED_SOURCE_INDEX_DATA, PATHS_WITH_SOURCE_IDS.size()), expected_paths);
+}
+
+TEST_S(MakePathsForNewTopology, DevicesFromSameAdapterInAGroup) {
+  using display_device::config_utils::makePathsForNewTopology;
+
+  const display_device::ActiveTopology new_topology {{"DeviceId1"_id, "DeviceId4"_id}};
+  const std::vector<display_device::TopologyPath> expected_paths {{0, 0}, {6, 0}};
+
+  EXPECT_EQ(makePathsForNewTopology(new_topology, EXPECTED_SOURCE_INDEX_DATA, PATHS_WITH_SOURCE_IDS.size()), expected_paths);
+}
+
+TEST_S(MakePathsForNewTopology, UnknownDeviceInNewTopology) {
+  using display_device::config_utils::makePathsForNewTopology;
+
+  const display_device::ActiveTopology new_topology {{"DeviceIdX"_id, "DeviceId4"_id}};
+  EXPECT_EQ(makePathsForNewTopology(new_topology, EXPECTED_SOURCE_INDEX_DATA, PATHS_WITH_SOURCE_IDS.size()), std::vector<display_device::TopologyPath> {});
+}
+
+TEST_S(MakePathsForNewTopology, MissingPathsForDuplicatedDisplays) {
+  using display_device::config_utils::makePathsForNewTopology;
+
+  // For the same adapter, only devices with matching source ids can be grouped (duplicated).
+  const display_device::ActiveTopology new_topology {{"DeviceId1"_id, "DeviceId2"_id}};
+  const display_device::PathSourceIndexDataMap path_source_data {
+    {"DeviceId1"_id, {{{0, 0}}, {1, 1}, {0}}},
+    {"DeviceId2"_id, {{{1, 1}}, {1, 1}, std::nullopt}}
+  };
+
+  EXPECT_EQ(makePathsForNewTopology(new_topology, path_source_data, 2), std::vector<display_device::TopologyPath> {});
+}
+
+TEST_S(MakePathsForNewTopology, NoFreeSourceIds) {
+  using display_device::config_utils::makePathsForNewTopology;
+
+  // Both devices can only use the same source id, so they cannot be extended.
+  const display_device::ActiveTopology new_topology {{"DeviceId1"_id}, {"DeviceId2"_id}};
+  const display_device::PathSourceIndexDataMap path_source_data {
+    {"DeviceId1"_id, {{{0, 0}}, {1, 1}, {0}}},
+    {"DeviceId2"_id, {{{0, 1}}, {1, 1}, std::nullopt}}
+  };
+
+  EXPECT_EQ(makePathsForNewTopology(new_topology, path_source_data, 2), std::vector<display_device::TopologyPath> {});
+}
+
+TEST_S(MakePathsForNewTopology, SimilarAdapterIds) {
+  using display_device::config_utils::makePathsForNewTopology;
+
+  // The adapters would be indistinguishable if the high and low parts were simply concatenated as strings
+  const display_device::ActiveTopology new_topology {{"DeviceId1"_id}, {"DeviceId2"_id}};
+  const display_device::PathSourceIndexDataMap path_source_data {
+    {"DeviceId1"_id, {{{0, 0}}, {23, 1}, {0}}},
+    {"DeviceId2"_id, {{{0, 1}}, {3, 12}, std::nullopt}}
+  };
+  const std::vector<display_device::TopologyPath> expected_paths {{0, 0}, {1, 1}};
+
+  EXPECT_EQ(makePathsForNewTopology(new_topology, path_source_data, 2), expected_paths);
+}
+
+TEST_S(MakePathsForNewTopology, IndexOutOfRange) {
+  using display_device::config_utils::makePathsForNewTopology;
+
+  const display_device::ActiveTopology new_topology {{"DeviceId1"_id}};
+  EXPECT_EQ(makePathsForNewTopology(new_topology, EXPECTED_SOURCE_INDEX_DATA, 0), std::vector<display_device::TopologyPath> {});
+}
+
+TEST_S(GetAllDeviceIdsAndMatchingDuplicates) {
+  using display_device::config_utils::getAllDeviceIdsAndMatchingDuplicates;
+
+  const auto active_config {makeActiveConfig({{0, 0}, {1920, 0}, {0, 0}, {1920, 0}, {3840, 0}})};
+  const auto device_info {makeDeviceInfo(5)};
+
+  EXPECT_EQ(getAllDeviceIdsAndMatchingDuplicates(active_config, {"DeviceId1"_id}, makeResolver(device_info)), (display_device::DeviceIdSet {"DeviceId1"_id, "DeviceId3"_id}));
+  EXPECT_EQ(getAllDeviceIdsAndMatchingDuplicates(active_config, {"DeviceId4"_id, "DeviceId5"_id}, makeResolver(device_info)), (display_device::DeviceIdSet {"DeviceId2"_id, "DeviceId4"_id, "DeviceId5"_id}));
+}
+
+TEST_S(GetAllDeviceIdsAndMatchingDuplicates, EmptyId) {
+  using display_device::config_utils::getAllDeviceIdsAndMatchingDuplicates;
+
+  const auto active_config {makeActiveConfig({{0, 0}})};
+  const auto device_info {makeDeviceInfo(1)};
+  EXPECT_EQ(getAllDeviceIdsAndMatchingDuplicates(active_config, {display_device::DeviceId {}}, makeResolver(device_info)), display_device::DeviceIdSet {});
+}
+
+TEST_S(GetAllDeviceIdsAndMatchingDuplicates, DeviceNotFound) {
+  using display_device::config_utils::getAllDeviceIdsAndMatchingDuplicates;
+
+  const auto active_config {makeActiveConfig({{0, 0}})};
+  const auto device_info {makeDeviceInfo(1)};
+  EXPECT_EQ(getAllDeviceIdsAndMatchingDuplicates(active_config, {"DeviceIdX"_id}, makeResolver(device_info)), display_device::DeviceIdSet {});
+}
+
+TEST_S(GetAllDeviceIdsAndMatchingDuplicates, MissingSourceMode) {
+  using display_device::config_utils::getAllDeviceIdsAndMatchingDuplicates;
+
+  auto active_config {makeActiveConfig({{0, 0}, {1920, 0}})};
+  const auto device_info {makeDeviceInfo(2)};
+  active_config.m_paths.at(0).m_source_mode_index = 0;
+  EXPECT_EQ(getAllDeviceIdsAndMatchingDuplicates(active_config, {"DeviceId1"_id}, makeResolver(device_info)), display_device::DeviceIdSet {});
+
+  active_config = makeActiveConfig({{0, 0}, {1920, 0}});
+  active_config.m_paths.at(1).m_source_mode_index = std::nullopt;
+  EXPECT_EQ(getAllDeviceIdsAndMatchingDuplicates(active_config, {"DeviceId1"_id}, makeResolver(device_info)), display_device::DeviceIdSet {});
+}
@@ -0,0 +1,126 @@
+// system includes
+#include <gmock/gmock.h>
+#include <thread>
+
+// local includes
+#include "display_device/edid_cache.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, EdidCache, __VA_ARGS__)
+
+  /**
+   * @brief Make a valid EDID with a different serial number.
+   */
+  std::vector<std::byte> makeEdid(const std::uint8_t serial_number) {
+    auto edid {ut_consts::DEFAULT_EDID};
+    const auto difference {static_cast<int>(serial_number) - static_cast<int>(edid[12])};
+    edid[12] = std::byte {serial_number};
+    edid[127] = std::byte {static_cast<std::uint8_t>(static_cast<int>(edid[127]) - difference)};
+    return edid;
+  }
+}  // namespace
+
+TEST_S(ZeroCapacity) {
+  EXPECT_THAT([]() {
+    const display_device::EdidCache cache {0};
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Capacity provided in EdidCache must be larger than 0!")));
+}
+
+TEST_S(Parse, HitsAndMisses) {
+  display_device::EdidCache cache;
+
+  EXPECT_EQ(cache.parse(ut_consts::DEFAULT_EDID), ut_consts::DEFAULT_EDID_DATA);
+  EXPECT_EQ(cache.parse(ut_consts::DEFAULT_EDID), ut_consts::DEFAULT_EDID_DATA);
+  EXPECT_EQ(cache.parse(ut_consts::DEFAULT_EDID), ut_consts::DEFAULT_EDID_DATA);
+  EXPECT_EQ(cache.getStats(), (display_device::EdidCache::Stats {2, 1, 0}));
+  EXPECT_EQ(cache.size(), 1);
+}
+
+TEST_S(Parse, DifferentData) {
+  display_device::EdidCache cache;
+  const auto edid_1 {makeEdid(1)};
+  const auto edid_2 {makeEdid(2)};
+
+  EXPECT_EQ(cache.parse(edid_1), display_device::EdidData::parse(edid_1));
+  EXPECT_EQ(cache.parse(edid_2), display_device::EdidData::parse(edid_2));
+  EXPECT_NE(cache.parse(edid_1), cache.parse(edid_2));
+  EXPECT_EQ(cache.getStats(), (display_device::EdidCache::Stats {2, 2, 0}));
+  EXPECT_EQ(cache.size(), 2);
+}
+
+TEST_S(Parse, InvalidDataCached) {
+  display_device::EdidCache cache;
+  auto invalid_edid {ut_consts::DEFAULT_EDID};
+  invalid_edid[1] = std::byte {0xAA};
+
+  EXPECT_EQ(cache.parse(invalid_edid), std::nullopt);
+  EXPECT_EQ(cache.parse(invalid_edid), std::nullopt);
+  EXPECT_EQ(cache.getStats(), (display_device::EdidCache::Stats {1, 1, 0}));
+}
+
+TEST_S(Parse, EmptyDataNotCached) {
+  display_device::EdidCache cache;
+
+  EXPECT_EQ(cache.parse({}), std::nullopt);
+  EXPECT_EQ(cache.getStats(), (display_device::EdidCache::Stats {0, 0, 0}));
+  EXPECT_EQ(cache.size(), 0);
+}
+
+TEST_S(Parse, LeastRecentlyUsedEvicted) {
+  display_device::EdidCache cache {2};
+  const auto edid_1 {makeEdid(1)};
+  const auto edid_2 {makeEdid(2)};
+  const auto edid_3 {makeEdid(3)};
+
+  static_cast<void>(cache.parse(edid_1));
+  static_cast<void>(cache.parse(edid_2));
+  static_cast<void>(cache.parse(edid_1));  // edid_2 is now the least recently used
+  static_cast<void>(cache.parse(edid_3));
+  EXPECT_EQ(cache.getStats(), (display_device::EdidCache::Stats {1, 3, 1}));
+  EXPECT_EQ(cache.size(), 2);
+
+  static_cast<void>(cache.parse(edid_1));
+  static_cast<void>(cache.parse(edid_3));
+  EXPECT_EQ(cache.getStats(), (display_device::EdidCache::Stats {3, 3, 1}));
+
+  static_cast<void>(cache.parse(edid_2));
+  EXPECT_EQ(cache.getStats(), (display_device::EdidCache::Stats {3, 4, 2}));
+}
+
+TEST_S(Clear) {
+  display_device::EdidCache cache;
+
+  static_cast<void>(cache.parse(ut_consts::DEFAULT_EDID));
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+
+  EXPECT_EQ(cache.parse(ut_consts::DEFAULT_EDID), ut_consts::DEFAULT_EDID_DATA);
+  EXPECT_EQ(cache.getStats(), (display_device::EdidCache::Stats {0, 2, 0}));
+}
+
+TEST_S(ConcurrentAccess) {
+  display_device::EdidCache cache {4};
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&cache, i]() {
+      for (int j = 0; j < 100; ++j) {
+        const auto edid {makeEdid(static_cast<std::uint8_t>((i + j) % 8))};
+        EXPECT_EQ(cache.parse(edid), display_device::EdidData::parse(edid));
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  const auto stats {cache.getStats()};
+  EXPECT_EQ(stats.m_hits + stats.m_misses, 400);
+  EXPECT_LE(cache.size(), 4);
+}
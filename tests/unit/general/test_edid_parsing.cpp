@@ -1,14 +1,73 @@
 // local includes
+#include "display_device/detail/edid_decoder.h"
 #include "display_device/types.h"
 #include "fixtures/fixtures.h"
 
 namespace {
   // Specialized TEST macro(s) for this test file
 #define TEST_S(...) DD_MAKE_TEST(TEST, EdidParsing, __VA_ARGS__)
+
+  template<typename... Ts>
+  std::vector<std::byte> makeBytes(Ts &&...args) {
+    return {std::byte {static_cast<std::uint8_t>(args)}...};
+  }
+
+  // Additional convenience global const(s)
+  // TV with a CTA-861 extension block (HDR static metadata, HDMI Forum VRR range, 1080p/1080i timings)
+  const std::vector<std::byte> CTA_EDID {makeBytes(
+    // clang-format off
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1E, 0x6D, 0x0A, 0x5B, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x20, 0x01, 0x04, 0xB5, 0x3C, 0x22, 0x78, 0x9F, 0x8E, 0xA5, 0xAE, 0x4F, 0x46, 0x9C, 0x23,
+    0x10, 0x50, 0x54, 0x21, 0x08, 0x00, 0xD1, 0xC0, 0x81, 0xC0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0xE8, 0x00, 0x30, 0xF2, 0x70, 0x5A, 0x80, 0x58, 0x2C,
+    0x45, 0x00, 0x40, 0x84, 0x63, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x18, 0x78, 0x1E,
+    0x87, 0x3C, 0x01, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x4C,
+    0x47, 0x20, 0x54, 0x56, 0x20, 0x53, 0x53, 0x43, 0x52, 0x32, 0x0A, 0x20, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0E,
+    0x02, 0x03, 0x1F, 0xF0, 0x44, 0x90, 0x04, 0x10, 0x61, 0x6A, 0xD8, 0x5D, 0xC4, 0x01, 0x78, 0x80,
+    0x00, 0x20, 0x28, 0x78, 0xE6, 0x06, 0x0D, 0x01, 0x60, 0x40, 0x20, 0xE3, 0x05, 0xC0, 0x00, 0x02,
+    0x3A, 0x80, 0x18, 0x71, 0x38, 0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00, 0x40, 0x84, 0x63, 0x00, 0x00,
+    0x1E, 0x01, 0x1D, 0x80, 0x18, 0x71, 0x1C, 0x16, 0x20, 0x58, 0x2C, 0x45, 0x00, 0x40, 0x84, 0x63,
+    0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26
+    // clang-format on
+  )};
+
+  // Monitor without base block timings and name, providing them in the DisplayID extension block instead
+  const std::vector<std::byte> DISPLAYID_EDID {makeBytes(
+    // clang-format off
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 0xAC, 0xA2, 0x41, 0x30, 0x5A, 0x4B, 0x4C,
+    0x01, 0x20, 0x01, 0x04, 0xB5, 0x3C, 0x22, 0x78, 0x9F, 0x8E, 0xA5, 0xAE, 0x4F, 0x46, 0x9C, 0x23,
+    0x10, 0x50, 0x54, 0x21, 0x08, 0x00, 0xD1, 0xC0, 0x81, 0xC0, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x41, 0x42, 0x43, 0x31, 0x32,
+    0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB0,
+    0x70, 0x12, 0x45, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x34, 0x12, 0x01, 0x00, 0x00,
+    0x00, 0x0A, 0x1E, 0x0B, 0x44, 0x49, 0x44, 0x20, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x03,
+    0x00, 0x28, 0x55, 0x5E, 0x00, 0x04, 0xFF, 0x09, 0x9F, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x9F, 0x05,
+    0x28, 0x00, 0x02, 0x00, 0x04, 0x00, 0x4C, 0xD0, 0x00, 0x84, 0xFF, 0x0E, 0x9F, 0x00, 0x2F, 0x00,
+    0x1F, 0x00, 0x6F, 0x08, 0x3D, 0x00, 0x02, 0x00, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90
+    // clang-format on
+  )};
+  void fixChecksum(std::vector<std::byte> &data, const std::size_t block_index) {
+    int sum {0};
+    for (std::size_t i = block_index * 128; i < block_index * 128 + 127; ++i) {
+      sum += static_cast<int>(data[i]);
+    }
+    data[block_index * 128 + 127] = std::byte {static_cast<std::uint8_t>(256 - sum % 256)};
+  }
 }  // namespace
 
 TEST_S(NoData) {
-  EXPECT_EQ(display_device::EdidData::parse({}), std::nullopt);
+  EXPECT_EQ(display_device::EdidData::parse(std::vector<std::byte> {}), std::nullopt);
+  EXPECT_EQ(display_device::EdidData::parse(std::span<const std::byte> {}), std::nullopt);
 }
 
 TEST_S(TooLittleData) {
@@ -46,3 +105,200 @@ TEST_S(InvalidManufacturerId, AboveLimit) {
 TEST_S(ValidOutput) {
   EXPECT_EQ(display_device::EdidData::parse(ut_consts::DEFAULT_EDID), ut_consts::DEFAULT_EDID_DATA);
 }
+
+TEST_S(ValidOutput, SpanOverload) {
+  // EDID located in the middle of a larger buffer
+  std::vector<std::byte> buffer(16, std::byte {0xAA});
+  buffer.insert(std::end(buffer), std::begin(CTA_EDID), std::end(CTA_EDID));
+  buffer.resize(buffer.size() + 16, std::byte {0xAA});
+
+  const std::span<const std::byte> edid_view {buffer.data() + 16, CTA_EDID.size()};
+  EXPECT_EQ(display_device::EdidData::parse(edid_view), display_device::EdidData::parse(CTA_EDID));
+  EXPECT_EQ(display_device::EdidData::parse(std::span<const std::byte> {ut_consts::DEFAULT_EDID}), ut_consts::DEFAULT_EDID_DATA);
+}
+
+TEST_S(FormatHex16) {
+  static_assert(std::string_view {display_device::detail::formatHex16(0x27EC).data(), 4} == "27EC");
+  EXPECT_EQ(std::string_view(display_device::detail::formatHex16(0x0000).data(), 4), "0000");
+  EXPECT_EQ(std::string_view(display_device::detail::formatHex16(0x00AF).data(), 4), "00AF");
+  EXPECT_EQ(std::string_view(display_device::detail::formatHex16(0xFFFF).data(), 4), "FFFF");
+}
+
+TEST_S(ValidOutput, CtaExtension) {
+  const display_device::EdidData::Timing timing_2160p {{3840, 2160}, {60000, 1000}, 594000, false};
+  const display_device::EdidData::Timing timing_1080p {{1920, 1080}, {60000, 1000}, 148500, false};
+  const display_device::EdidData::Timing timing_1080i {{1920, 1080}, {60053, 1000}, 74250, true};
+
+  const auto edid {display_device::EdidData::parse(CTA_EDID)};
+  ASSERT_TRUE(edid);
+  EXPECT_EQ(edid->m_manufacturer_id, "GSM");
+  EXPECT_EQ(edid->m_product_code, "5B0A");
+  EXPECT_EQ(edid->m_serial_number, 16843009);
+  EXPECT_EQ(edid->m_monitor_name, "LG TV SSCR2");
+  EXPECT_EQ(edid->m_preferred_timing, timing_2160p);
+  EXPECT_EQ(edid->m_detailed_timings, (std::vector {timing_2160p, timing_1080p, timing_1080i}));
+  EXPECT_EQ(edid->m_hdr_static_metadata, (display_device::EdidData::HdrStaticMetadata {true, false, true, true, 400., 200., 400. * (32. / 255.) * (32. / 255.) / 100.}));
+  EXPECT_EQ(edid->m_refresh_rate_range, (display_device::EdidData::RefreshRateRange {24, 120}));
+  EXPECT_EQ(edid->m_vrr_range, (display_device::EdidData::RefreshRateRange {40, 120}));
+  EXPECT_EQ(edid->m_video_modes, (std::vector<display_device::EdidData::VideoMode> {
+                                   {{640, 480}, {60, 1}},
+                                   {{800, 600}, {60, 1}},
+                                   {{1024, 768}, {60, 1}},
+                                   {{1920, 1080}, {60, 1}},
+                                   {{1280, 720}, {60, 1}},
+                                   // Only the CTA-861 VICs have the 1000/1001 variants
+                                   {{1920, 1080}, {60000, 1001}},
+                                   {{1280, 720}, {60000, 1001}},
+                                   {{3840, 2160}, {60, 1}},
+                                   {{3840, 2160}, {60000, 1001}},
+                                 }));
+  EXPECT_TRUE(edid->m_modes_complete);
+}
+
+TEST_S(ValidOutput, DisplayIdExtension) {
+  const display_device::EdidData::Timing timing_1440p {{2560, 1440}, {59951, 1000}, 241500, false};
+  const display_device::EdidData::Timing timing_2160p {{3840, 2160}, {59997, 1000}, 533250, false};
+
+  const auto edid {display_device::EdidData::parse(DISPLAYID_EDID)};
+  ASSERT_TRUE(edid);
+  EXPECT_EQ(edid->m_manufacturer_id, "DEL");
+  EXPECT_EQ(edid->m_monitor_name, "DID Monitor");
+  EXPECT_EQ(edid->m_preferred_timing, timing_2160p);
+  EXPECT_EQ(edid->m_detailed_timings, (std::vector {timing_1440p, timing_2160p}));
+  EXPECT_EQ(edid->m_hdr_static_metadata, std::nullopt);
+  EXPECT_EQ(edid->m_refresh_rate_range, std::nullopt);
+  EXPECT_EQ(edid->m_vrr_range, std::nullopt);
+  EXPECT_EQ(edid->m_video_modes.size(), 5);
+  EXPECT_TRUE(edid->m_modes_complete);
+}
+
+TEST_S(ValidOutput, MissingExtensionBlock) {
+  auto EDID_DATA {CTA_EDID};
+  EDID_DATA.resize(128);
+
+  const auto edid {display_device::EdidData::parse(EDID_DATA)};
+  ASSERT_TRUE(edid);
+  EXPECT_FALSE(edid->m_modes_complete);
+  EXPECT_EQ(edid->m_detailed_timings.size(), 1);
+  EXPECT_EQ(edid->m_hdr_static_metadata, std::nullopt);
+  EXPECT_EQ(edid->m_vrr_range, std::nullopt);
+}
+
+TEST_S(ValidOutput, BadExtensionChecksumSkipped) {
+  auto EDID_DATA {CTA_EDID};
+  EDID_DATA[255] = EDID_DATA[255] ^ std::byte {0xFF};
+
+  const auto edid {display_device::EdidData::parse(EDID_DATA)};
+  ASSERT_TRUE(edid);
+  EXPECT_EQ(edid->m_monitor_name, "LG TV SSCR2");
+  EXPECT_EQ(edid->m_detailed_timings.size(), 1);
+  EXPECT_EQ(edid->m_hdr_static_metadata, std::nullopt);
+  EXPECT_FALSE(edid->m_modes_complete);
+}
+
+TEST_S(ValidOutput, UnsupportedVideoModeIncomplete) {
+  auto EDID_DATA {CTA_EDID};
+  // Replace the VIC 97 with a reserved value
+  EDID_DATA[128 + 8] = std::byte {0xFF};
+  fixChecksum(EDID_DATA, 1);
+
+  const auto edid {display_device::EdidData::parse(EDID_DATA)};
+  ASSERT_TRUE(edid);
+  EXPECT_FALSE(edid->m_modes_complete);
+  EXPECT_EQ(edid->m_video_modes.size(), 7);
+}
+
+TEST_S(ValidOutput, StandardTimingAspectRatios) {
+  auto EDID_DATA {ut_consts::DEFAULT_EDID};
+  // 1280x800 (16:10), 1280x960 (4:3), 1280x1024 (5:4) and 1280x720 (16:9) at 75 Hz
+  for (std::size_t i = 0; i < 4; ++i) {
+    EDID_DATA[38 + i * 2] = std::byte {0x81};
+    EDID_DATA[39 + i * 2] = std::byte {static_cast<std::uint8_t>((i << 6) | 15)};
+  }
+  fixChecksum(EDID_DATA, 0);
+
+  const auto edid {display_device::EdidData::parse(EDID_DATA)};
+  ASSERT_TRUE(edid);
+  // The first modes are from the established timings
+  ASSERT_EQ(edid->m_video_modes.size(), 7);
+  EXPECT_EQ(std::vector(std::begin(edid->m_video_modes) + 3, std::end(edid->m_video_modes)), (std::vector<display_device::EdidData::VideoMode> {
+                                                                                              {{1280, 800}, {75, 1}},
+                                                                                              {{1280, 960}, {75, 1}},
+                                                                                              {{1280, 1024}, {75, 1}},
+                                                                                              {{1280, 720}, {75, 1}},
+                                                                                            }));
+}
+
+TEST_S(ValidOutput, MalformedCtaDataBlockSkipped) {
+  auto EDID_DATA {CTA_EDID};
+  // Make the first data block exceed the data block collection
+  EDID_DATA[128 + 4] = std::byte {0x5F};
+  fixChecksum(EDID_DATA, 1);
+
+  const auto edid {display_device::EdidData::parse(EDID_DATA)};
+  ASSERT_TRUE(edid);
+  EXPECT_EQ(edid->m_hdr_static_metadata, std::nullopt);
+  EXPECT_EQ(edid->m_vrr_range, std::nullopt);
+  EXPECT_EQ(edid->m_detailed_timings.size(), 3);
+}
+
+TEST_S(ValidOutput, SplitMonitorName) {
+  auto EDID_DATA {ut_consts::DEFAULT_EDID};
+  // Replace the serial number descriptor with the first part of the name
+  const std::string name_part {"Long Name - "};
+  EDID_DATA[75] = std::byte {0xFC};
+  for (std::size_t i = 0; i < 13; ++i) {
+    EDID_DATA[77 + i] = std::byte {static_cast<std::uint8_t>(i < name_part.size() ? name_part[i] : '\n')};
+  }
+  fixChecksum(EDID_DATA, 0);
+
+  const auto edid {display_device::EdidData::parse(EDID_DATA)};
+  ASSERT_TRUE(edid);
+  EXPECT_EQ(edid->m_monitor_name, "Long Name - ROG PG279Q");
+}
+
+TEST_S(ValidOutput, NonAsciiMonitorNameFiltered) {
+  auto EDID_DATA {ut_consts::DEFAULT_EDID};
+  // "ROG PG279Q" -> "R\xFFG\0PG279Q"
+  EDID_DATA[114] = std::byte {0xFF};
+  EDID_DATA[116] = std::byte {0x00};
+  fixChecksum(EDID_DATA, 0);
+
+  const auto edid {display_device::EdidData::parse(EDID_DATA)};
+  ASSERT_TRUE(edid);
+  EXPECT_EQ(edid->m_monitor_name, "RGPG279Q");
+}
+
+TEST_S(ParseMany, Empty) {
+  EXPECT_TRUE(display_device::EdidData::parseMany({}).empty());
+}
+
+TEST_S(ParseMany, MixedInputs) {
+  auto BAD_CHECKSUM {ut_consts::DEFAULT_EDID};
+  BAD_CHECKSUM[16] = std::byte {0x00};
+
+  const std::vector<std::span<const std::byte>> views {ut_consts::DEFAULT_EDID, BAD_CHECKSUM, {}, CTA_EDID, DISPLAYID_EDID};
+  const auto edids {display_device::EdidData::parseMany(views)};
+
+  ASSERT_EQ(edids.size(), views.size());
+  EXPECT_EQ(edids[0], ut_consts::DEFAULT_EDID_DATA);
+  EXPECT_EQ(edids[1], std::nullopt);
+  EXPECT_EQ(edids[2], std::nullopt);
+  EXPECT_EQ(edids[3], display_device::EdidData::parse(CTA_EDID));
+  EXPECT_EQ(edids[4], display_device::EdidData::parse(DISPLAYID_EDID));
+}
+
+TEST_S(ParseMany, LargeBatchKeepsOrder) {
+  // Large enough to be parsed in parallel (if supported)
+  const std::vector<std::span<const std::byte>> samples {ut_consts::DEFAULT_EDID, CTA_EDID, DISPLAYID_EDID, {}};
+  std::vector<std::span<const std::byte>> views;
+  for (std::size_t i = 0; i < 1000; ++i) {
+    views.push_back(samples[i % samples.size()]);
+  }
+
+  const auto edids {display_device::EdidData::parseMany(views)};
+  ASSERT_EQ(edids.size(), views.size());
+  for (std::size_t i = 0; i < views.size(); ++i) {
+    EXPECT_EQ(edids[i], display_device::EdidData::parse(views[i]));
+  }
+}
@@ -0,0 +1,205 @@
+// system includes
+#include <fstream>
+#include <gmock/gmock.h>
+
+// local includes
+#include "display_device/file_keyed_settings_persistence.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Test fixture(s) for this file
+  class FileKeyedSettingsPersistenceTest: public BaseTest {
+  public:
+    ~FileKeyedSettingsPersistenceTest() override {
+      std::filesystem::remove(m_filepath);
+    }
+
+    display_device::FileKeyedSettingsPersistence &getImpl() {
+      if (!m_impl) {
+        m_impl = std::make_unique<display_device::FileKeyedSettingsPersistence>(m_filepath);
+      }
+
+      return *m_impl;
+    }
+
+    void resetImpl() {
+      m_impl = nullptr;
+    }
+
+    std::vector<std::uint8_t> readFile() const {
+      std::ifstream stream {m_filepath, std::ios::binary};
+      return {std::istreambuf_iterator<char> {stream}, std::istreambuf_iterator<char> {}};
+    }
+
+    void writeFile(const std::vector<std::uint8_t> &data) const {
+      std::ofstream file {m_filepath, std::ios_base::binary};
+      std::copy(std::begin(data), std::end(data), std::ostreambuf_iterator<char> {file});
+    }
+
+    std::filesystem::path m_filepath {"records.ext"};
+
+  private:
+    std::unique_ptr<display_device::FileKeyedSettingsPersistence> m_impl;
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, FileKeyedSettingsPersistenceTest, __VA_ARGS__)
+
+  // Additional convenience global const(s)
+  const std::vector<std::uint8_t> DATA_1 {'D', 'A', 'T', 'A', ' ', '1'};
+  const std::vector<std::uint8_t> DATA_2 {'D', 'A', 'T', 'A', ' ', '2'};
+  const std::vector<std::uint8_t> DATA_3 {'D', 'A', 'T', 'A', ' ', '3'};
+}  // namespace
+
+TEST_F_S(EmptyFilenameProvided) {
+  EXPECT_THAT([]() {
+    const display_device::FileKeyedSettingsPersistence persistence {{}};
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Empty filename provided for FileKeyedSettingsPersistence!")));
+}
+
+TEST_F_S(Store, MultipleKeys) {
+  EXPECT_TRUE(getImpl().store("profile_a", DATA_1));
+  EXPECT_TRUE(getImpl().store("profile_b", DATA_2));
+  EXPECT_TRUE(getImpl().store("profile_a", DATA_3));
+
+  EXPECT_EQ(getImpl().load("profile_a"), DATA_3);
+  EXPECT_EQ(getImpl().load("profile_b"), DATA_2);
+  EXPECT_EQ(getImpl().getKeys(), (std::vector<std::string> {"profile_a", "profile_b"}));
+}
+
+TEST_F_S(Store, IndexRebuiltFromFile) {
+  EXPECT_TRUE(getImpl().store("profile_a", DATA_1));
+  EXPECT_TRUE(getImpl().store("profile_b", DATA_2));
+  EXPECT_TRUE(getImpl().store("profile_a", DATA_3));
+  EXPECT_TRUE(getImpl().remove("profile_b"));
+  resetImpl();
+
+  EXPECT_EQ(getImpl().load("profile_a"), DATA_3);
+  EXPECT_EQ(getImpl().load("profile_b"), std::vector<std::uint8_t> {});
+  EXPECT_EQ(getImpl().getKeys(), (std::vector<std::string> {"profile_a"}));
+}
+
+TEST_F_S(Store, EmptyDataAndKeyStored) {
+  EXPECT_TRUE(getImpl().store("", DATA_1));
+  EXPECT_TRUE(getImpl().store("profile", {}));
+  resetImpl();
+
+  EXPECT_EQ(getImpl().load(""), DATA_1);
+  EXPECT_EQ(getImpl().load("profile"), std::vector<std::uint8_t> {});
+  EXPECT_EQ(getImpl().getKeys(), (std::vector<std::string> {"", "profile"}));
+}
+
+TEST_F_S(Store, IncompleteRecordDropped) {
+  EXPECT_TRUE(getImpl().store("profile_a", DATA_1));
+  resetImpl();
+
+  auto file_data {readFile()};
+  const auto valid_size {file_data.size()};
+  file_data.insert(std::end(file_data), {0x01, 0x00, 0x00});
+  writeFile(file_data);
+
+  EXPECT_TRUE(getImpl().store("profile_b", DATA_2));
+  EXPECT_EQ(std::filesystem::file_size(m_filepath), 2 * valid_size);
+  resetImpl();
+
+  EXPECT_EQ(getImpl().load("profile_a"), DATA_1);
+  EXPECT_EQ(getImpl().load("profile_b"), DATA_2);
+}
+
+TEST_F_S(Store, FilepathWithoutDirectory) {
+  m_filepath = "somedir/records.ext";
+
+  EXPECT_FALSE(getImpl().store("profile", DATA_1));
+  EXPECT_FALSE(std::filesystem::exists(m_filepath));
+}
+
+TEST_F_S(Store, AutomaticallyCompacted) {
+  const std::vector<std::uint8_t> data(1024, 0xAB);
+  for (int i = 0; i < 256; ++i) {
+    EXPECT_TRUE(getImpl().store("profile", data));
+  }
+
+  EXPECT_LT(std::filesystem::file_size(m_filepath), 2 * display_device::FileKeyedSettingsPersistence::COMPACTION_MIN_GARBAGE_SIZE);
+  EXPECT_EQ(getImpl().load("profile"), data);
+}
+
+TEST_F_S(Load, NoFileAvailable) {
+  EXPECT_EQ(getImpl().load("profile"), std::vector<std::uint8_t> {});
+  EXPECT_EQ(getImpl().getKeys(), std::vector<std::string> {});
+}
+
+TEST_F_S(Load, CorruptRecordIgnored) {
+  EXPECT_TRUE(getImpl().store("profile", DATA_1));
+  EXPECT_TRUE(getImpl().store("profile", DATA_2));
+  resetImpl();
+
+  auto file_data {readFile()};
+  file_data.back() ^= 0xFF;
+  writeFile(file_data);
+
+  EXPECT_EQ(getImpl().load("profile"), DATA_1);
+}
+
+TEST_F_S(Load, ExternallyModifiedRecord) {
+  EXPECT_TRUE(getImpl().store("profile", DATA_1));
+  EXPECT_EQ(getImpl().getKeys(), (std::vector<std::string> {"profile"}));
+
+  auto file_data {readFile()};
+  file_data.back() ^= 0xFF;
+  writeFile(file_data);
+
+  EXPECT_EQ(getImpl().load("profile"), std::nullopt);
+  EXPECT_EQ(getImpl().load("profile"), std::vector<std::uint8_t> {});
+}
+
+TEST_F_S(Remove, NoRecordAvailable) {
+  EXPECT_TRUE(getImpl().remove("profile"));
+  EXPECT_FALSE(std::filesystem::exists(m_filepath));
+}
+
+TEST_F_S(Remove, RecordRemoved) {
+  EXPECT_TRUE(getImpl().store("profile_a", DATA_1));
+  EXPECT_TRUE(getImpl().store("profile_b", DATA_2));
+  EXPECT_TRUE(getImpl().remove("profile_a"));
+
+  EXPECT_EQ(getImpl().load("profile_a"), std::vector<std::uint8_t> {});
+  EXPECT_EQ(getImpl().load("profile_b"), DATA_2);
+  EXPECT_EQ(getImpl().getKeys(), (std::vector<std::string> {"profile_b"}));
+}
+
+TEST_F_S(Compact, OnlyLiveRecordsKept) {
+  EXPECT_TRUE(getImpl().store("profile_a", DATA_1));
+  const auto single_record_size {std::filesystem::file_size(m_filepath)};
+  EXPECT_TRUE(getImpl().store("profile_b", DATA_2));
+  EXPECT_TRUE(getImpl().store("profile_a", DATA_3));
+  EXPECT_TRUE(getImpl().remove("profile_b"));
+
+  EXPECT_TRUE(getImpl().compact());
+  EXPECT_EQ(std::filesystem::file_size(m_filepath), single_record_size);
+  EXPECT_EQ(getImpl().load("profile_a"), DATA_3);
+
+  EXPECT_TRUE(getImpl().store("profile_c", DATA_1));
+  resetImpl();
+
+  EXPECT_EQ(getImpl().load("profile_a"), DATA_3);
+  EXPECT_EQ(getImpl().load("profile_c"), DATA_1);
+  EXPECT_EQ(getImpl().getKeys(), (std::vector<std::string> {"profile_a", "profile_c"}));
+}
+
+TEST_F_S(Clear, NoFileAvailable) {
+  EXPECT_TRUE(getImpl().clear());
+}
+
+TEST_F_S(Clear, FileRemoved) {
+  EXPECT_TRUE(getImpl().store("profile", DATA_1));
+  EXPECT_TRUE(getImpl().clear());
+  EXPECT_FALSE(std::filesystem::exists(m_filepath));
+  EXPECT_EQ(getImpl().getKeys(), std::vector<std::string> {});
+
+  EXPECT_TRUE(getImpl().store("profile", DATA_2));
+  EXPECT_EQ(getImpl().load("profile"), DATA_2);
+}
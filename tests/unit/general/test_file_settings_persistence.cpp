@@ -1,6 +1,13 @@
 // system includes
 #include <fstream>
 #include <gmock/gmock.h>
+#include <thread>
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <unistd.h>
+#endif
 
 // local includes
 #include "display_device/file_settings_persistence.h"
@@ -14,7 +21,19 @@ namespace {
   class FileSettingsPersistenceTest: public BaseTest {
   public:
     ~FileSettingsPersistenceTest() override {
+      if (m_filepath.empty()) {
+        return;
+      }
+
       std::filesystem::remove(m_filepath);
+
+      // Siblings created by the tests themselves
+      const auto prefix {m_filepath.filename().string() + "."};
+      for (const auto &entry : std::filesystem::directory_iterator {std::filesystem::current_path()}) {
+        if (entry.path().filename().string().starts_with(prefix)) {
+          std::filesystem::remove(entry.path());
+        }
+      }
     }
 
     display_device::FileSettingsPersistence &getImpl(const std::filesystem::path &filepath = "testfile.ext") {
@@ -26,6 +45,18 @@ namespace {
       return *m_impl;
     }
 
+    static bool hasTemporaryFiles(const std::filesystem::path &filepath) {
+      const auto prefix {filepath.filename().string() + "."};
+      for (const auto &entry : std::filesystem::directory_iterator {std::filesystem::current_path()}) {
+        const auto filename {entry.path().filename().string()};
+        if (filename.starts_with(prefix) && filename.ends_with(".tmp")) {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
   private:
     std::filesystem::path m_filepath;
     std::unique_ptr<display_device::FileSettingsPersistence> m_impl;
@@ -42,6 +73,27 @@ TEST_F_S(EmptyFilenameProvided) {
               ThrowsMessage<std::runtime_error>(HasSubstr("Empty filename provided for FileSettingsPersistence!")));
 }
 
+TEST_F_S(StaleTemporaryFilesRemoved) {
+#ifdef _WIN32
+  const auto process_id {GetCurrentProcessId()};
+#else
+  const auto process_id {::getpid()};
+#endif
+  // The largest PID is never assigned (Windows uses multiples of 4, Linux is limited to 2^22)
+  const std::filesystem::path stale_filepath {"testfile.ext.2147483647.0.tmp"};
+  const std::filesystem::path in_progress_filepath {"testfile.ext." + std::to_string(process_id) + ".0.tmp"};
+  const std::filesystem::path unrelated_filepath {"testfile.ext.backup.tmp"};
+
+  for (const auto &filepath : {stale_filepath, in_progress_filepath, unrelated_filepath}) {
+    std::ofstream file {filepath};
+  }
+
+  static_cast<void>(getImpl());
+  EXPECT_FALSE(std::filesystem::exists(stale_filepath));
+  EXPECT_TRUE(std::filesystem::exists(in_progress_filepath));
+  EXPECT_TRUE(std::filesystem::exists(unrelated_filepath));
+}
+
 TEST_F_S(Store, NewFileCreated) {
   const std::filesystem::path filepath {"myfile.ext"};
   const std::vector<std::uint8_t> data {0x00, 0x01, 0x02, 0x04, 'S', 'O', 'M', 'E', ' ', 'D', 'A', 'T', 'A'};
@@ -83,6 +135,49 @@ TEST_F_S(Store, FilepathWithDirectory) {
   EXPECT_FALSE(std::filesystem::exists(filepath));
 }
 
+TEST_F_S(Store, TemporaryFileRemoved) {
+  const std::filesystem::path filepath {"myfile.ext"};
+  const std::vector<std::uint8_t> data {0x00, 0x01, 0x02, 0x04, 'S', 'O', 'M', 'E', ' ', 'D', 'A', 'T', 'A'};
+
+  EXPECT_TRUE(getImpl(filepath).store(data));
+  EXPECT_TRUE(std::filesystem::exists(filepath));
+  EXPECT_FALSE(hasTemporaryFiles(filepath));
+}
+
+TEST_F_S(Store, FailedToReplaceFile) {
+  const std::filesystem::path filepath {"myfile.ext"};
+  const std::vector<std::uint8_t> data {0x00, 0x01, 0x02, 0x04, 'S', 'O', 'M', 'E', ' ', 'D', 'A', 'T', 'A'};
+
+  // Directory cannot be replaced by a file
+  std::filesystem::create_directory(filepath);
+
+  EXPECT_FALSE(getImpl(filepath).store(data));
+  EXPECT_TRUE(std::filesystem::is_directory(filepath));
+  EXPECT_FALSE(hasTemporaryFiles(filepath));
+}
+
+TEST_F_S(Store, ConcurrentStoresNotTorn) {
+  const std::vector<std::uint8_t> data_1(64 * 1024, '1');
+  const std::vector<std::uint8_t> data_2(32 * 1024, '2');
+
+  // Each instance stores its own data, which must never be mixed with the other's
+  std::thread other_writer {[&data_2]() {
+    display_device::FileSettingsPersistence other_persistence {"testfile.ext"};
+    for (int i = 0; i < 50; ++i) {
+      EXPECT_TRUE(other_persistence.store(data_2));
+    }
+  }};
+  for (int i = 0; i < 50; ++i) {
+    EXPECT_TRUE(getImpl().store(data_1));
+
+    const auto data {getImpl().load()};
+    EXPECT_TRUE(data == data_1 || data == data_2);
+  }
+  other_writer.join();
+
+  EXPECT_FALSE(hasTemporaryFiles("testfile.ext"));
+}
+
 TEST_F_S(Load, NoFileAvailable) {
   EXPECT_EQ(getImpl().load(), std::vector<std::uint8_t> {});
 }
@@ -99,6 +194,43 @@ TEST_F_S(Load, FileRead) {
   EXPECT_EQ(getImpl(filepath).load(), data);
 }
 
+TEST_F_S(Load, LargeFileRead) {
+  const std::filesystem::path filepath {"myfile.ext"};
+  std::vector<std::uint8_t> data(256 * 1024);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<std::uint8_t>(i * 31);
+  }
+
+  {
+    std::ofstream file {filepath, std::ios_base::binary};
+    std::copy(std::begin(data), std::end(data), std::ostreambuf_iterator<char> {file});
+  }
+
+  EXPECT_EQ(getImpl(filepath).load(), data);
+}
+
+TEST_F_S(Load, EmptyFileRead) {
+  const std::filesystem::path filepath {"myfile.ext"};
+  {
+    std::ofstream file {filepath};
+  }
+
+  EXPECT_EQ(getImpl(filepath).load(), std::vector<std::uint8_t> {});
+}
+
+TEST_F_S(Load, NoDirectoryAvailable) {
+  EXPECT_EQ(getImpl("somedir/myfile.ext").load(), std::vector<std::uint8_t> {});
+}
+
+TEST_F_S(Load, FailedToRead) {
+  const std::filesystem::path filepath {"myfile.ext"};
+
+  // Directory cannot be read as a file
+  std::filesystem::create_directory(filepath);
+
+  EXPECT_EQ(getImpl(filepath).load(), std::nullopt);
+}
+
 TEST_F_S(Clear, NoFileAvailable) {
   EXPECT_TRUE(getImpl().clear());
 }
@@ -114,3 +246,8 @@ TEST_F_S(Clear, FileRemoved) {
   EXPECT_TRUE(getImpl(filepath).clear());
   EXPECT_FALSE(std::filesystem::exists(filepath));
 }
+
+TEST_F_S(NoIntermediateStoresPreferred) {
+  // Every store is a durable replacement of the whole file
+  EXPECT_FALSE(getImpl().prefersIntermediateStores());
+}
@@ -0,0 +1,82 @@
+// system includes
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <string>
+
+// local includes
+#include "display_device/flat_map.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience type aliases
+  using Map = display_device::FlatMap<std::string, int>;
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, FlatMap, __VA_ARGS__)
+}  // namespace
+
+TEST_S(Construct, SortedAndFirstDuplicateKept) {
+  const Map map {{"c", 3}, {"a", 1}, {"b", 2}, {"a", 4}};
+  const auto keys_view {std::ranges::views::keys(map)};
+
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ((std::vector<std::string> {std::begin(keys_view), std::end(keys_view)}), (std::vector<std::string> {"a", "b", "c"}));
+  EXPECT_EQ(map.at("a"), 1);
+}
+
+TEST_S(Lookup) {
+  const Map map {{"a", 1}, {"c", 3}};
+
+  EXPECT_TRUE(map.contains("a"));
+  EXPECT_FALSE(map.contains("b"));
+  EXPECT_EQ(map.count("c"), 1);
+  EXPECT_EQ(map.find("b"), std::end(map));
+  EXPECT_EQ(map.find("c")->second, 3);
+  EXPECT_EQ(map.lower_bound("b")->first, "c");
+  EXPECT_THROW(static_cast<void>(map.at("b")), std::out_of_range);
+}
+
+TEST_S(Insert) {
+  Map map;
+
+  EXPECT_TRUE(map.insert({"b", 2}).second);
+  EXPECT_FALSE(map.insert({"b", 5}).second);
+  EXPECT_TRUE(map.emplace("a", 1).second);
+  EXPECT_FALSE(map.try_emplace("a", 5).second);
+  EXPECT_FALSE(map.insert_or_assign("a", 6).second);
+  map["c"] = 3;
+
+  EXPECT_EQ(map, (Map {{"a", 6}, {"b", 2}, {"c", 3}}));
+}
+
+TEST_S(Insert, Hint) {
+  Map map;
+  const Map source {{"a", 1}, {"b", 2}, {"c", 3}};
+
+  // Valid hints (sorted source)
+  std::ranges::copy(source, std::inserter(map, std::end(map)));
+  EXPECT_EQ(map, source);
+
+  // Invalid hint
+  map.insert(std::begin(map), {"d", 4});
+  EXPECT_EQ(map, (Map {{"a", 1}, {"b", 2}, {"c", 3}, {"d", 4}}));
+}
+
+TEST_S(Erase) {
+  Map map {{"a", 1}, {"b", 2}, {"c", 3}};
+
+  EXPECT_EQ(map.erase("b"), 1);
+  EXPECT_EQ(map.erase("b"), 0);
+  EXPECT_EQ(map.erase(std::begin(map))->first, "c");
+  EXPECT_EQ(map, (Map {{"c", 3}}));
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+
+TEST_S(Equality) {
+  EXPECT_EQ((Map {{"a", 1}, {"b", 2}}), (Map {{"b", 2}, {"a", 1}}));
+  EXPECT_NE((Map {{"a", 1}, {"b", 2}}), (Map {{"a", 1}, {"b", 3}}));
+  EXPECT_NE((Map {{"a", 1}, {"b", 2}}), (Map {{"a", 1}}));
+}
@@ -0,0 +1,64 @@
+// system includes
+#include <algorithm>
+#include <iterator>
+#include <string>
+
+// local includes
+#include "display_device/flat_set.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience type aliases
+  using Set = display_device::FlatSet<std::string>;
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, FlatSet, __VA_ARGS__)
+}  // namespace
+
+TEST_S(Construct, SortedAndUnique) {
+  const Set set {"c", "a", "b", "a"};
+
+  EXPECT_EQ(set.size(), 3);
+  EXPECT_EQ((std::vector<std::string> {std::begin(set), std::end(set)}), (std::vector<std::string> {"a", "b", "c"}));
+}
+
+TEST_S(Lookup) {
+  const Set set {"a", "c"};
+
+  EXPECT_TRUE(set.contains("a"));
+  EXPECT_FALSE(set.contains("b"));
+  EXPECT_EQ(set.count("c"), 1);
+  EXPECT_EQ(set.find("b"), std::end(set));
+  EXPECT_EQ(*set.lower_bound("b"), "c");
+}
+
+TEST_S(Insert) {
+  Set set;
+
+  EXPECT_TRUE(set.insert("b").second);
+  EXPECT_FALSE(set.insert("b").second);
+  EXPECT_TRUE(set.emplace("a").second);
+
+  const Set source {"c", "d"};
+  std::ranges::copy(source, std::inserter(set, std::end(set)));
+  set.insert(std::begin(set), "e");
+
+  EXPECT_EQ(set, (Set {"a", "b", "c", "d", "e"}));
+}
+
+TEST_S(Erase) {
+  Set set {"a", "b", "c"};
+
+  EXPECT_EQ(set.erase("b"), 1);
+  EXPECT_EQ(set.erase("b"), 0);
+  EXPECT_EQ(*set.erase(std::begin(set)), "c");
+  EXPECT_EQ(set, Set {"c"});
+
+  set.clear();
+  EXPECT_TRUE(set.empty());
+}
+
+TEST_S(Includes) {
+  EXPECT_TRUE(std::ranges::includes(Set {"a", "b", "c"}, Set {"a", "c"}));
+  EXPECT_FALSE(std::ranges::includes(Set {"a", "c"}, Set {"a", "b"}));
+}
@@ -0,0 +1,184 @@
+// system includes
+#include <fstream>
+#include <gmock/gmock.h>
+
+// local includes
+#include "display_device/generational_settings_persistence.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Test fixture(s) for this file
+  class GenerationalSettingsPersistenceTest: public BaseTest {
+  public:
+    ~GenerationalSettingsPersistenceTest() override {
+      for (std::size_t slot = 0; slot < GENERATIONS + 1; ++slot) {
+        std::filesystem::remove(getSlotFilepath(slot));
+      }
+    }
+
+    display_device::GenerationalSettingsPersistence &getImpl() {
+      if (!m_impl) {
+        m_impl = std::make_unique<display_device::GenerationalSettingsPersistence>(m_filepath, GENERATIONS);
+      }
+
+      return *m_impl;
+    }
+
+    void resetImpl() {
+      m_impl = nullptr;
+    }
+
+    std::filesystem::path getSlotFilepath(const std::size_t slot) const {
+      auto filepath {m_filepath};
+      filepath += "." + std::to_string(slot);
+      return filepath;
+    }
+
+    std::vector<std::uint8_t> readSlot(const std::size_t slot) const {
+      std::ifstream stream {getSlotFilepath(slot), std::ios::binary};
+      return {std::istreambuf_iterator<char> {stream}, std::istreambuf_iterator<char> {}};
+    }
+
+    void writeSlot(const std::size_t slot, const std::vector<std::uint8_t> &data) const {
+      std::ofstream file {getSlotFilepath(slot), std::ios_base::binary};
+      std::copy(std::begin(data), std::end(data), std::ostreambuf_iterator<char> {file});
+    }
+
+    void corruptSlot(const std::size_t slot) const {
+      auto data {readSlot(slot)};
+      data.front() ^= 0xFF;
+      writeSlot(slot, data);
+    }
+
+    static constexpr std::size_t GENERATIONS {3};
+    std::filesystem::path m_filepath {"generations.ext"};
+
+  private:
+    std::unique_ptr<display_device::GenerationalSettingsPersistence> m_impl;
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, GenerationalSettingsPersistenceTest, __VA_ARGS__)
+
+  // Additional convenience global const(s)
+  const std::vector<std::uint8_t> DATA_1 {'D', 'A', 'T', 'A', ' ', '1'};
+  const std::vector<std::uint8_t> DATA_2 {'D', 'A', 'T', 'A', ' ', '2'};
+  const std::vector<std::uint8_t> DATA_3 {'D', 'A', 'T', 'A', ' ', '3'};
+  const std::vector<std::uint8_t> DATA_4 {'D', 'A', 'T', 'A', ' ', '4'};
+}  // namespace
+
+TEST_F_S(EmptyFilenameProvided) {
+  EXPECT_THAT([]() {
+    const display_device::GenerationalSettingsPersistence persistence {{}};
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Empty filename provided for GenerationalSettingsPersistence!")));
+}
+
+TEST_F_S(ZeroGenerationsProvided) {
+  EXPECT_THAT([]() {
+    const display_device::GenerationalSettingsPersistence persistence("generations.ext", 0);
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Number of generations for GenerationalSettingsPersistence must be larger than 0!")));
+}
+
+TEST_F_S(Store, GenerationsRotated) {
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_TRUE(getImpl().store(DATA_2));
+  EXPECT_TRUE(getImpl().store(DATA_3));
+  EXPECT_TRUE(getImpl().store(DATA_4));
+
+  EXPECT_TRUE(std::filesystem::exists(getSlotFilepath(0)));
+  EXPECT_TRUE(std::filesystem::exists(getSlotFilepath(1)));
+  EXPECT_TRUE(std::filesystem::exists(getSlotFilepath(2)));
+  EXPECT_FALSE(std::filesystem::exists(getSlotFilepath(3)));
+  EXPECT_EQ(getImpl().load(), DATA_4);
+
+  // The oldest generation was overwritten
+  corruptSlot(0);
+  EXPECT_EQ(getImpl().load(), DATA_3);
+}
+
+TEST_F_S(Store, ContinuedFromExistingGenerations) {
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_TRUE(getImpl().store(DATA_2));
+  resetImpl();
+
+  EXPECT_TRUE(getImpl().store(DATA_3));
+  EXPECT_EQ(getImpl().load(), DATA_3);
+
+  corruptSlot(2);
+  EXPECT_EQ(getImpl().load(), DATA_2);
+}
+
+TEST_F_S(Store, CorruptedGenerationsOverwritten) {
+  writeSlot(0, {'G', 'A', 'R', 'B', 'A', 'G', 'E'});
+
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_EQ(getImpl().load(), DATA_1);
+}
+
+TEST_F_S(Store, EmptyDataStored) {
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_TRUE(getImpl().store({}));
+  EXPECT_EQ(getImpl().load(), std::vector<std::uint8_t> {});
+}
+
+TEST_F_S(Store, FilepathWithoutDirectory) {
+  m_filepath = "somedir/generations.ext";
+
+  EXPECT_FALSE(getImpl().store(DATA_1));
+  EXPECT_FALSE(std::filesystem::exists(getSlotFilepath(0)));
+}
+
+TEST_F_S(Load, NoFilesAvailable) {
+  EXPECT_EQ(getImpl().load(), std::vector<std::uint8_t> {});
+}
+
+TEST_F_S(Load, FallbackToOlderGeneration) {
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_TRUE(getImpl().store(DATA_2));
+  EXPECT_TRUE(getImpl().store(DATA_3));
+
+  corruptSlot(2);
+  EXPECT_EQ(getImpl().load(), DATA_2);
+
+  corruptSlot(1);
+  EXPECT_EQ(getImpl().load(), DATA_1);
+}
+
+TEST_F_S(Load, TruncatedGenerationIgnored) {
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_TRUE(getImpl().store(DATA_2));
+
+  auto data {readSlot(1)};
+  data.pop_back();
+  writeSlot(1, data);
+
+  EXPECT_EQ(getImpl().load(), DATA_1);
+}
+
+TEST_F_S(Load, NoValidGenerations) {
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  corruptSlot(0);
+
+  EXPECT_EQ(getImpl().load(), std::nullopt);
+}
+
+TEST_F_S(Clear, NoFilesAvailable) {
+  EXPECT_TRUE(getImpl().clear());
+}
+
+TEST_F_S(Clear, FilesRemoved) {
+  EXPECT_TRUE(getImpl().store(DATA_1));
+  EXPECT_TRUE(getImpl().store(DATA_2));
+  EXPECT_TRUE(getImpl().clear());
+  EXPECT_FALSE(std::filesystem::exists(getSlotFilepath(0)));
+  EXPECT_FALSE(std::filesystem::exists(getSlotFilepath(1)));
+  EXPECT_EQ(getImpl().load(), std::vector<std::uint8_t> {});
+
+  EXPECT_TRUE(getImpl().store(DATA_3));
+  EXPECT_EQ(getImpl().load(), DATA_3);
+}
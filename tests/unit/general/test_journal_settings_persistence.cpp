@@ -0,0 +1,181 @@
+// system includes
+#include <fstream>
+#include <gmock/gmock.h>
+
+// local includes
+#include "display_device/journal_settings_persistence.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Test fixture(s) for this file
+  class JournalSettingsPersistenceTest: public BaseTest {
+  public:
+    ~JournalSettingsPersistenceTest() override {
+      std::filesystem::remove(m_filepath);
+    }
+
+    display_device::JournalSettingsPersistence &getImpl(const std::size_t compaction_threshold = 32) {
+      if (!m_impl) {
+        m_impl = std::make_unique<display_device::JournalSettingsPersistence>(m_filepath, compaction_threshold);
+      }
+
+      return *m_impl;
+    }
+
+    std::vector<std::uint8_t> readFile() const {
+      std::ifstream stream {m_filepath, std::ios::binary};
+      return {std::istreambuf_iterator<char> {stream}, std::istreambuf_iterator<char> {}};
+    }
+
+    void writeFile(const std::vector<std::uint8_t> &data) const {
+      std::ofstream file {m_filepath, std::ios_base::binary};
+      std::copy(std::begin(data), std::end(data), std::ostreambuf_iterator<char> {file});
+    }
+
+    std::filesystem::path m_filepath {"journal.ext"};
+
+  private:
+    std::unique_ptr<display_device::JournalSettingsPersistence> m_impl;
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, JournalSettingsPersistenceTest, __VA_ARGS__)
+
+  // Record header size (payload size + checksum)
+  constexpr std::size_t RECORD_HEADER_SIZE {8};
+}  // namespace
+
+TEST_F_S(EmptyFilenameProvided) {
+  EXPECT_THAT([]() {
+    const display_device::JournalSettingsPersistence persistence {{}};
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Empty filename provided for JournalSettingsPersistence!")));
+}
+
+TEST_F_S(ZeroCompactionThresholdProvided) {
+  EXPECT_THAT([]() {
+    const display_device::JournalSettingsPersistence persistence("journal.ext", 0);
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Compaction threshold for JournalSettingsPersistence must be larger than 0!")));
+}
+
+TEST_F_S(Store, NewFileCreated) {
+  const std::vector<std::uint8_t> data {'S', 'O', 'M', 'E', ' ', 'D', 'A', 'T', 'A'};
+
+  EXPECT_FALSE(std::filesystem::exists(m_filepath));
+  EXPECT_TRUE(getImpl().store(data));
+  EXPECT_EQ(std::filesystem::file_size(m_filepath), RECORD_HEADER_SIZE + data.size());
+  EXPECT_EQ(getImpl().load(), data);
+}
+
+TEST_F_S(Store, RecordsAppended) {
+  const std::vector<std::uint8_t> data1 {'D', 'A', 'T', 'A', ' ', '1'};
+  const std::vector<std::uint8_t> data2 {'D', 'A', 'T', 'A', ' ', '2', '2'};
+
+  EXPECT_TRUE(getImpl().store(data1));
+  EXPECT_TRUE(getImpl().store(data2));
+  EXPECT_EQ(std::filesystem::file_size(m_filepath), 2 * RECORD_HEADER_SIZE + data1.size() + data2.size());
+  EXPECT_EQ(getImpl().load(), data2);
+}
+
+TEST_F_S(Store, EmptyDataStored) {
+  EXPECT_TRUE(getImpl().store({'D', 'A', 'T', 'A'}));
+  EXPECT_TRUE(getImpl().store({}));
+  EXPECT_EQ(getImpl().load(), std::vector<std::uint8_t> {});
+}
+
+TEST_F_S(Store, JournalCompacted) {
+  const std::vector<std::uint8_t> data1 {'D', 'A', 'T', 'A', ' ', '1'};
+  const std::vector<std::uint8_t> data2 {'D', 'A', 'T', 'A', ' ', '2'};
+  const std::vector<std::uint8_t> data3 {'D', 'A', 'T', 'A', ' ', '3'};
+
+  EXPECT_TRUE(getImpl(2).store(data1));
+  EXPECT_TRUE(getImpl().store(data2));
+  EXPECT_TRUE(getImpl().store(data3));
+  EXPECT_EQ(std::filesystem::file_size(m_filepath), RECORD_HEADER_SIZE + data3.size());
+  EXPECT_EQ(getImpl().load(), data3);
+}
+
+TEST_F_S(Store, IncompleteRecordDropped) {
+  const std::vector<std::uint8_t> data1 {'D', 'A', 'T', 'A', ' ', '1'};
+  const std::vector<std::uint8_t> data2 {'D', 'A', 'T', 'A', ' ', '2'};
+
+  {
+    display_device::JournalSettingsPersistence persistence {m_filepath};
+    EXPECT_TRUE(persistence.store(data1));
+  }
+
+  auto file_data {readFile()};
+  file_data.insert(std::end(file_data), {0xFF, 0x00, 0x00});
+  writeFile(file_data);
+
+  EXPECT_TRUE(getImpl().store(data2));
+  EXPECT_EQ(std::filesystem::file_size(m_filepath), 2 * RECORD_HEADER_SIZE + data1.size() + data2.size());
+  EXPECT_EQ(getImpl().load(), data2);
+}
+
+TEST_F_S(Store, FilepathWithoutDirectory) {
+  m_filepath = "somedir/journal.ext";
+
+  EXPECT_FALSE(getImpl().store({'D', 'A', 'T', 'A'}));
+  EXPECT_FALSE(std::filesystem::exists(m_filepath));
+}
+
+TEST_F_S(Load, NoFileAvailable) {
+  EXPECT_EQ(getImpl().load(), std::vector<std::uint8_t> {});
+}
+
+TEST_F_S(Load, IncompleteRecordIgnored) {
+  const std::vector<std::uint8_t> data1 {'D', 'A', 'T', 'A', ' ', '1'};
+  const std::vector<std::uint8_t> data2 {'D', 'A', 'T', 'A', ' ', '2'};
+
+  EXPECT_TRUE(getImpl().store(data1));
+  EXPECT_TRUE(getImpl().store(data2));
+
+  auto file_data {readFile()};
+  file_data.pop_back();
+  writeFile(file_data);
+
+  EXPECT_EQ(getImpl().load(), data1);
+}
+
+TEST_F_S(Load, CorruptRecordIgnored) {
+  const std::vector<std::uint8_t> data1 {'D', 'A', 'T', 'A', ' ', '1'};
+  const std::vector<std::uint8_t> data2 {'D', 'A', 'T', 'A', ' ', '2'};
+
+  EXPECT_TRUE(getImpl().store(data1));
+  EXPECT_TRUE(getImpl().store(data2));
+
+  auto file_data {readFile()};
+  file_data.back() ^= 0xFF;
+  writeFile(file_data);
+
+  EXPECT_EQ(getImpl().load(), data1);
+}
+
+TEST_F_S(Load, NoValidRecords) {
+  writeFile({'G', 'A', 'R', 'B', 'A', 'G', 'E', ' ', 'D', 'A', 'T', 'A'});
+  EXPECT_EQ(getImpl().load(), std::nullopt);
+}
+
+TEST_F_S(Clear, NoFileAvailable) {
+  EXPECT_TRUE(getImpl().clear());
+}
+
+TEST_F_S(Clear, FileRemoved) {
+  EXPECT_TRUE(getImpl().store({'D', 'A', 'T', 'A'}));
+  EXPECT_TRUE(std::filesystem::exists(m_filepath));
+  EXPECT_TRUE(getImpl().clear());
+  EXPECT_FALSE(std::filesystem::exists(m_filepath));
+
+  const std::vector<std::uint8_t> data {'N', 'E', 'W', ' ', 'D', 'A', 'T', 'A'};
+  EXPECT_TRUE(getImpl().store(data));
+  EXPECT_EQ(getImpl().load(), data);
+}
+
+TEST_F_S(PrefersIntermediateStores) {
+  EXPECT_TRUE(getImpl().prefersIntermediateStores());
+}
@@ -39,6 +39,23 @@ namespace display_device {
   DD_JSON_DEFINE_SERIALIZE_STRUCT(TestStruct::Nested, c)
   DD_JSON_DEFINE_SERIALIZE_STRUCT(TestStruct, a, b)
 
+  // Test schema history:
+  //  v0: {"name": "", "c": 0}
+  //  v1: {"a": "", "c": 0}
+  //  v2: {"a": "", "b": {"c": 0}}
+  const std::array<JsonMigrationStep, 2> TEST_STRUCT_MIGRATIONS {
+    [](nlohmann::json &data) {
+      data["a"] = std::move(data.at("name"));
+      data.erase("name");
+    },
+    [](nlohmann::json &data) {
+      data["b"]["c"] = std::move(data.at("c"));
+      data.erase("c");
+    }
+  };
+
+  DD_JSON_DEFINE_VERSIONED_CONVERTER(TestStruct, TEST_STRUCT_MIGRATIONS)
+
   DD_JSON_DEFINE_CONVERTER(TestEnum)
   DD_JSON_DEFINE_CONVERTER(TestStruct)
   DD_JSON_DEFINE_CONVERTER(TestVariant)
@@ -154,6 +171,71 @@ TEST_S(FromJson, Error, WithoutErrorMessageParam) {
   EXPECT_EQ(original, copy);
 }
 
+TEST_S(ToVersionedJson, NoError) {
+  bool success {false};
+  const auto json_string {display_device::toVersionedJson(display_device::TestStruct {"A", {1}}, std::nullopt, &success)};
+
+  EXPECT_TRUE(success);
+  EXPECT_EQ(json_string, R"({"data":{"a":"A","b":{"c":1}},"version":2})");
+}
+
+TEST_S(ToVersionedJson, Error) {
+  bool success {true};
+  const auto json_string {display_device::toVersionedJson(display_device::TestStruct {"123\xC2"}, std::nullopt, &success)};
+
+  EXPECT_FALSE(success);
+  EXPECT_EQ(json_string, "[json.exception.type_error.316] incomplete UTF-8 string; last byte: 0xC2");
+}
+
+TEST_S(FromVersionedJson, LatestVersion) {
+  display_device::TestStruct value {};
+  std::string error_message {"some_string"};
+
+  EXPECT_TRUE(display_device::fromVersionedJson(R"({"data":{"a":"A","b":{"c":1}},"version":2})", value, &error_message));
+  EXPECT_EQ(value, display_device::TestStruct({"A", {1}}));
+  EXPECT_TRUE(error_message.empty());
+}
+
+TEST_S(FromVersionedJson, MigratedFromOlderVersion) {
+  display_device::TestStruct value {};
+
+  EXPECT_TRUE(display_device::fromVersionedJson(R"({"data":{"a":"A","c":1},"version":1})", value, nullptr));
+  EXPECT_EQ(value, display_device::TestStruct({"A", {1}}));
+}
+
+TEST_S(FromVersionedJson, MigratedFromUnversionedData) {
+  display_device::TestStruct value {};
+
+  EXPECT_TRUE(display_device::fromVersionedJson(R"({"name":"A","c":1})", value, nullptr));
+  EXPECT_EQ(value, display_device::TestStruct({"A", {1}}));
+}
+
+TEST_S(FromVersionedJson, UnsupportedVersion) {
+  display_device::TestStruct original {"A", {1}};
+  display_device::TestStruct copy {original};
+  std::string error_message {};
+
+  EXPECT_FALSE(display_device::fromVersionedJson(R"({"data":{"a":"B","b":{"c":2}},"version":3})", copy, &error_message));
+  EXPECT_EQ(original, copy);
+  EXPECT_EQ(error_message, "Unsupported data version 3! Latest supported version is 2.");
+}
+
+TEST_S(FromVersionedJson, MissingData) {
+  display_device::TestStruct value {};
+  std::string error_message {};
+
+  EXPECT_FALSE(display_device::fromVersionedJson(R"({"version":2})", value, &error_message));
+  EXPECT_EQ(error_message, "[json.exception.out_of_range.403] key 'data' not found");
+}
+
+TEST_S(FromVersionedJson, FailedMigration) {
+  display_device::TestStruct value {};
+  std::string error_message {};
+
+  EXPECT_FALSE(display_device::fromVersionedJson(R"({"data":{"c":1},"version":0})", value, &error_message));
+  EXPECT_EQ(error_message, "[json.exception.out_of_range.403] key 'name' not found");
+}
+
 TEST_S(ToJson, Enum) {
   EXPECT_EQ(display_device::toJson(display_device::TestEnum::Value1, std::nullopt, nullptr), R"("Value1")");
   EXPECT_EQ(display_device::toJson(display_device::TestEnum::Value2, std::nullopt, nullptr), R"("ValueMaybe2")");
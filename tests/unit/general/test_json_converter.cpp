@@ -12,9 +12,46 @@ TEST_F_S(EdidData) {
     .m_product_code = "ABCD",
     .m_serial_number = 777777
   };
+  display_device::EdidData full_item {
+    .m_manufacturer_id = "LOL",
+    .m_product_code = "ABCD",
+    .m_serial_number = 777777,
+    .m_monitor_name = "Monitor",
+    .m_preferred_timing = display_device::EdidData::Timing {{1920, 1080}, {60000, 1000}, 148500, false},
+    .m_detailed_timings = {{{1920, 1080}, {60000, 1000}, 148500, false}, {{1920, 1080}, {60053, 1000}, 74250, true}},
+    .m_hdr_static_metadata = display_device::EdidData::HdrStaticMetadata {true, false, true, false, 400., 200., std::nullopt},
+    .m_refresh_rate_range = display_device::EdidData::RefreshRateRange {24, 120},
+    .m_vrr_range = display_device::EdidData::RefreshRateRange {40, 120},
+    .m_video_modes = {{{1280, 720}, {50, 1}}},
+    .m_modes_complete = true
+  };
+
+  executeTestCase(display_device::EdidData {}, R"({"detailed_timings":[],"hdr_static_metadata":null,"manufacturer_id":"","modes_complete":false,"monitor_name":"","preferred_timing":null,"product_code":"","refresh_rate_range":null,"serial_number":0,"video_modes":[],"vrr_range":null})");
+  executeTestCase(item, R"({"detailed_timings":[],"hdr_static_metadata":null,"manufacturer_id":"LOL","modes_complete":false,"monitor_name":"","preferred_timing":null,"product_code":"ABCD","refresh_rate_range":null,"serial_number":777777,"video_modes":[],"vrr_range":null})");
+  executeTestCase(full_item, R"({"detailed_timings":[{"interlaced":false,"pixel_clock_khz":148500,"refresh_rate":{"denominator":1000,"numerator":60000},"resolution":{"height":1080,"width":1920}},{"interlaced":true,"pixel_clock_khz":74250,"refresh_rate":{"denominator":1000,"numerator":60053},"resolution":{"height":1080,"width":1920}}],)"
+                             R"("hdr_static_metadata":{"hlg":false,"max_frame_average_luminance":200.0,"max_luminance":400.0,"min_luminance":null,"smpte_st2084":true,"traditional_hdr":false,"traditional_sdr":true},"manufacturer_id":"LOL","modes_complete":true,"monitor_name":"Monitor",)"
+                             R"("preferred_timing":{"interlaced":false,"pixel_clock_khz":148500,"refresh_rate":{"denominator":1000,"numerator":60000},"resolution":{"height":1080,"width":1920}},"product_code":"ABCD","refresh_rate_range":{"max":120,"min":24},"serial_number":777777,)"
+                             R"("video_modes":[{"refresh_rate":{"denominator":1,"numerator":50},"resolution":{"height":720,"width":1280}}],"vrr_range":{"max":120,"min":40}})");
+}
+
+TEST_F_S(EdidData, OlderFormat) {
+  display_device::EdidData item {
+    .m_manufacturer_id = "LOL",
+    .m_product_code = "ABCD",
+    .m_serial_number = 777777
+  };
+  display_device::EdidData parsed_item {
+    .m_monitor_name = "Monitor",
+    .m_video_modes = {{{1280, 720}, {50, 1}}},
+    .m_modes_complete = true
+  };
+
+  EXPECT_TRUE(display_device::fromJson(R"({"manufacturer_id":"LOL","product_code":"ABCD","serial_number":777777})", parsed_item, nullptr));
+  EXPECT_EQ(parsed_item, item);
 
-  executeTestCase(display_device::EdidData {}, R"({"manufacturer_id":"","product_code":"","serial_number":0})");
-  executeTestCase(item, R"({"manufacturer_id":"LOL","product_code":"ABCD","serial_number":777777})");
+  display_device::EnumeratedDevice device {};
+  EXPECT_TRUE(display_device::fromJson(R"({"device_id":"ID_1","display_name":"","edid":{"manufacturer_id":"LOL","product_code":"ABCD","serial_number":777777},"friendly_name":"","info":null})", device, nullptr));
+  EXPECT_EQ(device.m_edid, item);
 }
 
 TEST_F_S(EnumeratedDevice) {
@@ -49,7 +86,7 @@ TEST_F_S(EnumeratedDevice) {
 
   executeTestCase(display_device::EnumeratedDevice {}, R"({"device_id":"","display_name":"","edid":null,"friendly_name":"","info":null})");
   executeTestCase(item_1, R"({"device_id":"ID_1","display_name":"NAME_2","edid":null,"friendly_name":"FU_NAME_3","info":{"hdr_state":"Enabled","origin_point":{"x":1,"y":2},"primary":false,"refresh_rate":{"type":"double","value":119.9554},"resolution":{"height":1080,"width":1920},"resolution_scale":{"type":"rational","value":{"denominator":100,"numerator":175}}}})");
-  executeTestCase(item_2, R"({"device_id":"ID_2","display_name":"NAME_2","edid":{"manufacturer_id":"","product_code":"","serial_number":0},"friendly_name":"FU_NAME_2","info":{"hdr_state":"Disabled","origin_point":{"x":0,"y":0},"primary":true,"refresh_rate":{"type":"rational","value":{"denominator":10000,"numerator":1199554}},"resolution":{"height":1080,"width":1920},"resolution_scale":{"type":"double","value":1.75}}})");
+  executeTestCase(item_2, R"({"device_id":"ID_2","display_name":"NAME_2","edid":{"detailed_timings":[],"hdr_static_metadata":null,"manufacturer_id":"","modes_complete":false,"monitor_name":"","preferred_timing":null,"product_code":"","refresh_rate_range":null,"serial_number":0,"video_modes":[],"vrr_range":null},"friendly_name":"FU_NAME_2","info":{"hdr_state":"Disabled","origin_point":{"x":0,"y":0},"primary":true,"refresh_rate":{"type":"rational","value":{"denominator":10000,"numerator":1199554}},"resolution":{"height":1080,"width":1920},"resolution_scale":{"type":"double","value":1.75}}})");
 }
 
 TEST_F_S(EnumeratedDeviceList) {
@@ -85,7 +122,7 @@ TEST_F_S(EnumeratedDeviceList) {
 
   executeTestCase(display_device::EnumeratedDeviceList {}, R"([])");
   executeTestCase(display_device::EnumeratedDeviceList {item_1, item_2, item_3}, R"([{"device_id":"ID_1","display_name":"NAME_2","edid":null,"friendly_name":"FU_NAME_3","info":{"hdr_state":"Enabled","origin_point":{"x":1,"y":2},"primary":false,"refresh_rate":{"type":"double","value":119.9554},"resolution":{"height":1080,"width":1920},"resolution_scale":{"type":"rational","value":{"denominator":100,"numerator":175}}}},)"
-                                                                                 R"({"device_id":"ID_2","display_name":"NAME_2","edid":{"manufacturer_id":"","product_code":"","serial_number":0},"friendly_name":"FU_NAME_2","info":{"hdr_state":"Disabled","origin_point":{"x":0,"y":0},"primary":true,"refresh_rate":{"type":"rational","value":{"denominator":10000,"numerator":1199554}},"resolution":{"height":1080,"width":1920},"resolution_scale":{"type":"double","value":1.75}}},)"
+                                                                                 R"({"device_id":"ID_2","display_name":"NAME_2","edid":{"detailed_timings":[],"hdr_static_metadata":null,"manufacturer_id":"","modes_complete":false,"monitor_name":"","preferred_timing":null,"product_code":"","refresh_rate_range":null,"serial_number":0,"video_modes":[],"vrr_range":null},"friendly_name":"FU_NAME_2","info":{"hdr_state":"Disabled","origin_point":{"x":0,"y":0},"primary":true,"refresh_rate":{"type":"rational","value":{"denominator":10000,"numerator":1199554}},"resolution":{"height":1080,"width":1920},"resolution_scale":{"type":"double","value":1.75}}},)"
                                                                                  R"({"device_id":"","display_name":"","edid":null,"friendly_name":"","info":null}])");
 }
 
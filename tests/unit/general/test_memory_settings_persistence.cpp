@@ -0,0 +1,34 @@
+// local includes
+#include "display_device/memory_settings_persistence.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Test fixture(s) for this file
+  class MemorySettingsPersistenceTest: public BaseTest {
+  public:
+    display_device::MemorySettingsPersistence m_impl;
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, MemorySettingsPersistenceTest, __VA_ARGS__)
+}  // namespace
+
+TEST_F_S(Load, NothingStored) {
+  EXPECT_EQ(m_impl.load(), std::vector<std::uint8_t> {});
+}
+
+TEST_F_S(Store, DataReplaced) {
+  const std::vector<std::uint8_t> data1 {'D', 'A', 'T', 'A', ' ', '1'};
+  const std::vector<std::uint8_t> data2 {'D', 'A', 'T', 'A', ' ', '2'};
+
+  EXPECT_TRUE(m_impl.store(data1));
+  EXPECT_EQ(m_impl.load(), data1);
+  EXPECT_TRUE(m_impl.store(data2));
+  EXPECT_EQ(m_impl.load(), data2);
+}
+
+TEST_F_S(Clear, DataDiscarded) {
+  EXPECT_TRUE(m_impl.store({'D', 'A', 'T', 'A'}));
+  EXPECT_TRUE(m_impl.clear());
+  EXPECT_EQ(m_impl.load(), std::vector<std::uint8_t> {});
+}
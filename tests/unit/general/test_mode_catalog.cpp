@@ -0,0 +1,116 @@
+// system includes
+#include <algorithm>
+
+// local includes
+#include "display_device/mode_catalog.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, ModeCatalog, __VA_ARGS__)
+
+  // Additional convenience global const(s)
+  const std::vector<display_device::ModeCatalog::Mode> DEFAULT_MODES {
+    {{2560, 1440}, {143998, 1000}},
+    {{1920, 1080}, {60, 1}},
+    {{2560, 1440}, {59951, 1000}},
+    {{2560, 1440}, {120, 1}},
+    {{1920, 1080}, {120, 1}}
+  };
+}  // namespace
+
+TEST_S(Empty) {
+  const display_device::ModeCatalog catalog;
+  EXPECT_TRUE(catalog.empty());
+  EXPECT_EQ(catalog.size(), 0);
+  EXPECT_EQ(catalog.findNearest({1920, 1080}, {60, 1}), std::nullopt);
+}
+
+TEST_S(SortedModes) {
+  const display_device::ModeCatalog catalog {DEFAULT_MODES};
+  const std::vector<display_device::ModeCatalog::Mode> expected_modes {
+    {{1920, 1080}, {60, 1}},
+    {{1920, 1080}, {120, 1}},
+    {{2560, 1440}, {59951, 1000}},
+    {{2560, 1440}, {120, 1}},
+    {{2560, 1440}, {143998, 1000}}
+  };
+
+  EXPECT_FALSE(catalog.empty());
+  EXPECT_EQ(catalog.size(), expected_modes.size());
+  EXPECT_TRUE(std::ranges::equal(catalog.getModes(), expected_modes));
+}
+
+TEST_S(InvalidAndDuplicateModesSkipped) {
+  const display_device::ModeCatalog catalog {{
+    {{1920, 1080}, {60, 1}},
+    {{1920, 1080}, {60, 0}},
+    {{70000, 1080}, {60, 1}},
+    {{1920, 1080}, {120, 2}},
+  }};
+
+  ASSERT_EQ(catalog.size(), 1);
+  EXPECT_EQ(catalog.getModes()[0], (display_device::ModeCatalog::Mode {{1920, 1080}, {60, 1}}));
+}
+
+TEST_S(FindNearest) {
+  const display_device::ModeCatalog catalog {DEFAULT_MODES};
+
+  EXPECT_EQ(catalog.findNearest({2560, 1440}, {60, 1}), (display_device::ModeCatalog::Mode {{2560, 1440}, {59951, 1000}}));
+  EXPECT_EQ(catalog.findNearest({2560, 1440}, {144, 1}), (display_device::ModeCatalog::Mode {{2560, 1440}, {143998, 1000}}));
+  EXPECT_EQ(catalog.findNearest({2560, 1440}, {1000, 1}), (display_device::ModeCatalog::Mode {{2560, 1440}, {143998, 1000}}));
+  EXPECT_EQ(catalog.findNearest({2560, 1440}, {1, 1}), (display_device::ModeCatalog::Mode {{2560, 1440}, {59951, 1000}}));
+  EXPECT_EQ(catalog.findNearest({1920, 1080}, {100, 1}), (display_device::ModeCatalog::Mode {{1920, 1080}, {120, 1}}));
+  EXPECT_EQ(catalog.findNearest({1920, 1080}, {240, 2}), (display_device::ModeCatalog::Mode {{1920, 1080}, {120, 1}}));
+}
+
+TEST_S(FindNearest, UnsupportedResolution) {
+  const display_device::ModeCatalog catalog {DEFAULT_MODES};
+
+  EXPECT_EQ(catalog.findNearest({1920, 1200}, {60, 1}), std::nullopt);
+  EXPECT_EQ(catalog.findNearest({2560, 1080}, {60, 1}), std::nullopt);
+  EXPECT_EQ(catalog.findNearest({70000, 1440}, {60, 1}), std::nullopt);
+  EXPECT_EQ(catalog.findNearest({2560, 1440}, {60, 0}), std::nullopt);
+}
+
+TEST_S(FindNearest, MaxDifference) {
+  const display_device::ModeCatalog catalog {DEFAULT_MODES};
+
+  EXPECT_EQ(catalog.findNearest({2560, 1440}, {60, 1}, 48), std::nullopt);
+  EXPECT_EQ(catalog.findNearest({2560, 1440}, {60, 1}, 49), (display_device::ModeCatalog::Mode {{2560, 1440}, {59951, 1000}}));
+  EXPECT_EQ(catalog.findNearest({1920, 1080}, {90, 1}, 900), std::nullopt);
+}
+
+TEST_S(FromEdid) {
+  auto edid {ut_consts::DEFAULT_EDID_DATA};
+  edid.m_detailed_timings.push_back({{1920, 1080}, {60, 1}, 148500, false});
+  edid.m_detailed_timings.push_back({{1920, 1080}, {30, 1}, 74250, true});
+
+  const auto catalog {display_device::ModeCatalog::fromEdid(edid)};
+  const std::vector<display_device::ModeCatalog::Mode> expected_modes {
+    {{640, 480}, {60, 1}},
+    {{800, 600}, {60, 1}},
+    {{1024, 768}, {60, 1}},
+    {{1920, 1080}, {60, 1}},
+    {{2560, 1440}, {59951, 1000}}
+  };
+  EXPECT_TRUE(std::ranges::equal(catalog.getModes(), expected_modes));
+  EXPECT_FALSE(catalog.isComplete());
+  EXPECT_TRUE(display_device::ModeCatalog::fromEdid({}).empty());
+}
+
+TEST_S(FromEdid, DetailedTimingsPreferred) {
+  display_device::EdidData edid;
+  edid.m_detailed_timings.push_back({{1920, 1080}, {60000, 1000}, 148500, false});
+  edid.m_video_modes.push_back({{1920, 1080}, {60, 1}});
+  edid.m_video_modes.push_back({{1280, 720}, {50, 1}});
+  edid.m_modes_complete = true;
+
+  const auto catalog {display_device::ModeCatalog::fromEdid(edid)};
+  const std::vector<display_device::ModeCatalog::Mode> expected_modes {
+    {{1280, 720}, {50, 1}},
+    {{1920, 1080}, {60000, 1000}}
+  };
+  EXPECT_TRUE(std::ranges::equal(catalog.getModes(), expected_modes));
+  EXPECT_TRUE(catalog.isComplete());
+}
@@ -0,0 +1,93 @@
+// system includes
+#include <cmath>
+
+// local includes
+#include "display_device/rational.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, Rational, __VA_ARGS__)
+
+  // Additional convenience global const(s)
+  constexpr unsigned int MAX_UINT {std::numeric_limits<unsigned int>::max()};
+
+  // The whole toolkit is usable at compile time
+  static_assert(display_device::rational::normalize({1200000, 10000}).m_numerator == 120);
+  static_assert(display_device::rational::compare({60000, 1001}, {5994, 100}) > 0);
+  static_assert(display_device::rational::isWithinTolerance({60, 1}, {5920, 100}, {9, 10}));
+  static_assert(display_device::rational::isWithinPpm({60000, 1001}, {5994, 100}, 10));
+  static_assert(display_device::rational::fromDouble(59.94, 1000)->m_numerator == 2997);
+}  // namespace
+
+TEST_S(Normalize) {
+  using display_device::rational::normalize;
+
+  EXPECT_EQ(normalize({1200000, 10000}), (display_device::Rational {120, 1}));
+  EXPECT_EQ(normalize({60000, 1001}), (display_device::Rational {60000, 1001}));
+  EXPECT_EQ(normalize({0, 5}), (display_device::Rational {0, 1}));
+  EXPECT_EQ(normalize({5, 0}), (display_device::Rational {5, 0}));
+}
+
+TEST_S(Compare) {
+  using display_device::rational::compare;
+  using display_device::rational::isEquivalent;
+
+  EXPECT_EQ(compare({1, 2}, {2, 4}), std::partial_ordering::equivalent);
+  EXPECT_EQ(compare({59940, 1000}, {60, 1}), std::partial_ordering::less);
+  EXPECT_EQ(compare({MAX_UINT, 1}, {MAX_UINT - 1, 1}), std::partial_ordering::greater);
+  EXPECT_EQ(compare({MAX_UINT, MAX_UINT}, {1, 1}), std::partial_ordering::equivalent);
+  EXPECT_EQ(compare({1, 0}, {1, 0}), std::partial_ordering::unordered);
+  EXPECT_TRUE(isEquivalent({1200000, 10000}, {120, 1}));
+  EXPECT_FALSE(isEquivalent({60000, 1001}, {60, 1}));
+}
+
+TEST_S(IsWithinTolerance) {
+  using display_device::rational::isWithinTolerance;
+
+  EXPECT_TRUE(isWithinTolerance({60, 1}, {5910, 100}, {9, 10}));
+  EXPECT_FALSE(isWithinTolerance({60, 1}, {5909, 100}, {9, 10}));
+  EXPECT_TRUE(isWithinTolerance({5910, 100}, {60, 1}, {9, 10}));
+  EXPECT_TRUE(isWithinTolerance({MAX_UINT, MAX_UINT - 1}, {MAX_UINT - 1, MAX_UINT}, {3, MAX_UINT}));
+  EXPECT_FALSE(isWithinTolerance({MAX_UINT, MAX_UINT - 1}, {MAX_UINT - 1, MAX_UINT}, {2, MAX_UINT}));
+  EXPECT_FALSE(isWithinTolerance({60, 0}, {60, 1}, {9, 10}));
+  EXPECT_FALSE(isWithinTolerance({60, 1}, {60, 1}, {9, 0}));
+}
+
+TEST_S(IsWithinPpm) {
+  using display_device::rational::isWithinPpm;
+
+  // 60000/1001 and 59.94 differ by ~0.94 ppm
+  EXPECT_TRUE(isWithinPpm({60000, 1001}, {5994, 100}, 1));
+  EXPECT_FALSE(isWithinPpm({60000, 1001}, {60, 1}, 999));
+  EXPECT_TRUE(isWithinPpm({60000, 1001}, {60, 1}, 1000));
+  EXPECT_TRUE(isWithinPpm({0, 1}, {0, 7}, 0));
+  EXPECT_TRUE(isWithinPpm({MAX_UINT, 1}, {MAX_UINT, 1}, 0));
+  EXPECT_FALSE(isWithinPpm({60, 1}, {60, 0}, 1000000));
+}
+
+TEST_S(ToDouble) {
+  using display_device::rational::toDouble;
+
+  EXPECT_DOUBLE_EQ(toDouble({5994, 100}), 59.94);
+  EXPECT_TRUE(std::isnan(toDouble({1, 0})));
+}
+
+TEST_S(FromDouble) {
+  using display_device::rational::fromDouble;
+
+  EXPECT_EQ(fromDouble(59.94, 1000), (display_device::Rational {2997, 50}));
+  EXPECT_EQ(fromDouble(59.94, 10), (display_device::Rational {599, 10}));
+  EXPECT_EQ(fromDouble(60000. / 1001., 2000), (display_device::Rational {60000, 1001}));
+  EXPECT_EQ(fromDouble(3.14159265358979, 100), (display_device::Rational {311, 99}));
+  EXPECT_EQ(fromDouble(0.3, 1), (display_device::Rational {0, 1}));
+  EXPECT_EQ(fromDouble(0.6, 1), (display_device::Rational {1, 1}));
+  EXPECT_EQ(fromDouble(120., 1), (display_device::Rational {120, 1}));
+  EXPECT_EQ(fromDouble(0., 10), (display_device::Rational {0, 1}));
+  EXPECT_EQ(fromDouble(static_cast<double>(MAX_UINT), 10), (display_device::Rational {MAX_UINT, 1}));
+  EXPECT_EQ(fromDouble(static_cast<double>(MAX_UINT) - 0.5, 10), (display_device::Rational {MAX_UINT - 1, 1}));
+  EXPECT_EQ(fromDouble(-1., 10), std::nullopt);
+  EXPECT_EQ(fromDouble(std::nan(""), 10), std::nullopt);
+  EXPECT_EQ(fromDouble(static_cast<double>(MAX_UINT) + 1., 10), std::nullopt);
+  EXPECT_EQ(fromDouble(1., 0), std::nullopt);
+}
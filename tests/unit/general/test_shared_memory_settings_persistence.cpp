@@ -0,0 +1,205 @@
+#ifndef _WIN32
+  // system includes
+  #include <algorithm>
+  #include <atomic>
+  #include <fcntl.h>
+  #include <gmock/gmock.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <thread>
+  #include <unistd.h>
+
+  // local includes
+  #include "display_device/shared_memory_settings_persistence.h"
+  #include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Test fixture(s) for this file
+  class SharedMemorySettingsPersistenceTest: public BaseTest {
+  public:
+    ~SharedMemorySettingsPersistenceTest() override {
+      static_cast<void>(display_device::SharedMemorySettingsPersistence::unlink(m_name));
+    }
+
+    /**
+     * @brief Create the object without sizing it, as if its creator had not gotten to it yet.
+     */
+    void createUnsizedObject() const {
+      const int object {::shm_open(m_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600)};
+      ASSERT_GE(object, 0);
+      ::close(object);
+    }
+
+    /**
+     * @brief Get the size of the object.
+     */
+    std::size_t getObjectSize() const {
+      const int object {::shm_open(m_name.c_str(), O_RDONLY, 0)};
+      if (object < 0) {
+        return 0;
+      }
+
+      struct stat object_stat {};
+      const auto result {::fstat(object, &object_stat)};
+      ::close(object);
+      return result == 0 ? static_cast<std::size_t>(object_stat.st_size) : 0;
+    }
+
+    const std::string m_name {"/libdisplaydevice_test_" + std::to_string(::getpid())};
+  };
+
+  // Specialized TEST macro(s) for this test file
+  #define TEST_F_S(...) DD_MAKE_TEST(TEST_F, SharedMemorySettingsPersistenceTest, __VA_ARGS__)
+
+  // Additional convenience global const(s)
+  const std::vector<std::uint8_t> DATA_1 {'D', 'A', 'T', 'A', ' ', '1'};
+  const std::vector<std::uint8_t> DATA_2 {'D', 'A', 'T', 'A', ' ', '2'};
+}  // namespace
+
+TEST_F_S(InvalidNameProvided) {
+  for (const std::string name : {"", "/", "no_slash", "/nested/name"}) {
+    EXPECT_THAT([&]() {
+      const display_device::SharedMemorySettingsPersistence persistence {name};
+    },
+                ThrowsMessage<std::runtime_error>(HasSubstr("Invalid name provided for SharedMemorySettingsPersistence!")));
+  }
+}
+
+TEST_F_S(ZeroCapacityProvided) {
+  EXPECT_THAT([&]() {
+    const display_device::SharedMemorySettingsPersistence persistence(m_name, 0);
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Capacity for SharedMemorySettingsPersistence must be larger than 0!")));
+}
+
+TEST_F_S(Store, SharedBetweenInstances) {
+  display_device::SharedMemorySettingsPersistence writer {m_name};
+  const display_device::SharedMemorySettingsPersistence reader {m_name};
+
+  EXPECT_EQ(reader.load(), std::vector<std::uint8_t> {});
+  EXPECT_TRUE(writer.store(DATA_1));
+  EXPECT_EQ(reader.load(), DATA_1);
+  EXPECT_TRUE(writer.store(DATA_2));
+  EXPECT_EQ(reader.load(), DATA_2);
+}
+
+TEST_F_S(Store, DataSurvivesInstance) {
+  {
+    display_device::SharedMemorySettingsPersistence writer {m_name};
+    EXPECT_TRUE(writer.store(DATA_1));
+  }
+
+  const display_device::SharedMemorySettingsPersistence reader {m_name};
+  EXPECT_EQ(reader.load(), DATA_1);
+}
+
+TEST_F_S(Store, CapacityExceeded) {
+  display_device::SharedMemorySettingsPersistence persistence {m_name, DATA_1.size() - 1};
+  EXPECT_FALSE(persistence.store(DATA_1));
+  EXPECT_EQ(persistence.load(), std::vector<std::uint8_t> {});
+}
+
+TEST_F_S(Store, SizedByCreatorOnly) {
+  display_device::SharedMemorySettingsPersistence creator {m_name, DATA_1.size()};
+  display_device::SharedMemorySettingsPersistence other_writer {m_name, 1024};
+
+  EXPECT_TRUE(creator.store(DATA_1));
+  const auto object_size {getObjectSize()};
+  EXPECT_GT(object_size, DATA_1.size());
+  EXPECT_LT(object_size, 1024);
+
+  // The capacity of the existing object is used
+  EXPECT_TRUE(other_writer.store(DATA_2));
+  EXPECT_FALSE(other_writer.store(std::vector<std::uint8_t>(DATA_2.size() + 1)));
+  EXPECT_EQ(getObjectSize(), object_size);
+  EXPECT_EQ(creator.load(), DATA_2);
+}
+
+TEST_F_S(Store, ObjectNotSizedByCreator) {
+  createUnsizedObject();
+
+  display_device::SharedMemorySettingsPersistence persistence {m_name};
+  EXPECT_FALSE(persistence.store(DATA_1));
+  EXPECT_EQ(getObjectSize(), 0);
+}
+
+TEST_F_S(Store, ConcurrentReadsConsistent) {
+  display_device::SharedMemorySettingsPersistence writer {m_name};
+  EXPECT_TRUE(writer.store({}));
+
+  std::atomic_bool done {false};
+  std::atomic_int inconsistent_reads {0};
+  std::thread reader_thread {[&]() {
+    const display_device::SharedMemorySettingsPersistence reader {m_name};
+    while (!done) {
+      const auto data {reader.load()};
+      // Every stored data consists of the same byte repeated as many times as its value
+      if (!data || !std::ranges::all_of(*data, [&](const auto byte) {
+            return byte == data->size();
+          })) {
+        inconsistent_reads++;
+      }
+    }
+  }};
+
+  for (int i = 0; i < 20000; ++i) {
+    const auto size {static_cast<std::uint8_t>(i % 256)};
+    EXPECT_TRUE(writer.store(std::vector<std::uint8_t>(size, size)));
+  }
+
+  done = true;
+  reader_thread.join();
+  EXPECT_EQ(inconsistent_reads, 0);
+}
+
+TEST_F_S(Load, NoObjectAvailable) {
+  const display_device::SharedMemorySettingsPersistence persistence {m_name};
+  EXPECT_EQ(persistence.load(), std::vector<std::uint8_t> {});
+}
+
+TEST_F_S(Load, ObjectNotSizedYet) {
+  createUnsizedObject();
+
+  const display_device::SharedMemorySettingsPersistence persistence {m_name};
+  EXPECT_EQ(persistence.load(), std::vector<std::uint8_t> {});
+  EXPECT_EQ(getObjectSize(), 0);
+}
+
+TEST_F_S(Clear, DataDiscarded) {
+  display_device::SharedMemorySettingsPersistence writer {m_name};
+  const display_device::SharedMemorySettingsPersistence reader {m_name};
+
+  EXPECT_TRUE(writer.store(DATA_1));
+  EXPECT_TRUE(writer.clear());
+  EXPECT_EQ(reader.load(), std::vector<std::uint8_t> {});
+}
+
+TEST_F_S(Clear, NoObjectAvailable) {
+  display_device::SharedMemorySettingsPersistence persistence {m_name};
+  EXPECT_TRUE(persistence.clear());
+}
+
+TEST_F_S(Clear, ObjectNotSizedYet) {
+  createUnsizedObject();
+
+  display_device::SharedMemorySettingsPersistence persistence {m_name};
+  EXPECT_TRUE(persistence.clear());
+  EXPECT_EQ(getObjectSize(), 0);
+}
+
+TEST_F_S(Unlink, ObjectRemoved) {
+  {
+    display_device::SharedMemorySettingsPersistence writer {m_name};
+    EXPECT_TRUE(writer.store(DATA_1));
+  }
+
+  EXPECT_TRUE(display_device::SharedMemorySettingsPersistence::unlink(m_name));
+  EXPECT_TRUE(display_device::SharedMemorySettingsPersistence::unlink(m_name));
+
+  const display_device::SharedMemorySettingsPersistence reader {m_name};
+  EXPECT_EQ(reader.load(), std::vector<std::uint8_t> {});
+}
+#endif
@@ -0,0 +1,62 @@
+// system includes
+#include <algorithm>
+#include <unordered_set>
+
+// local includes
+#include "display_device/windows/canonical_topology.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  using namespace display_device::literals;
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, CanonicalTopology, __VA_ARGS__)
+
+  // Convenience functions
+  display_device::CanonicalTopology makeCanonical(const display_device::ActiveTopology &topology) {
+    const auto canonical {display_device::CanonicalTopology::fromTopology(topology)};
+    EXPECT_TRUE(canonical);
+    return canonical.value_or(display_device::CanonicalTopology {});
+  }
+}  // namespace
+
+TEST_S(Empty) {
+  EXPECT_EQ(makeCanonical({}), display_device::CanonicalTopology {});
+  EXPECT_TRUE(display_device::CanonicalTopology {}.getGroups().empty());
+}
+
+TEST_S(OrderIndependent) {
+  const auto lhs {makeCanonical({{"ID_1"_id, "ID_2"_id}, {"ID_3"_id}, {"ID_4"_id}})};
+  const auto rhs {makeCanonical({{"ID_4"_id}, {"ID_3"_id}, {"ID_2"_id, "ID_1"_id}})};
+
+  EXPECT_EQ(lhs, rhs);
+  EXPECT_EQ(lhs.getHash(), rhs.getHash());
+  EXPECT_EQ(std::hash<display_device::CanonicalTopology> {}(lhs), lhs.getHash());
+}
+
+TEST_S(GroupsAreSorted) {
+  const auto canonical {makeCanonical({{"ID_2"_id, "ID_1"_id}, {"ID_3"_id}})};
+  const auto groups {canonical.getGroups()};
+
+  ASSERT_EQ(groups.size(), 2);
+  EXPECT_EQ(groups[0].getDeviceIds().size(), 1);
+  EXPECT_EQ(groups[0].getDeviceIds()[0], "ID_3");
+  ASSERT_EQ(groups[1].getDeviceIds().size(), 2);
+  EXPECT_TRUE(std::ranges::is_sorted(groups[1].getDeviceIds(), {}, &display_device::DeviceId::getHandle));
+}
+
+TEST_S(Different) {
+  EXPECT_NE(makeCanonical({{"ID_1"_id, "ID_2"_id}}), makeCanonical({{"ID_1"_id}, {"ID_2"_id}}));
+  EXPECT_NE(makeCanonical({{"ID_1"_id}}), makeCanonical({{"ID_2"_id}}));
+  EXPECT_NE(makeCanonical({{}}), makeCanonical({{}, {}}));
+  EXPECT_NE(makeCanonical({{"ID_1"_id}}), makeCanonical({{"ID_1"_id}, {"ID_1"_id}}));
+}
+
+TEST_S(UsableAsHashKey) {
+  const std::unordered_set<display_device::CanonicalTopology> topologies {makeCanonical({{"ID_1"_id}, {"ID_2"_id}}), makeCanonical({{"ID_2"_id}, {"ID_1"_id}}), makeCanonical({{"ID_1"_id, "ID_2"_id}})};
+  EXPECT_EQ(topologies.size(), 2);
+}
+
+TEST_S(OversizedGroup) {
+  EXPECT_EQ(display_device::CanonicalTopology::fromTopology({{"ID_1"_id, "ID_2"_id, "ID_3"_id}}), std::nullopt);
+}
@@ -3,6 +3,8 @@
 #include "fixtures/fixtures.h"
 
 namespace {
+  using namespace display_device::literals;
+
   // Specialized TEST macro(s) for this test file
 #define TEST_S(...) DD_MAKE_TEST(TEST, TypeComparison, __VA_ARGS__)
 }  // namespace
@@ -15,23 +17,23 @@ TEST_S(DisplayMode) {
 
 TEST_S(SingleDisplayConfigState, Initial) {
   using Initial = display_device::SingleDisplayConfigState::Initial;
-  EXPECT_EQ(Initial({{{"1"}}}, {"1"}), Initial({{{"1"}}}, {"1"}));
-  EXPECT_NE(Initial({{{"1"}}}, {"1"}), Initial({{{"0"}}}, {"1"}));
-  EXPECT_NE(Initial({{{"1"}}}, {"1"}), Initial({{{"1"}}}, {"0"}));
+  EXPECT_EQ(Initial({{{"1"_id}}}, {"1"}), Initial({{{"1"_id}}}, {"1"}));
+  EXPECT_NE(Initial({{{"1"_id}}}, {"1"}), Initial({{{"0"_id}}}, {"1"}));
+  EXPECT_NE(Initial({{{"1"_id}}}, {"1"}), Initial({{{"1"_id}}}, {"0"}));
 }
 
 TEST_S(SingleDisplayConfigState, Modified) {
   using Modified = display_device::SingleDisplayConfigState::Modified;
-  EXPECT_EQ(Modified({{{"1"}}}, {{"1", {}}}, {{"1", {}}}, "1"), Modified({{{"1"}}}, {{"1", {}}}, {{"1", {}}}, "1"));
-  EXPECT_NE(Modified({{{"1"}}}, {{"1", {}}}, {{"1", {}}}, "1"), Modified({{{"0"}}}, {{"1", {}}}, {{"1", {}}}, "1"));
-  EXPECT_NE(Modified({{{"1"}}}, {{"1", {}}}, {{"1", {}}}, "1"), Modified({{{"1"}}}, {{"0", {}}}, {{"1", {}}}, "1"));
-  EXPECT_NE(Modified({{{"1"}}}, {{"1", {}}}, {{"1", {}}}, "1"), Modified({{{"1"}}}, {{"1", {}}}, {{"0", {}}}, "1"));
-  EXPECT_NE(Modified({{{"1"}}}, {{"1", {}}}, {{"1", {}}}, "1"), Modified({{{"1"}}}, {{"1", {}}}, {{"1", {}}}, "0"));
+  EXPECT_EQ(Modified({{{"1"_id}}}, {{"1"_id, {}}}, {{"1"_id, {}}}, "1"), Modified({{{"1"_id}}}, {{"1"_id, {}}}, {{"1"_id, {}}}, "1"));
+  EXPECT_NE(Modified({{{"1"_id}}}, {{"1"_id, {}}}, {{"1"_id, {}}}, "1"), Modified({{{"0"_id}}}, {{"1"_id, {}}}, {{"1"_id, {}}}, "1"));
+  EXPECT_NE(Modified({{{"1"_id}}}, {{"1"_id, {}}}, {{"1"_id, {}}}, "1"), Modified({{{"1"_id}}}, {{"0"_id, {}}}, {{"1"_id, {}}}, "1"));
+  EXPECT_NE(Modified({{{"1"_id}}}, {{"1"_id, {}}}, {{"1"_id, {}}}, "1"), Modified({{{"1"_id}}}, {{"1"_id, {}}}, {{"0"_id, {}}}, "1"));
+  EXPECT_NE(Modified({{{"1"_id}}}, {{"1"_id, {}}}, {{"1"_id, {}}}, "1"), Modified({{{"1"_id}}}, {{"1"_id, {}}}, {{"1"_id, {}}}, "0"));
 }
 
 TEST_S(SingleDisplayConfigState) {
   using SDSC = display_device::SingleDisplayConfigState;
-  EXPECT_EQ(SDSC({{{"1"}}}, {{{"1"}}}), SDSC({{{"1"}}}, {{{"1"}}}));
-  EXPECT_NE(SDSC({{{"1"}}}, {{{"1"}}}), SDSC({{{"0"}}}, {{{"1"}}}));
-  EXPECT_NE(SDSC({{{"1"}}}, {{{"1"}}}), SDSC({{{"1"}}}, {{{"0"}}}));
+  EXPECT_EQ(SDSC({{{"1"_id}}}, {{{"1"_id}}}), SDSC({{{"1"_id}}}, {{{"1"_id}}}));
+  EXPECT_NE(SDSC({{{"1"_id}}}, {{{"1"_id}}}), SDSC({{{"0"_id}}}, {{{"1"_id}}}));
+  EXPECT_NE(SDSC({{{"1"_id}}}, {{{"1"_id}}}), SDSC({{{"1"_id}}}, {{{"0"_id}}}));
 }
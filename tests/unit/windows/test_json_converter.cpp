@@ -4,33 +4,35 @@
 #include "utils/comparison.h"
 
 namespace {
+  using namespace display_device::literals;
+
   // Specialized TEST macro(s) for this test file
 #define TEST_F_S(...) DD_MAKE_TEST(TEST_F, JsonConverterTest, __VA_ARGS__)
 }  // namespace
 
 TEST_F_S(ActiveTopology) {
   executeTestCase(display_device::ActiveTopology {}, R"([])");
-  executeTestCase(display_device::ActiveTopology {{"DeviceId1"}, {"DeviceId2", "DeviceId3"}, {"DeviceId4"}}, R"([["DeviceId1"],["DeviceId2","DeviceId3"],["DeviceId4"]])");
+  executeTestCase(display_device::ActiveTopology {{"DeviceId1"_id}, {"DeviceId2"_id, "DeviceId3"_id}, {"DeviceId4"_id}}, R"([["DeviceId1"],["DeviceId2","DeviceId3"],["DeviceId4"]])");
 }
 
 TEST_F_S(DeviceDisplayModeMap) {
   executeTestCase(display_device::DeviceDisplayModeMap {}, R"({})");
-  executeTestCase(display_device::DeviceDisplayModeMap {{"DeviceId1", {}}, {"DeviceId2", {{1920, 1080}, {120, 1}}}}, R"({"DeviceId1":{"refresh_rate":{"denominator":0,"numerator":0},"resolution":{"height":0,"width":0}},"DeviceId2":{"refresh_rate":{"denominator":1,"numerator":120},"resolution":{"height":1080,"width":1920}}})");
+  executeTestCase(display_device::DeviceDisplayModeMap {{"DeviceId1"_id, {}}, {"DeviceId2"_id, {{1920, 1080}, {120, 1}}}}, R"({"DeviceId1":{"refresh_rate":{"denominator":0,"numerator":0},"resolution":{"height":0,"width":0}},"DeviceId2":{"refresh_rate":{"denominator":1,"numerator":120},"resolution":{"height":1080,"width":1920}}})");
 }
 
 TEST_F_S(HdrStateMap) {
   executeTestCase(display_device::HdrStateMap {}, R"({})");
-  executeTestCase(display_device::HdrStateMap {{"DeviceId1", std::nullopt}, {"DeviceId2", display_device::HdrState::Enabled}}, R"({"DeviceId1":null,"DeviceId2":"Enabled"})");
+  executeTestCase(display_device::HdrStateMap {{"DeviceId1"_id, std::nullopt}, {"DeviceId2"_id, display_device::HdrState::Enabled}}, R"({"DeviceId1":null,"DeviceId2":"Enabled"})");
 }
 
 TEST_F_S(SingleDisplayConfigState) {
   const display_device::SingleDisplayConfigState valid_input {
-    {{{"DeviceId1"}},
+    {{{"DeviceId1"_id}},
      {"DeviceId1"}},
     {display_device::SingleDisplayConfigState::Modified {
-      {{"DeviceId2"}},
-      {{"DeviceId2", {{1920, 1080}, {120, 1}}}},
-      {{"DeviceId2", {display_device::HdrState::Disabled}}},
+      {{"DeviceId2"_id}},
+      {{"DeviceId2"_id, {{1920, 1080}, {120, 1}}}},
+      {{"DeviceId2"_id, {display_device::HdrState::Disabled}}},
       {"DeviceId2"},
     }}
   };
@@ -39,6 +41,28 @@ TEST_F_S(SingleDisplayConfigState) {
   executeTestCase(valid_input, R"({"initial":{"primary_devices":["DeviceId1"],"topology":[["DeviceId1"]]},"modified":{"original_hdr_states":{"DeviceId2":"Disabled"},"original_modes":{"DeviceId2":{"refresh_rate":{"denominator":1,"numerator":120},"resolution":{"height":1080,"width":1920}}},"original_primary_device":"DeviceId2","topology":[["DeviceId2"]]}})");
 }
 
+TEST_F_S(SingleDisplayConfigState, Versioned) {
+  const display_device::SingleDisplayConfigState input {
+    {{{"DeviceId1"_id}},
+     {"DeviceId1"}},
+    {}
+  };
+  const std::string expected_string {R"({"data":{"initial":{"primary_devices":["DeviceId1"],"topology":[["DeviceId1"]]},"modified":{"original_hdr_states":{},"original_modes":{},"original_primary_device":"","topology":[]}},"version":1})"};
+
+  bool success {false};
+  EXPECT_EQ(display_device::toVersionedJson(input, std::nullopt, &success), expected_string);
+  EXPECT_TRUE(success);
+
+  display_device::SingleDisplayConfigState output {};
+  EXPECT_TRUE(display_device::fromVersionedJson(expected_string, output));
+  EXPECT_EQ(output, input);
+
+  // Unversioned data is migrated
+  output = {};
+  EXPECT_TRUE(display_device::fromVersionedJson(display_device::toJson(input), output));
+  EXPECT_EQ(output, input);
+}
+
 TEST_F_S(WinWorkarounds) {
   display_device::WinWorkarounds input {
     std::chrono::milliseconds {500}
@@ -47,3 +71,28 @@ TEST_F_S(WinWorkarounds) {
   executeTestCase(display_device::WinWorkarounds {}, R"({"hdr_blank_delay":null})");
   executeTestCase(input, R"({"hdr_blank_delay":500})");
 }
+
+TEST_F_S(DisplaySettingsSnapshotDiff) {
+  display_device::DisplaySettingsSnapshotDiff input {
+    .m_topology = display_device::ActiveTopology {{"DeviceId1"_id}},
+    .m_modes = {{"DeviceId1"_id, {{1920, 1080}, {120, 1}}}},
+    .m_removed_modes = {"DeviceId2"},
+    .m_hdr_states = {{"DeviceId1"_id, display_device::HdrState::Enabled}},
+    .m_removed_hdr_states = {"Device/Id~2"_id},
+    .m_primary_device = "DeviceId1"
+  };
+
+  executeTestCase(display_device::DisplaySettingsSnapshotDiff {}, R"([])");
+  executeTestCase(input, R"([{"op":"replace","path":"/topology","value":[["DeviceId1"]]},{"op":"remove","path":"/modes/DeviceId2"},{"op":"add","path":"/modes/DeviceId1","value":{"refresh_rate":{"denominator":1,"numerator":120},"resolution":{"height":1080,"width":1920}}},{"op":"remove","path":"/hdr_states/Device~1Id~02"},{"op":"add","path":"/hdr_states/DeviceId1","value":"Enabled"},{"op":"replace","path":"/primary_device","value":"DeviceId1"}])");
+}
+
+TEST_F_S(DisplaySettingsSnapshotDiff, UnsupportedOperation) {
+  display_device::DisplaySettingsSnapshotDiff output {};
+  std::string error_message {};
+
+  EXPECT_FALSE(display_device::fromJson(R"([{"op":"remove","path":"/topology"}])", output, &error_message));
+  EXPECT_EQ(error_message, R"(Unsupported JSON patch operation "remove" for path "/topology"!)");
+
+  EXPECT_FALSE(display_device::fromJson(R"([{"op":"remove","path":"/modes/Device~2"}])", output, &error_message));
+  EXPECT_EQ(error_message, R"(Invalid escape sequence in JSON pointer token "Device~2"!)");
+}
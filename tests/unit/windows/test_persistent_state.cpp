@@ -1,5 +1,11 @@
+// system includes
+#include <boost/scope/scope_exit.hpp>
+#include <fstream>
+
 // local includes
+#include "display_device/file_settings_persistence.h"
 #include "display_device/noop_settings_persistence.h"
+#include "display_device/windows/json.h"
 #include "display_device/windows/settings_manager.h"
 #include "fixtures/fixtures.h"
 #include "fixtures/mock_settings_persistence.h"
@@ -30,6 +36,58 @@ namespace {
     std::unique_ptr<display_device::PersistentState> m_impl;
   };
 
+  // Output of the version 0 (pre-envelope) serializer for the SDCS_FULL state, as it was stored on the disk.
+  // It was captured from the old code and must never be regenerated with the current one.
+  const std::string LEGACY_V0_SDCS_FULL_FILE {R"({
+  "initial": {
+    "primary_devices": [
+      "DeviceId1"
+    ],
+    "topology": [
+      [
+        "DeviceId1"
+      ]
+    ]
+  },
+  "modified": {
+    "original_hdr_states": {
+      "DeviceId1": "Disabled",
+      "DeviceId3": "Enabled"
+    },
+    "original_modes": {
+      "DeviceId1": {
+        "refresh_rate": {
+          "denominator": 1,
+          "numerator": 120
+        },
+        "resolution": {
+          "height": 1080,
+          "width": 1920
+        }
+      },
+      "DeviceId3": {
+        "refresh_rate": {
+          "denominator": 1,
+          "numerator": 60
+        },
+        "resolution": {
+          "height": 1080,
+          "width": 1920
+        }
+      }
+    },
+    "original_primary_device": "DeviceId1",
+    "topology": [
+      [
+        "DeviceId1"
+      ],
+      [
+        "DeviceId3"
+      ]
+    ]
+  }
+})"};
+
   // Specialized TEST macro(s) for this test
 #define TEST_F_S_MOCKED(...) DD_MAKE_TEST(TEST_F, PersistentStateMocked, __VA_ARGS__)
 }  // namespace
@@ -90,6 +148,58 @@ TEST_F_S_MOCKED(InvalidPersitenceData, ThrowIsSuppressed) {
   EXPECT_EQ(getImpl(false).getState(), std::nullopt);
 }
 
+TEST_F_S_MOCKED(UnsupportedPersistenceDataVersion) {
+  const std::string data_string {R"({"version":999,"data":{}})"};
+  const std::vector<std::uint8_t> data {std::begin(data_string), std::end(data_string)};
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(data));
+
+  EXPECT_THAT([this]() {
+    getImpl(true);
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Failed to parse persistent settings! Error:\n"
+                                                          "Unsupported data version 999! Latest supported version is 1.")));
+}
+
+TEST_F_S_MOCKED(LegacyPersistenceDataMigrated) {
+  const auto data_string {toJson(*ut_consts::SDCS_FULL)};
+  const std::vector<std::uint8_t> data {std::begin(data_string), std::end(data_string)};
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(data));
+
+  // The migrated state is the same, therefore nothing is to be stored.
+  EXPECT_EQ(getImpl(true).getState(), ut_consts::SDCS_FULL);
+  EXPECT_TRUE(getImpl().persistState(ut_consts::SDCS_FULL));
+}
+
+TEST_F_S_MOCKED(LegacyPersistenceDataMigrated, OnDiskFileNotRewritten) {
+  const std::filesystem::path filepath {"legacy_persistent_state.json"};
+  const boost::scope::scope_exit cleanup {[&filepath]() {
+    std::filesystem::remove(filepath);
+  }};
+  {
+    std::ofstream stream {filepath, std::ios::binary};
+    stream << LEGACY_V0_SDCS_FULL_FILE;
+  }
+  const auto write_time {std::filesystem::last_write_time(filepath)};
+
+  {
+    display_device::PersistentState persistent_state {std::make_shared<display_device::FileSettingsPersistence>(filepath), true};
+    EXPECT_EQ(persistent_state.getState(), ut_consts::SDCS_FULL);
+    EXPECT_TRUE(persistent_state.persistState(ut_consts::SDCS_FULL));
+  }
+
+  std::ifstream stream {filepath, std::ios::binary};
+  const std::string file_data {std::istreambuf_iterator<char> {stream}, std::istreambuf_iterator<char> {}};
+  stream.close();
+  EXPECT_EQ(file_data, LEGACY_V0_SDCS_FULL_FILE);
+  EXPECT_EQ(std::filesystem::last_write_time(filepath), write_time);
+}
+
 TEST_F_S_MOCKED(NothingIsThrownOnSuccess) {
   EXPECT_CALL(*m_settings_persistence_api, load())
     .Times(1)
@@ -163,6 +273,23 @@ TEST_F_S_MOCKED(StoreState) {
   EXPECT_EQ(getImpl().getState(), ut_consts::SDCS_FULL);
 }
 
+TEST_F_S_MOCKED(StoreState, CompactJson) {
+  bool success {false};
+  const auto json_string {display_device::toVersionedJson(*ut_consts::SDCS_FULL, std::nullopt, &success)};
+  ASSERT_TRUE(success);
+
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(serializeState(ut_consts::SDCS_NO_MODIFICATIONS)));
+  EXPECT_CALL(*m_settings_persistence_api, store(std::vector<std::uint8_t> {std::begin(json_string), std::end(json_string)}))
+    .Times(1)
+    .WillOnce(Return(true));
+
+  display_device::PersistentState persistent_state {m_settings_persistence_api, false, std::nullopt};
+  EXPECT_TRUE(persistent_state.persistState(ut_consts::SDCS_FULL));
+  EXPECT_EQ(persistent_state.getState(), ut_consts::SDCS_FULL);
+}
+
 TEST_F_S_MOCKED(PersistStateSkippedDueToEqValues) {
   EXPECT_CALL(*m_settings_persistence_api, load())
     .Times(1)
@@ -172,3 +299,16 @@ TEST_F_S_MOCKED(PersistStateSkippedDueToEqValues) {
   EXPECT_TRUE(getImpl().persistState(ut_consts::SDCS_FULL));
   EXPECT_EQ(getImpl().getState(), ut_consts::SDCS_FULL);
 }
+
+TEST_F_S_MOCKED(PrefersIntermediateStates) {
+  EXPECT_CALL(*m_settings_persistence_api, load())
+    .Times(1)
+    .WillOnce(Return(serializeState(ut_consts::SDCS_EMPTY)));
+  EXPECT_CALL(*m_settings_persistence_api, prefersIntermediateStores())
+    .Times(2)
+    .WillOnce(Return(true))
+    .WillOnce(Return(false));
+
+  EXPECT_TRUE(getImpl().prefersIntermediateStates());
+  EXPECT_FALSE(getImpl().prefersIntermediateStates());
+}
@@ -10,13 +10,15 @@
 namespace {
   // Convenience keywords for GMock
   using ::testing::_;
+  using ::testing::AnyNumber;
   using ::testing::HasSubstr;
   using ::testing::InSequence;
   using ::testing::Return;
   using ::testing::StrictMock;
+  using namespace display_device::literals;
 
   // Additional convenience global const(s)
-  const display_device::ActiveTopology DEFAULT_CURRENT_TOPOLOGY {{"DeviceId1", "DeviceId2"}, {"DeviceId3"}};
+  const display_device::ActiveTopology DEFAULT_CURRENT_TOPOLOGY {{"DeviceId1"_id, "DeviceId2"_id}, {"DeviceId3"_id}};
   const display_device::EnumeratedDeviceList DEFAULT_DEVICES {
     {.m_device_id = "DeviceId1", .m_info = display_device::EnumeratedDevice::Info {.m_primary = true}},
     {.m_device_id = "DeviceId2", .m_info = display_device::EnumeratedDevice::Info {.m_primary = true}},
@@ -29,21 +31,45 @@ namespace {
     {.m_device_id = "DeviceId3", .m_info = display_device::EnumeratedDevice::Info {.m_primary = false}},
     {.m_device_id = "DeviceId4"}
   };
+  const display_device::EnumeratedDeviceList DEVICES_WITH_EDID {
+    {.m_device_id = "DeviceId1", .m_edid = ut_consts::DEFAULT_EDID_DATA, .m_info = display_device::EnumeratedDevice::Info {.m_primary = true}},
+    {.m_device_id = "DeviceId2", .m_info = display_device::EnumeratedDevice::Info {.m_primary = true}},
+    {.m_device_id = "DeviceId3", .m_info = display_device::EnumeratedDevice::Info {.m_primary = false}},
+    {.m_device_id = "DeviceId4"}
+  };
+  const display_device::EdidData COMPLETE_EDID_DATA {
+    .m_detailed_timings = {{{2560, 1440}, {59951, 1000}, 241500, false}},
+    .m_video_modes = {{{1920, 1080}, {60, 1}}},
+    .m_modes_complete = true
+  };
+  const display_device::EnumeratedDeviceList DEVICES_WITH_COMPLETE_EDID {
+    {.m_device_id = "DeviceId1", .m_edid = COMPLETE_EDID_DATA, .m_info = display_device::EnumeratedDevice::Info {.m_primary = true}},
+    {.m_device_id = "DeviceId2", .m_info = display_device::EnumeratedDevice::Info {.m_primary = true}},
+    {.m_device_id = "DeviceId3", .m_info = display_device::EnumeratedDevice::Info {.m_primary = false}},
+    {.m_device_id = "DeviceId4"}
+  };
   const display_device::DeviceDisplayModeMap DEFAULT_CURRENT_MODES {
-    {"DeviceId1", {{1080, 720}, {120, 1}}},
-    {"DeviceId2", {{1920, 1080}, {60, 1}}},
-    {"DeviceId3", {{2560, 1440}, {30, 1}}}
+    {"DeviceId1"_id, {{1080, 720}, {120, 1}}},
+    {"DeviceId2"_id, {{1920, 1080}, {60, 1}}},
+    {"DeviceId3"_id, {{2560, 1440}, {30, 1}}}
   };
   const display_device::HdrStateMap DEFAULT_CURRENT_HDR_STATES {
-    {"DeviceId1", display_device::HdrState::Disabled},
-    {"DeviceId2", display_device::HdrState::Disabled},
-    {"DeviceId3", std::nullopt}
+    {"DeviceId1"_id, display_device::HdrState::Disabled},
+    {"DeviceId2"_id, display_device::HdrState::Disabled},
+    {"DeviceId3"_id, std::nullopt}
   };
   const display_device::SingleDisplayConfigState DEFAULT_PERSISTENCE_INPUT_BASE {{DEFAULT_CURRENT_TOPOLOGY, {"DeviceId1", "DeviceId2"}}};
 
   // Test fixture(s) for this file
   class SettingsManagerApplyMocked: public BaseTest {
   public:
+    SettingsManagerApplyMocked() {
+      // Unless specified otherwise, the persistence behaves like a journal
+      EXPECT_CALL(*m_settings_persistence_api, prefersIntermediateStores())
+        .Times(AnyNumber())
+        .WillRepeatedly(Return(true));
+    }
+
     display_device::SettingsManager &getImpl() {
       if (!m_impl) {
         m_impl = std::make_unique<display_device::SettingsManager>(m_dd_api, m_audio_context_api, std::make_unique<display_device::PersistentState>(m_settings_persistence_api), display_device::WinWorkarounds {
@@ -128,6 +154,13 @@ namespace {
         .RetiresOnSaturation();
     }
 
+    void expectedPersistenceClearCall(InSequence &sequence /* To ensure that sequence is created outside this scope */) {
+      EXPECT_CALL(*m_settings_persistence_api, clear())
+        .Times(1)
+        .WillOnce(Return(true))
+        .RetiresOnSaturation();
+    }
+
     void expectedTopologyGuardNewlyCapturedContextCall(InSequence &sequence /* To ensure that sequence is created outside this scope */, const bool is_captured) {
       EXPECT_CALL(*m_audio_context_api, isCaptured())
         .Times(1)
@@ -176,7 +209,7 @@ namespace {
         .RetiresOnSaturation();
     }
 
-    void expectedGetCurrentDisplayModesCall(InSequence &sequence /* To ensure that sequence is created outside this scope */, const std::set<std::string> &devices, const display_device::DeviceDisplayModeMap &modes) {
+    void expectedGetCurrentDisplayModesCall(InSequence &sequence /* To ensure that sequence is created outside this scope */, const display_device::DeviceIdSet &devices, const display_device::DeviceDisplayModeMap &modes) {
       EXPECT_CALL(*m_dd_api, getCurrentDisplayModes(devices))
         .Times(1)
         .WillOnce(Return(modes))
@@ -197,7 +230,7 @@ namespace {
         .RetiresOnSaturation();
     }
 
-    void expectedGetCurrentHdrStatesCall(InSequence &sequence /* To ensure that sequence is created outside this scope */, const std::set<std::string> &devices, const display_device::HdrStateMap &states) {
+    void expectedGetCurrentHdrStatesCall(InSequence &sequence /* To ensure that sequence is created outside this scope */, const display_device::DeviceIdSet &devices, const display_device::HdrStateMap &states) {
       EXPECT_CALL(*m_dd_api, getCurrentHdrStates(devices))
         .Times(1)
         .WillOnce(Return(states))
@@ -350,8 +383,8 @@ TEST_F_S_MOCKED(PrepareTopology, RevertingSettingsFailed) {
   expectedDefaultCallsUntilTopologyPrep(sequence, DEFAULT_CURRENT_TOPOLOGY, ut_consts::SDCS_FULL);
   expectedIsCapturedCall(sequence, false);
   expectedDeviceEnumCall(sequence);
-  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"}});
-  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_modified.m_topology, {{"DeviceId1"}});
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"_id}});
+  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_modified.m_topology, {{"DeviceId1"_id}});
   EXPECT_CALL(*m_dd_api, isTopologyValid(ut_consts::SDCS_FULL->m_modified.m_topology))
     .Times(1)
     .WillOnce(Return(false))
@@ -370,7 +403,7 @@ TEST_F_S_MOCKED(PrepareTopology, AudioContextCaptureFailed) {
   expectedDefaultCallsUntilTopologyPrep(sequence);
   expectedIsCapturedCall(sequence, false);
   expectedDeviceEnumCall(sequence);
-  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"}});
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"_id}});
   expectedIsCapturedCall(sequence, false);
   expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, DEFAULT_CURRENT_TOPOLOGY);
   expectedCaptureCall(sequence, false);
@@ -388,11 +421,11 @@ TEST_F_S_MOCKED(PrepareTopology, TopologyChangeFailed) {
   expectedDefaultCallsUntilTopologyPrep(sequence);
   expectedIsCapturedCall(sequence, false);
   expectedDeviceEnumCall(sequence);
-  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"}});
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"_id}});
   expectedIsCapturedCall(sequence, false);
   expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, DEFAULT_CURRENT_TOPOLOGY);
   expectedCaptureCall(sequence, true);
-  EXPECT_CALL(*m_dd_api, setTopology(display_device::ActiveTopology {{"DeviceId1"}}))
+  EXPECT_CALL(*m_dd_api, setTopology(display_device::ActiveTopology {{"DeviceId1"_id}}))
     .Times(1)
     .WillOnce(Return(false))
     .RetiresOnSaturation();
@@ -407,18 +440,18 @@ TEST_F_S_MOCKED(PrepareTopology, TopologyChangeFailed) {
 TEST_F_S_MOCKED(PrepareTopology, AudioContextCaptured) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
-  persistence_input.m_modified = {{{"DeviceId1"}}};
+  persistence_input.m_modified = {{{"DeviceId1"_id}}};
 
   InSequence sequence;
   expectedDefaultCallsUntilTopologyPrep(sequence);
   expectedIsCapturedCall(sequence, false);
   expectedDeviceEnumCall(sequence);
-  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"}});
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"_id}});
   expectedIsCapturedCall(sequence, false);
   expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, DEFAULT_CURRENT_TOPOLOGY);
   expectedCaptureCall(sequence, true);
-  expectedSetTopologyCall(sequence, {{"DeviceId1"}});
-  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"}});
+  expectedSetTopologyCall(sequence, {{"DeviceId1"_id}});
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"_id}});
   expectedPersistenceCall(sequence, persistence_input);
   expectedHdrWorkaroundCalls(sequence);
 
@@ -428,19 +461,19 @@ TEST_F_S_MOCKED(PrepareTopology, AudioContextCaptured) {
 TEST_F_S_MOCKED(PrepareTopology, AudioContextCaptureSkipped, NotInitialTopologySwitch) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
   auto persistence_input {*ut_consts::SDCS_NO_MODIFICATIONS};
-  persistence_input.m_modified = {{{"DeviceId1"}}};
+  persistence_input.m_modified = {{{"DeviceId1"_id}}};
 
   InSequence sequence;
   expectedDefaultCallsUntilTopologyPrep(sequence, DEFAULT_CURRENT_TOPOLOGY, ut_consts::SDCS_NO_MODIFICATIONS);
   expectedIsCapturedCall(sequence, false);
   expectedDeviceEnumCall(sequence);
-  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"}});
-  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_modified.m_topology, {{"DeviceId1"}});
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"_id}});
+  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_modified.m_topology, {{"DeviceId1"_id}});
 
   expectedIsCapturedCall(sequence, false);
   expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_initial.m_topology, DEFAULT_CURRENT_TOPOLOGY);
-  expectedSetTopologyCall(sequence, {{"DeviceId1"}});
-  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_initial.m_topology, {{"DeviceId1"}});
+  expectedSetTopologyCall(sequence, {{"DeviceId1"_id}});
+  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_initial.m_topology, {{"DeviceId1"_id}});
   expectedPersistenceCall(sequence, persistence_input);
   expectedHdrWorkaroundCalls(sequence);
 
@@ -450,7 +483,7 @@ TEST_F_S_MOCKED(PrepareTopology, AudioContextCaptureSkipped, NotInitialTopologyS
 TEST_F_S_MOCKED(PrepareTopology, AudioContextCaptureSkipped, NoDevicesAreGone) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
-  persistence_input.m_modified = {{{"DeviceId1", "DeviceId2"}, {"DeviceId3"}, {"DeviceId4"}}};
+  persistence_input.m_modified = {{{"DeviceId1"_id, "DeviceId2"_id}, {"DeviceId3"_id}, {"DeviceId4"_id}}};
 
   InSequence sequence;
   expectedDefaultCallsUntilTopologyPrep(sequence);
@@ -469,7 +502,9 @@ TEST_F_S_MOCKED(PrepareTopology, AudioContextCaptureSkipped, NoDevicesAreGone) {
 
 TEST_F_S_MOCKED(PreparePrimaryDevice, FailedToGetPrimaryDevice) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
-  const display_device::ActiveTopology topology {{"DeviceId1", "DeviceId2"}, {"DeviceId3"}, {"DeviceId4"}};
+  const display_device::ActiveTopology topology {{"DeviceId1"_id, "DeviceId2"_id}, {"DeviceId3"_id}, {"DeviceId4"_id}};
+  auto topology_step_input {DEFAULT_PERSISTENCE_INPUT_BASE};
+  topology_step_input.m_modified.m_topology = topology;
 
   InSequence sequence;
   expectedDefaultCallsUntilTopologyPrep(sequence);
@@ -480,6 +515,7 @@ TEST_F_S_MOCKED(PreparePrimaryDevice, FailedToGetPrimaryDevice) {
   expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, DEFAULT_CURRENT_TOPOLOGY);
   expectedSetTopologyCall(sequence, topology);
   expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, topology);
+  expectedPersistenceCall(sequence, topology_step_input);
 
   expectedIsPrimaryCall(sequence, "DeviceId1", false);
   expectedIsPrimaryCall(sequence, "DeviceId2", false);
@@ -488,6 +524,7 @@ TEST_F_S_MOCKED(PreparePrimaryDevice, FailedToGetPrimaryDevice) {
 
   expectedTopologyGuardTopologyCall(sequence);
   expectedTopologyGuardNewlyCapturedContextCall(sequence, false);
+  expectedPersistenceClearCall(sequence);
   expectedHdrWorkaroundCalls(sequence);
 
   EXPECT_EQ(getImpl().applySettings({.m_device_id = "DeviceId4", .m_device_prep = DevicePrep::EnsurePrimary}), display_device::SettingsManager::ApplyResult::PrimaryDevicePrepFailed);
@@ -495,7 +532,38 @@ TEST_F_S_MOCKED(PreparePrimaryDevice, FailedToGetPrimaryDevice) {
 
 TEST_F_S_MOCKED(PreparePrimaryDevice, FailedToSetPrimaryDevice) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
-  const display_device::ActiveTopology topology {{"DeviceId1", "DeviceId2"}, {"DeviceId3"}, {"DeviceId4"}};
+  const display_device::ActiveTopology topology {{"DeviceId1"_id, "DeviceId2"_id}, {"DeviceId3"_id}, {"DeviceId4"_id}};
+  auto topology_step_input {DEFAULT_PERSISTENCE_INPUT_BASE};
+  topology_step_input.m_modified.m_topology = topology;
+
+  InSequence sequence;
+  expectedDefaultCallsUntilTopologyPrep(sequence);
+  expectedIsCapturedCall(sequence, false);
+  expectedDeviceEnumCall(sequence);
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, topology);
+  expectedIsCapturedCall(sequence, false);
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, DEFAULT_CURRENT_TOPOLOGY);
+  expectedSetTopologyCall(sequence, topology);
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, topology);
+  expectedPersistenceCall(sequence, topology_step_input);
+
+  expectedIsPrimaryCall(sequence, "DeviceId1");
+  expectedSetAsPrimaryCall(sequence, "DeviceId4", false);
+
+  expectedTopologyGuardTopologyCall(sequence);
+  expectedTopologyGuardNewlyCapturedContextCall(sequence, false);
+  expectedPersistenceClearCall(sequence);
+  expectedHdrWorkaroundCalls(sequence);
+
+  EXPECT_EQ(getImpl().applySettings({.m_device_id = "DeviceId4", .m_device_prep = DevicePrep::EnsurePrimary}), display_device::SettingsManager::ApplyResult::PrimaryDevicePrepFailed);
+}
+
+TEST_F_S_MOCKED(PreparePrimaryDevice, FailedToSetPrimaryDevice, NoIntermediateStores) {
+  using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
+  const display_device::ActiveTopology topology {{"DeviceId1"_id, "DeviceId2"_id}, {"DeviceId3"_id}, {"DeviceId4"_id}};
+  EXPECT_CALL(*m_settings_persistence_api, prefersIntermediateStores())
+    .Times(AnyNumber())
+    .WillRepeatedly(Return(false));
 
   InSequence sequence;
   expectedDefaultCallsUntilTopologyPrep(sequence);
@@ -520,7 +588,8 @@ TEST_F_S_MOCKED(PreparePrimaryDevice, FailedToSetPrimaryDevice) {
 TEST_F_S_MOCKED(PreparePrimaryDevice, PrimaryDeviceSet) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
-  persistence_input.m_modified.m_topology = {{"DeviceId1", "DeviceId2"}, {"DeviceId3"}, {"DeviceId4"}};
+  persistence_input.m_modified.m_topology = {{"DeviceId1"_id, "DeviceId2"_id}, {"DeviceId3"_id}, {"DeviceId4"_id}};
+  auto topology_step_input {persistence_input};
   persistence_input.m_modified.m_original_primary_device = "DeviceId1";
 
   InSequence sequence;
@@ -532,6 +601,7 @@ TEST_F_S_MOCKED(PreparePrimaryDevice, PrimaryDeviceSet) {
   expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, DEFAULT_CURRENT_TOPOLOGY);
   expectedSetTopologyCall(sequence, persistence_input.m_modified.m_topology);
   expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, persistence_input.m_modified.m_topology);
+  expectedPersistenceCall(sequence, topology_step_input);
 
   expectedIsPrimaryCall(sequence, "DeviceId1");
   expectedSetAsPrimaryCall(sequence, "DeviceId4");
@@ -544,7 +614,7 @@ TEST_F_S_MOCKED(PreparePrimaryDevice, PrimaryDeviceSet) {
 TEST_F_S_MOCKED(PreparePrimaryDevice, PrimaryDeviceSet, CachedDeviceReused) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
   auto initial_state {DEFAULT_PERSISTENCE_INPUT_BASE};
-  initial_state.m_modified.m_topology = {{"DeviceId1", "DeviceId2"}, {"DeviceId3"}, {"DeviceId4"}};
+  initial_state.m_modified.m_topology = {{"DeviceId1"_id, "DeviceId2"_id}, {"DeviceId3"_id}, {"DeviceId4"_id}};
   initial_state.m_modified.m_original_primary_device = "DeviceId1";
 
   InSequence sequence;
@@ -565,7 +635,8 @@ TEST_F_S_MOCKED(PreparePrimaryDevice, PrimaryDeviceSet, CachedDeviceReused) {
 TEST_F_S_MOCKED(PreparePrimaryDevice, PrimaryDeviceSet, GuardInvoked) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
-  persistence_input.m_modified.m_topology = {{"DeviceId1", "DeviceId2"}, {"DeviceId3"}, {"DeviceId4"}};
+  persistence_input.m_modified.m_topology = {{"DeviceId1"_id, "DeviceId2"_id}, {"DeviceId3"_id}, {"DeviceId4"_id}};
+  auto topology_step_input {persistence_input};
   persistence_input.m_modified.m_original_primary_device = "DeviceId1";
 
   InSequence sequence;
@@ -577,6 +648,7 @@ TEST_F_S_MOCKED(PreparePrimaryDevice, PrimaryDeviceSet, GuardInvoked) {
   expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, DEFAULT_CURRENT_TOPOLOGY);
   expectedSetTopologyCall(sequence, persistence_input.m_modified.m_topology);
   expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, persistence_input.m_modified.m_topology);
+  expectedPersistenceCall(sequence, topology_step_input);
 
   expectedIsPrimaryCall(sequence, "DeviceId1");
   expectedSetAsPrimaryCall(sequence, "DeviceId4");
@@ -585,6 +657,7 @@ TEST_F_S_MOCKED(PreparePrimaryDevice, PrimaryDeviceSet, GuardInvoked) {
   expectedPrimaryGuardCall(sequence, "DeviceId1");
   expectedTopologyGuardTopologyCall(sequence);
   expectedTopologyGuardNewlyCapturedContextCall(sequence, false);
+  expectedPersistenceClearCall(sequence);
   expectedHdrWorkaroundCalls(sequence);
 
   EXPECT_EQ(getImpl().applySettings({.m_device_id = "DeviceId4", .m_device_prep = DevicePrep::EnsurePrimary}), display_device::SettingsManager::ApplyResult::PersistenceSaveFailed);
@@ -593,7 +666,8 @@ TEST_F_S_MOCKED(PreparePrimaryDevice, PrimaryDeviceSet, GuardInvoked) {
 TEST_F_S_MOCKED(PreparePrimaryDevice, PrimaryDeviceSetSkipped) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
-  persistence_input.m_modified.m_topology = {{"DeviceId1", "DeviceId2"}, {"DeviceId3"}, {"DeviceId4"}};
+  persistence_input.m_modified.m_topology = {{"DeviceId1"_id, "DeviceId2"_id}, {"DeviceId3"_id}, {"DeviceId4"_id}};
+  auto topology_step_input {persistence_input};
   persistence_input.m_modified.m_original_primary_device = "DeviceId4";
 
   InSequence sequence;
@@ -605,6 +679,7 @@ TEST_F_S_MOCKED(PreparePrimaryDevice, PrimaryDeviceSetSkipped) {
   expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, DEFAULT_CURRENT_TOPOLOGY);
   expectedSetTopologyCall(sequence, persistence_input.m_modified.m_topology);
   expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, persistence_input.m_modified.m_topology);
+  expectedPersistenceCall(sequence, topology_step_input);
 
   expectedIsPrimaryCall(sequence, "DeviceId1", false);
   expectedIsPrimaryCall(sequence, "DeviceId2", false);
@@ -614,6 +689,7 @@ TEST_F_S_MOCKED(PreparePrimaryDevice, PrimaryDeviceSetSkipped) {
 
   expectedTopologyGuardTopologyCall(sequence);
   expectedTopologyGuardNewlyCapturedContextCall(sequence, false);
+  expectedPersistenceClearCall(sequence);
   expectedHdrWorkaroundCalls(sequence);
 
   EXPECT_EQ(getImpl().applySettings({.m_device_id = "DeviceId4", .m_device_prep = DevicePrep::EnsurePrimary}), display_device::SettingsManager::ApplyResult::PersistenceSaveFailed);
@@ -729,9 +805,52 @@ TEST_F_S_MOCKED(PrepareDisplayModes, FailedToGetDisplayModes) {
   EXPECT_EQ(getImpl().applySettings({.m_device_id = "DeviceId1", .m_resolution = {{1920, 1080}}}), display_device::SettingsManager::ApplyResult::DisplayModePrepFailed);
 }
 
+TEST_F_S_MOCKED(PrepareDisplayModes, FailedToGetDisplayModes, RevertedStateRestored) {
+  using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
+  auto intial_state {ut_consts::SDCS_NO_MODIFICATIONS};
+  intial_state->m_modified.m_original_primary_device = "DeviceId1";
+  auto topology_step_input {*ut_consts::SDCS_NO_MODIFICATIONS};
+  topology_step_input.m_modified = {{{"DeviceId1"_id}}};
+
+  InSequence sequence;
+  expectedDefaultCallsUntilTopologyPrep(sequence, DEFAULT_CURRENT_TOPOLOGY, intial_state);
+  expectedIsCapturedCall(sequence, false);
+  expectedDeviceEnumCall(sequence);
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"_id}});
+  expectedIsTopologyTheSameCall(sequence, intial_state->m_modified.m_topology, {{"DeviceId1"_id}});
+
+  // The previous settings are reverted and the cleared state is persisted
+  EXPECT_CALL(*m_dd_api, isTopologyValid(intial_state->m_modified.m_topology))
+    .Times(1)
+    .WillOnce(Return(true))
+    .RetiresOnSaturation();
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, intial_state->m_modified.m_topology);
+  expectedSetTopologyCall(sequence, intial_state->m_modified.m_topology);
+  expectedIsPrimaryCall(sequence, "DeviceId1", false);
+  expectedIsPrimaryCall(sequence, "DeviceId3");
+  expectedSetAsPrimaryCall(sequence, "DeviceId1");
+  expectedPersistenceCall(sequence, ut_consts::SDCS_NO_MODIFICATIONS);
+
+  expectedIsCapturedCall(sequence, false);
+  expectedIsTopologyTheSameCall(sequence, intial_state->m_initial.m_topology, DEFAULT_CURRENT_TOPOLOGY);
+  expectedSetTopologyCall(sequence, {{"DeviceId1"_id}});
+  expectedIsTopologyTheSameCall(sequence, intial_state->m_initial.m_topology, {{"DeviceId1"_id}});
+  expectedPersistenceCall(sequence, topology_step_input);
+
+  expectedGetCurrentDisplayModesCall(sequence, display_device::win_utils::flattenTopology({{"DeviceId1"_id}}), {});
+
+  expectedTopologyGuardTopologyCall(sequence);
+  expectedTopologyGuardNewlyCapturedContextCall(sequence, false);
+  // The original primary device has already been restored, so it must not be persisted again
+  expectedPersistenceCall(sequence, ut_consts::SDCS_NO_MODIFICATIONS);
+  expectedHdrWorkaroundCalls(sequence);
+
+  EXPECT_EQ(getImpl().applySettings({.m_device_id = "DeviceId1", .m_device_prep = DevicePrep::EnsureOnlyDisplay, .m_resolution = {{1920, 1080}}}), display_device::SettingsManager::ApplyResult::DisplayModePrepFailed);
+}
+
 TEST_F_S_MOCKED(PrepareDisplayModes, FailedToSetDisplayModes) {
   auto new_modes {DEFAULT_CURRENT_MODES};
-  new_modes["DeviceId1"].m_resolution = {1920, 1080};
+  new_modes["DeviceId1"_id].m_resolution = {1920, 1080};
 
   InSequence sequence;
   expectedDefaultCallsUntilTopologyPrep(sequence);
@@ -751,7 +870,7 @@ TEST_F_S_MOCKED(PrepareDisplayModes, FailedToSetDisplayModes) {
 
 TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, ResolutionOnly) {
   auto new_modes {DEFAULT_CURRENT_MODES};
-  new_modes["DeviceId1"].m_resolution = {1920, 1080};
+  new_modes["DeviceId1"_id].m_resolution = {1920, 1080};
 
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
   persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -774,7 +893,7 @@ TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, ResolutionOnly) {
 
 TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, RefreshRateOnly) {
   auto new_modes {DEFAULT_CURRENT_MODES};
-  new_modes["DeviceId1"].m_refresh_rate = {308500, 10000};
+  new_modes["DeviceId1"_id].m_refresh_rate = {308500, 10000};
 
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
   persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -797,8 +916,8 @@ TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, RefreshRateOnly) {
 
 TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, ResolutionAndRefreshRate) {
   auto new_modes {DEFAULT_CURRENT_MODES};
-  new_modes["DeviceId1"].m_resolution = {1920, 1080};
-  new_modes["DeviceId1"].m_refresh_rate = {308500, 10000};
+  new_modes["DeviceId1"_id].m_resolution = {1920, 1080};
+  new_modes["DeviceId1"_id].m_refresh_rate = {308500, 10000};
 
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
   persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -819,12 +938,110 @@ TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, ResolutionAndRefreshRate)
   EXPECT_EQ(getImpl().applySettings({.m_device_id = "DeviceId1", .m_resolution = {{1920, 1080}}, .m_refresh_rate = {{30.85}}}), display_device::SettingsManager::ApplyResult::Ok);
 }
 
+TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, ExactRefreshRatePreserved) {
+  auto new_modes {DEFAULT_CURRENT_MODES};
+  new_modes["DeviceId1"_id] = {{1920, 1080}, {60, 1}};
+
+  auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
+  persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
+  persistence_input.m_modified.m_original_modes = DEFAULT_CURRENT_MODES;
+
+  InSequence sequence;
+  expectedDefaultCallsUntilTopologyPrep(sequence);
+  expectedIsCapturedCall(sequence, false);
+  expectedDeviceEnumCall(sequence, DEVICES_WITH_COMPLETE_EDID);
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, DEFAULT_CURRENT_TOPOLOGY);
+
+  expectedGetCurrentDisplayModesCall(sequence, display_device::win_utils::flattenTopology(DEFAULT_CURRENT_TOPOLOGY), DEFAULT_CURRENT_MODES);
+  expectedSetDisplayModesWithFallbackCall(sequence, new_modes);
+  expectedGetCurrentDisplayModesCall(sequence, display_device::win_utils::flattenTopology(DEFAULT_CURRENT_TOPOLOGY), new_modes);
+  expectedPersistenceCall(sequence, persistence_input);
+  expectedHdrWorkaroundCalls(sequence);
+
+  EXPECT_EQ(getImpl().applySettings({.m_device_id = "DeviceId1", .m_resolution = {{1920, 1080}}, .m_refresh_rate = {display_device::Rational {60, 1}}}), display_device::SettingsManager::ApplyResult::Ok);
+}
+
+TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, SnappedBeforeSetting) {
+  // The complete EDID only lists 2560x1440@59.951, so it is set right away instead of the requested 60 Hz
+  auto snapped_modes {DEFAULT_CURRENT_MODES};
+  snapped_modes["DeviceId1"_id] = {{2560, 1440}, {59951, 1000}};
+  snapped_modes["DeviceId2"_id].m_resolution = {2560, 1440};
+
+  auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
+  persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
+  persistence_input.m_modified.m_original_modes = DEFAULT_CURRENT_MODES;
+
+  InSequence sequence;
+  expectedDefaultCallsUntilTopologyPrep(sequence);
+  expectedIsCapturedCall(sequence, false);
+  expectedDeviceEnumCall(sequence, DEVICES_WITH_COMPLETE_EDID);
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, DEFAULT_CURRENT_TOPOLOGY);
+
+  expectedGetCurrentDisplayModesCall(sequence, display_device::win_utils::flattenTopology(DEFAULT_CURRENT_TOPOLOGY), DEFAULT_CURRENT_MODES);
+  expectedSetDisplayModesWithFallbackCall(sequence, snapped_modes);
+  expectedGetCurrentDisplayModesCall(sequence, display_device::win_utils::flattenTopology(DEFAULT_CURRENT_TOPOLOGY), snapped_modes);
+  expectedPersistenceCall(sequence, persistence_input);
+  expectedHdrWorkaroundCalls(sequence);
+
+  EXPECT_EQ(getImpl().applySettings({.m_device_id = "DeviceId1", .m_resolution = {{2560, 1440}}, .m_refresh_rate = {display_device::Rational {60, 1}}}), display_device::SettingsManager::ApplyResult::Ok);
+}
+
+TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, UnlistedResolutionLeftToOs) {
+  // The complete EDID does not list 1280x1024, but the GPU can still scale it
+  auto new_modes {DEFAULT_CURRENT_MODES};
+  new_modes["DeviceId1"_id].m_resolution = {1280, 1024};
+  new_modes["DeviceId2"_id].m_resolution = {1280, 1024};
+
+  auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
+  persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
+  persistence_input.m_modified.m_original_modes = DEFAULT_CURRENT_MODES;
+
+  InSequence sequence;
+  expectedDefaultCallsUntilTopologyPrep(sequence);
+  expectedIsCapturedCall(sequence, false);
+  expectedDeviceEnumCall(sequence, DEVICES_WITH_COMPLETE_EDID);
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, DEFAULT_CURRENT_TOPOLOGY);
+
+  expectedGetCurrentDisplayModesCall(sequence, display_device::win_utils::flattenTopology(DEFAULT_CURRENT_TOPOLOGY), DEFAULT_CURRENT_MODES);
+  expectedSetDisplayModesWithFallbackCall(sequence, new_modes);
+  expectedGetCurrentDisplayModesCall(sequence, display_device::win_utils::flattenTopology(DEFAULT_CURRENT_TOPOLOGY), new_modes);
+  expectedPersistenceCall(sequence, persistence_input);
+  expectedHdrWorkaroundCalls(sequence);
+
+  EXPECT_EQ(getImpl().applySettings({.m_device_id = "DeviceId1", .m_resolution = {{1280, 1024}}}), display_device::SettingsManager::ApplyResult::Ok);
+}
+
+TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, IncompleteCatalogNotSnapped) {
+  // The EDID only lists 2560x1440@59.951, but it might not list every mode
+  auto new_modes {DEFAULT_CURRENT_MODES};
+  new_modes["DeviceId1"_id] = {{2560, 1440}, {60, 1}};
+  new_modes["DeviceId2"_id].m_resolution = {2560, 1440};
+
+  auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
+  persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
+  persistence_input.m_modified.m_original_modes = DEFAULT_CURRENT_MODES;
+
+  InSequence sequence;
+  expectedDefaultCallsUntilTopologyPrep(sequence);
+  expectedIsCapturedCall(sequence, false);
+  expectedDeviceEnumCall(sequence, DEVICES_WITH_EDID);
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, DEFAULT_CURRENT_TOPOLOGY);
+
+  expectedGetCurrentDisplayModesCall(sequence, display_device::win_utils::flattenTopology(DEFAULT_CURRENT_TOPOLOGY), DEFAULT_CURRENT_MODES);
+  expectedSetDisplayModesWithFallbackCall(sequence, new_modes);
+  expectedGetCurrentDisplayModesCall(sequence, display_device::win_utils::flattenTopology(DEFAULT_CURRENT_TOPOLOGY), new_modes);
+  expectedPersistenceCall(sequence, persistence_input);
+  expectedHdrWorkaroundCalls(sequence);
+
+  EXPECT_EQ(getImpl().applySettings({.m_device_id = "DeviceId1", .m_resolution = {{2560, 1440}}, .m_refresh_rate = {display_device::Rational {60, 1}}}), display_device::SettingsManager::ApplyResult::Ok);
+}
+
 TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, ResolutionAndRefreshRate, PrimaryDeviceSpecified) {
   auto new_modes {DEFAULT_CURRENT_MODES};
-  new_modes["DeviceId1"].m_resolution = {1920, 1080};
-  new_modes["DeviceId1"].m_refresh_rate = {308500, 10000};
-  new_modes["DeviceId2"].m_resolution = {1920, 1080};
-  new_modes["DeviceId2"].m_refresh_rate = {308500, 10000};
+  new_modes["DeviceId1"_id].m_resolution = {1920, 1080};
+  new_modes["DeviceId1"_id].m_refresh_rate = {308500, 10000};
+  new_modes["DeviceId2"_id].m_resolution = {1920, 1080};
+  new_modes["DeviceId2"_id].m_refresh_rate = {308500, 10000};
 
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
   persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -847,7 +1064,7 @@ TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, ResolutionAndRefreshRate,
 
 TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, CachedModesReused) {
   auto new_modes {DEFAULT_CURRENT_MODES};
-  new_modes["DeviceId1"].m_resolution = {1920, 1080};
+  new_modes["DeviceId1"_id].m_resolution = {1920, 1080};
 
   auto initial_state {DEFAULT_PERSISTENCE_INPUT_BASE};
   initial_state.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -869,7 +1086,7 @@ TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, CachedModesReused) {
 
 TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, GuardInvoked) {
   auto new_modes {DEFAULT_CURRENT_MODES};
-  new_modes["DeviceId1"].m_resolution = {1920, 1080};
+  new_modes["DeviceId1"_id].m_resolution = {1920, 1080};
 
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
   persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -896,7 +1113,7 @@ TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, GuardInvoked) {
 
 TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesSet, GuardNotInvoked) {
   auto new_modes {DEFAULT_CURRENT_MODES};
-  new_modes["DeviceId1"].m_resolution = {1920, 1080};
+  new_modes["DeviceId1"_id].m_resolution = {1920, 1080};
 
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
   persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -940,7 +1157,7 @@ TEST_F_S_MOCKED(PrepareDisplayModes, FailedToRestoreDisplayModes) {
   auto initial_state {DEFAULT_PERSISTENCE_INPUT_BASE};
   initial_state.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
   initial_state.m_modified.m_original_modes = DEFAULT_CURRENT_MODES;
-  initial_state.m_modified.m_original_modes["DeviceId1"].m_resolution = {1920, 1080};
+  initial_state.m_modified.m_original_modes["DeviceId1"_id].m_resolution = {1920, 1080};
 
   InSequence sequence;
   expectedDefaultCallsUntilTopologyPrep(sequence, DEFAULT_CURRENT_TOPOLOGY, initial_state);
@@ -962,7 +1179,7 @@ TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesRestored) {
   auto initial_state {DEFAULT_PERSISTENCE_INPUT_BASE};
   initial_state.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
   initial_state.m_modified.m_original_modes = DEFAULT_CURRENT_MODES;
-  initial_state.m_modified.m_original_modes["DeviceId1"].m_resolution = {1920, 1080};
+  initial_state.m_modified.m_original_modes["DeviceId1"_id].m_resolution = {1920, 1080};
 
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
   persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -986,7 +1203,7 @@ TEST_F_S_MOCKED(PrepareDisplayModes, DisplayModesRestored, PersistenceFailed) {
   auto initial_state {DEFAULT_PERSISTENCE_INPUT_BASE};
   initial_state.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
   initial_state.m_modified.m_original_modes = DEFAULT_CURRENT_MODES;
-  initial_state.m_modified.m_original_modes["DeviceId1"].m_resolution = {1920, 1080};
+  initial_state.m_modified.m_original_modes["DeviceId1"_id].m_resolution = {1920, 1080};
 
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
   persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -1050,7 +1267,7 @@ TEST_F_S_MOCKED(PrepareHdrStates, FailedToGetHdrStates) {
 
 TEST_F_S_MOCKED(PrepareHdrStates, FailedToSetHdrStates) {
   auto new_states {DEFAULT_CURRENT_HDR_STATES};
-  new_states["DeviceId1"] = display_device::HdrState::Enabled;
+  new_states["DeviceId1"_id] = display_device::HdrState::Enabled;
 
   InSequence sequence;
   expectedDefaultCallsUntilTopologyPrep(sequence);
@@ -1070,7 +1287,7 @@ TEST_F_S_MOCKED(PrepareHdrStates, FailedToSetHdrStates) {
 
 TEST_F_S_MOCKED(PrepareHdrStates, HdrStatesSet) {
   auto new_states {DEFAULT_CURRENT_HDR_STATES};
-  new_states["DeviceId1"] = display_device::HdrState::Enabled;
+  new_states["DeviceId1"_id] = display_device::HdrState::Enabled;
 
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
   persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -1092,8 +1309,8 @@ TEST_F_S_MOCKED(PrepareHdrStates, HdrStatesSet) {
 
 TEST_F_S_MOCKED(PrepareHdrStates, HdrStatesSet, PrimaryDeviceSpecified) {
   auto new_states {DEFAULT_CURRENT_HDR_STATES};
-  new_states["DeviceId1"] = display_device::HdrState::Enabled;
-  new_states["DeviceId2"] = display_device::HdrState::Enabled;
+  new_states["DeviceId1"_id] = display_device::HdrState::Enabled;
+  new_states["DeviceId2"_id] = display_device::HdrState::Enabled;
 
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
   persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -1115,7 +1332,7 @@ TEST_F_S_MOCKED(PrepareHdrStates, HdrStatesSet, PrimaryDeviceSpecified) {
 
 TEST_F_S_MOCKED(PrepareHdrStates, HdrStatesSet, CachedModesReused) {
   auto new_states {DEFAULT_CURRENT_HDR_STATES};
-  new_states["DeviceId1"] = display_device::HdrState::Enabled;
+  new_states["DeviceId1"_id] = display_device::HdrState::Enabled;
 
   auto initial_state {DEFAULT_PERSISTENCE_INPUT_BASE};
   initial_state.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -1136,7 +1353,7 @@ TEST_F_S_MOCKED(PrepareHdrStates, HdrStatesSet, CachedModesReused) {
 
 TEST_F_S_MOCKED(PrepareHdrStates, HdrStatesSet, GuardInvoked) {
   auto new_states {DEFAULT_CURRENT_HDR_STATES};
-  new_states["DeviceId1"] = display_device::HdrState::Enabled;
+  new_states["DeviceId1"_id] = display_device::HdrState::Enabled;
 
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
   persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -1181,7 +1398,7 @@ TEST_F_S_MOCKED(PrepareHdrStates, FailedToRestoreHdrStates) {
   auto initial_state {DEFAULT_PERSISTENCE_INPUT_BASE};
   initial_state.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
   initial_state.m_modified.m_original_hdr_states = DEFAULT_CURRENT_HDR_STATES;
-  initial_state.m_modified.m_original_hdr_states["DeviceId1"] = display_device::HdrState::Enabled;
+  initial_state.m_modified.m_original_hdr_states["DeviceId1"_id] = display_device::HdrState::Enabled;
 
   InSequence sequence;
   expectedDefaultCallsUntilTopologyPrep(sequence, DEFAULT_CURRENT_TOPOLOGY, initial_state);
@@ -1203,7 +1420,7 @@ TEST_F_S_MOCKED(PrepareHdrStates, HdrStatesRestored) {
   auto initial_state {DEFAULT_PERSISTENCE_INPUT_BASE};
   initial_state.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
   initial_state.m_modified.m_original_hdr_states = DEFAULT_CURRENT_HDR_STATES;
-  initial_state.m_modified.m_original_hdr_states["DeviceId1"] = display_device::HdrState::Enabled;
+  initial_state.m_modified.m_original_hdr_states["DeviceId1"_id] = display_device::HdrState::Enabled;
 
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
   persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -1226,7 +1443,7 @@ TEST_F_S_MOCKED(PrepareHdrStates, HdrStatesRestored, PersistenceFailed) {
   auto initial_state {DEFAULT_PERSISTENCE_INPUT_BASE};
   initial_state.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
   initial_state.m_modified.m_original_hdr_states = DEFAULT_CURRENT_HDR_STATES;
-  initial_state.m_modified.m_original_hdr_states["DeviceId1"] = display_device::HdrState::Enabled;
+  initial_state.m_modified.m_original_hdr_states["DeviceId1"_id] = display_device::HdrState::Enabled;
 
   auto persistence_input {DEFAULT_PERSISTENCE_INPUT_BASE};
   persistence_input.m_modified.m_topology = DEFAULT_CURRENT_TOPOLOGY;
@@ -1275,18 +1492,18 @@ TEST_F_S_MOCKED(PrepareHdrStates, HdrStatesRestoreSkipped, PersistenceFailed) {
 TEST_F_S_MOCKED(AudioContextDelayedRelease) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
   auto persistence_input {*ut_consts::SDCS_NO_MODIFICATIONS};
-  persistence_input.m_modified = {{{"DeviceId1"}}};
+  persistence_input.m_modified = {{{"DeviceId1"_id}}};
 
   InSequence sequence;
   expectedDefaultCallsUntilTopologyPrep(sequence, DEFAULT_CURRENT_TOPOLOGY, ut_consts::SDCS_NO_MODIFICATIONS);
   expectedIsCapturedCall(sequence, false);
   expectedDeviceEnumCall(sequence);
-  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"}});
-  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_modified.m_topology, {{"DeviceId1"}});
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"_id}});
+  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_modified.m_topology, {{"DeviceId1"_id}});
 
   expectedIsCapturedCall(sequence, true);
   expectedSetTopologyCall(sequence, persistence_input.m_initial.m_topology);
-  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_initial.m_topology, {{"DeviceId1"}});
+  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_initial.m_topology, {{"DeviceId1"_id}});
   expectedPersistenceCall(sequence, persistence_input);
   expectedReleaseCall(sequence);
   expectedHdrWorkaroundCalls(sequence);
@@ -1314,18 +1531,18 @@ TEST_F_S_MOCKED(FailedToSaveNewState) {
 TEST_F_S_MOCKED(AudioContextDelayedRelease, ViaGuard) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
   auto persistence_input {*ut_consts::SDCS_NO_MODIFICATIONS};
-  persistence_input.m_modified = {{{"DeviceId1"}}};
+  persistence_input.m_modified = {{{"DeviceId1"_id}}};
 
   InSequence sequence;
   expectedDefaultCallsUntilTopologyPrep(sequence, DEFAULT_CURRENT_TOPOLOGY, ut_consts::SDCS_NO_MODIFICATIONS);
   expectedIsCapturedCall(sequence, false);
   expectedDeviceEnumCall(sequence);
-  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"}});
-  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_modified.m_topology, {{"DeviceId1"}});
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"_id}});
+  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_modified.m_topology, {{"DeviceId1"_id}});
 
   expectedIsCapturedCall(sequence, true);
   expectedSetTopologyCall(sequence, persistence_input.m_initial.m_topology);
-  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_initial.m_topology, {{"DeviceId1"}});
+  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_initial.m_topology, {{"DeviceId1"_id}});
 
   expectedPersistenceCall(sequence, persistence_input, false);
 
@@ -1340,18 +1557,18 @@ TEST_F_S_MOCKED(AudioContextDelayedRelease, ViaGuard) {
 TEST_F_S_MOCKED(AudioContextDelayedRelease, SkippedDueToFailure) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
   auto persistence_input {*ut_consts::SDCS_NO_MODIFICATIONS};
-  persistence_input.m_modified = {{{"DeviceId1"}}};
+  persistence_input.m_modified = {{{"DeviceId1"_id}}};
 
   InSequence sequence;
   expectedDefaultCallsUntilTopologyPrep(sequence, DEFAULT_CURRENT_TOPOLOGY, ut_consts::SDCS_NO_MODIFICATIONS);
   expectedIsCapturedCall(sequence, false);
   expectedDeviceEnumCall(sequence);
-  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"}});
-  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_modified.m_topology, {{"DeviceId1"}});
+  expectedIsTopologyTheSameCall(sequence, DEFAULT_CURRENT_TOPOLOGY, {{"DeviceId1"_id}});
+  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_modified.m_topology, {{"DeviceId1"_id}});
 
   expectedIsCapturedCall(sequence, true);
   expectedSetTopologyCall(sequence, persistence_input.m_initial.m_topology);
-  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_initial.m_topology, {{"DeviceId1"}});
+  expectedIsTopologyTheSameCall(sequence, ut_consts::SDCS_FULL->m_initial.m_topology, {{"DeviceId1"_id}});
 
   expectedPersistenceCall(sequence, persistence_input, false);
 
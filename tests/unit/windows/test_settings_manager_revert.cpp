@@ -15,16 +15,17 @@ namespace {
   using ::testing::InSequence;
   using ::testing::Return;
   using ::testing::StrictMock;
+  using namespace display_device::literals;
 
   // Additional convenience global const(s)
-  const display_device::ActiveTopology CURRENT_TOPOLOGY {{"DeviceId4"}};
+  const display_device::ActiveTopology CURRENT_TOPOLOGY {{"DeviceId4"_id}};
   const display_device::HdrStateMap CURRENT_MODIFIED_HDR_STATES {
-    {"DeviceId1", {display_device::HdrState::Enabled}},
-    {"DeviceId3", std::nullopt}
+    {"DeviceId1"_id, {display_device::HdrState::Enabled}},
+    {"DeviceId3"_id, std::nullopt}
   };
   const display_device::DeviceDisplayModeMap CURRENT_MODIFIED_DISPLAY_MODES {
-    {"DeviceId1", {{123, 456}, {120, 1}}},
-    {"DeviceId3", {{456, 123}, {60, 1}}}
+    {"DeviceId1"_id, {{123, 456}, {120, 1}}},
+    {"DeviceId3"_id, {{456, 123}, {60, 1}}}
   };
   const std::string CURRENT_MODIFIED_PRIMARY_DEVICE {"DeviceId3"};
   const display_device::EnumeratedDeviceList CURRENT_DEVICES {
@@ -33,9 +34,9 @@ namespace {
     {.m_device_id = "DeviceId4"}
   };
   const display_device::ActiveTopology FULL_EXTENDED_TOPOLOGY {
-    {"DeviceId1"},
-    {"DeviceId3"},
-    {"DeviceId4"}
+    {"DeviceId1"_id},
+    {"DeviceId3"_id},
+    {"DeviceId4"_id}
   };
 
   // Test fixture(s) for this file
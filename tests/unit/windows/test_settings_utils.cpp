@@ -10,6 +10,7 @@ namespace {
   using ::testing::Return;
   using ::testing::Sequence;
   using ::testing::StrictMock;
+  using namespace display_device::literals;
 
   // Test fixture(s) for this file
   class SettingsUtilsMocked: public BaseTest {
@@ -21,23 +22,23 @@ namespace {
 #define TEST_F_S_MOCKED(...) DD_MAKE_TEST(TEST_F, SettingsUtilsMocked, __VA_ARGS__)
 
   // Additional convenience global const(s)
-  const display_device::ActiveTopology DEFAULT_INITIAL_TOPOLOGY {{"DeviceId1", "DeviceId2"}, {"DeviceId3"}};
+  const display_device::ActiveTopology DEFAULT_INITIAL_TOPOLOGY {{"DeviceId1"_id, "DeviceId2"_id}, {"DeviceId3"_id}};
   const display_device::DeviceDisplayModeMap DEFAULT_CURRENT_MODES {
-    {"DeviceId1", {{1080, 720}, {120, 1}}},
-    {"DeviceId2", {{1920, 1080}, {60, 1}}},
-    {"DeviceId3", {{2560, 1440}, {30, 1}}}
+    {"DeviceId1"_id, {{1080, 720}, {120, 1}}},
+    {"DeviceId2"_id, {{1920, 1080}, {60, 1}}},
+    {"DeviceId3"_id, {{2560, 1440}, {30, 1}}}
   };
   const display_device::HdrStateMap DEFAULT_CURRENT_HDR_STATES {
-    {"DeviceId1", {display_device::HdrState::Disabled}},
-    {"DeviceId2", {display_device::HdrState::Disabled}},
-    {"DeviceId3", std::nullopt}
+    {"DeviceId1"_id, {display_device::HdrState::Disabled}},
+    {"DeviceId2"_id, {display_device::HdrState::Disabled}},
+    {"DeviceId3"_id, std::nullopt}
   };
 }  // namespace
 
 TEST_F_S_MOCKED(FlattenTopology) {
-  EXPECT_EQ(display_device::win_utils::flattenTopology({{"DeviceId1"}, {"DeviceId2", "DeviceId3"}, {}, {"DeviceId2"}}), (std::set<std::string> {"DeviceId1", "DeviceId2", "DeviceId3"}));
-  EXPECT_EQ(display_device::win_utils::flattenTopology({{}, {}, {}}), std::set<std::string> {});
-  EXPECT_EQ(display_device::win_utils::flattenTopology({}), std::set<std::string> {});
+  EXPECT_EQ(display_device::win_utils::flattenTopology({{"DeviceId1"_id}, {"DeviceId2"_id, "DeviceId3"_id}, {}, {"DeviceId2"_id}}), (display_device::DeviceIdSet {"DeviceId1"_id, "DeviceId2"_id, "DeviceId3"_id}));
+  EXPECT_EQ(display_device::win_utils::flattenTopology({{}, {}, {}}), display_device::DeviceIdSet {});
+  EXPECT_EQ(display_device::win_utils::flattenTopology({}), display_device::DeviceIdSet {});
 }
 
 TEST_F_S_MOCKED(CreateFullExtendedTopology, NoDevicesAreAvailable) {
@@ -49,7 +50,7 @@ TEST_F_S_MOCKED(CreateFullExtendedTopology, NoDevicesAreAvailable) {
 }
 
 TEST_F_S_MOCKED(CreateFullExtendedTopology, TopologyCreated) {
-  const display_device::ActiveTopology expected_topology {{"DeviceId1"}, {"DeviceId2"}, {"DeviceId3"}};
+  const display_device::ActiveTopology expected_topology {{"DeviceId1"_id}, {"DeviceId2"_id}, {"DeviceId3"_id}};
   const display_device::EnumeratedDeviceList devices {
     {.m_device_id = "DeviceId1"},
     {.m_device_id = "DeviceId2"},
@@ -78,7 +79,7 @@ TEST_F_S_MOCKED(ComputeInitialState, NewStateIsComputed) {
 }
 
 TEST_F_S_MOCKED(ComputeInitialState, NoPrimaryDevices) {
-  EXPECT_EQ(display_device::win_utils::computeInitialState(std::nullopt, {{"DeviceId1", "DeviceId2"}}, {}), std::nullopt);
+  EXPECT_EQ(display_device::win_utils::computeInitialState(std::nullopt, {{"DeviceId1"_id, "DeviceId2"_id}}, {}), std::nullopt);
 }
 
 TEST_F_S_MOCKED(ComputeNewTopology, VerifyOnly) {
@@ -88,65 +89,121 @@ TEST_F_S_MOCKED(ComputeNewTopology, VerifyOnly) {
 
 TEST_F_S_MOCKED(ComputeNewTopology, EnsureOnlyDisplay) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
-  EXPECT_EQ(display_device::win_utils::computeNewTopology(DevicePrep::EnsureOnlyDisplay, true, "DeviceId4", {"DeviceId5", "DeviceId6"}, DEFAULT_INITIAL_TOPOLOGY), (display_device::ActiveTopology {{"DeviceId4", "DeviceId5", "DeviceId6"}}));
-  EXPECT_EQ(display_device::win_utils::computeNewTopology(DevicePrep::EnsureOnlyDisplay, false, "DeviceId4", {"DeviceId5", "DeviceId6"}, DEFAULT_INITIAL_TOPOLOGY), display_device::ActiveTopology {{"DeviceId4"}});
+  EXPECT_EQ(display_device::win_utils::computeNewTopology(DevicePrep::EnsureOnlyDisplay, true, "DeviceId4", {"DeviceId5", "DeviceId6"}, DEFAULT_INITIAL_TOPOLOGY), (display_device::ActiveTopology {{"DeviceId4"_id, "DeviceId5"_id, "DeviceId6"_id}}));
+  EXPECT_EQ(display_device::win_utils::computeNewTopology(DevicePrep::EnsureOnlyDisplay, false, "DeviceId4", {"DeviceId5", "DeviceId6"}, DEFAULT_INITIAL_TOPOLOGY), display_device::ActiveTopology {{"DeviceId4"_id}});
 }
 
 TEST_F_S_MOCKED(ComputeNewTopology, EnsureActive) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
-  EXPECT_EQ(display_device::win_utils::computeNewTopology(DevicePrep::EnsureActive, true, "DeviceId4", {"DeviceId5", "DeviceId6"}, {{"DeviceId4"}}), display_device::ActiveTopology {{"DeviceId4"}});
-  EXPECT_EQ(display_device::win_utils::computeNewTopology(DevicePrep::EnsureActive, true, "DeviceId4", {"DeviceId5", "DeviceId6"}, {{"DeviceId3"}}), (display_device::ActiveTopology {{"DeviceId3"}, {"DeviceId4"}}));
+  EXPECT_EQ(display_device::win_utils::computeNewTopology(DevicePrep::EnsureActive, true, "DeviceId4", {"DeviceId5", "DeviceId6"}, {{"DeviceId4"_id}}), display_device::ActiveTopology {{"DeviceId4"_id}});
+  EXPECT_EQ(display_device::win_utils::computeNewTopology(DevicePrep::EnsureActive, true, "DeviceId4", {"DeviceId5", "DeviceId6"}, {{"DeviceId3"_id}}), (display_device::ActiveTopology {{"DeviceId3"_id}, {"DeviceId4"_id}}));
 }
 
 TEST_F_S_MOCKED(ComputeNewTopology, EnsurePrimary) {
   using DevicePrep = display_device::SingleDisplayConfiguration::DevicePreparation;
-  EXPECT_EQ(display_device::win_utils::computeNewTopology(DevicePrep::EnsurePrimary, true, "DeviceId4", {"DeviceId5", "DeviceId6"}, {{"DeviceId4"}}), display_device::ActiveTopology {{"DeviceId4"}});
-  EXPECT_EQ(display_device::win_utils::computeNewTopology(DevicePrep::EnsurePrimary, true, "DeviceId4", {"DeviceId5", "DeviceId6"}, {{"DeviceId3"}}), (display_device::ActiveTopology {{"DeviceId3"}, {"DeviceId4"}}));
+  EXPECT_EQ(display_device::win_utils::computeNewTopology(DevicePrep::EnsurePrimary, true, "DeviceId4", {"DeviceId5", "DeviceId6"}, {{"DeviceId4"_id}}), display_device::ActiveTopology {{"DeviceId4"_id}});
+  EXPECT_EQ(display_device::win_utils::computeNewTopology(DevicePrep::EnsurePrimary, true, "DeviceId4", {"DeviceId5", "DeviceId6"}, {{"DeviceId3"_id}}), (display_device::ActiveTopology {{"DeviceId3"_id}, {"DeviceId4"_id}}));
 }
 
 TEST_F_S_MOCKED(ComputeNewDisplayModes, PrimaryDevices, DoubleFloatType) {
   auto expected_modes {DEFAULT_CURRENT_MODES};
-  expected_modes["DeviceId1"] = {{1920, 1080}, {1200000, 10000}};
-  expected_modes["DeviceId2"] = {{1920, 1080}, {1200000, 10000}};
+  expected_modes["DeviceId1"_id] = {{1920, 1080}, {1200000, 10000}};
+  expected_modes["DeviceId2"_id] = {{1920, 1080}, {1200000, 10000}};
 
   EXPECT_EQ(display_device::win_utils::computeNewDisplayModes({{1920, 1080}}, {120.}, true, "DeviceId1", {"DeviceId2"}, DEFAULT_CURRENT_MODES), expected_modes);
 }
 
 TEST_F_S_MOCKED(ComputeNewDisplayModes, NonPrimaryDevices, DoubleFloatType) {
   auto expected_modes {DEFAULT_CURRENT_MODES};
-  expected_modes["DeviceId1"] = {{1920, 1080}, {1200000, 10000}};
-  expected_modes["DeviceId2"] = {{1920, 1080}, expected_modes["DeviceId2"].m_refresh_rate};
+  expected_modes["DeviceId1"_id] = {{1920, 1080}, {1200000, 10000}};
+  expected_modes["DeviceId2"_id] = {{1920, 1080}, expected_modes["DeviceId2"_id].m_refresh_rate};
 
   EXPECT_EQ(display_device::win_utils::computeNewDisplayModes({{1920, 1080}}, {120.}, false, "DeviceId1", {"DeviceId2"}, DEFAULT_CURRENT_MODES), expected_modes);
 }
 
 TEST_F_S_MOCKED(ComputeNewDisplayModes, PrimaryDevices, RationalFloatType) {
   auto expected_modes {DEFAULT_CURRENT_MODES};
-  expected_modes["DeviceId1"] = {{1920, 1080}, {120, 1}};
-  expected_modes["DeviceId2"] = {{1920, 1080}, {120, 1}};
+  expected_modes["DeviceId1"_id] = {{1920, 1080}, {120, 1}};
+  expected_modes["DeviceId2"_id] = {{1920, 1080}, {120, 1}};
 
   EXPECT_EQ(display_device::win_utils::computeNewDisplayModes({{1920, 1080}}, {display_device::Rational {120, 1}}, true, "DeviceId1", {"DeviceId2"}, DEFAULT_CURRENT_MODES), expected_modes);
 }
 
 TEST_F_S_MOCKED(ComputeNewDisplayModes, NonPrimaryDevices, RationalFloatType) {
   auto expected_modes {DEFAULT_CURRENT_MODES};
-  expected_modes["DeviceId1"] = {{1920, 1080}, {120, 1}};
-  expected_modes["DeviceId2"] = {{1920, 1080}, expected_modes["DeviceId2"].m_refresh_rate};
+  expected_modes["DeviceId1"_id] = {{1920, 1080}, {120, 1}};
+  expected_modes["DeviceId2"_id] = {{1920, 1080}, expected_modes["DeviceId2"_id].m_refresh_rate};
 
   EXPECT_EQ(display_device::win_utils::computeNewDisplayModes({{1920, 1080}}, {display_device::Rational {120, 1}}, false, "DeviceId1", {"DeviceId2"}, DEFAULT_CURRENT_MODES), expected_modes);
 }
 
+TEST_F_S_MOCKED(SnapDisplayModes) {
+  const display_device::DeviceModeCatalogMap catalogs {
+    {"DeviceId1"_id, display_device::ModeCatalog {{{{1920, 1080}, {119982, 1000}}, {{1920, 1080}, {59940, 1000}}}, true}},
+    {"DeviceId2"_id, display_device::ModeCatalog {{{{1920, 1080}, {100, 1}}}, true}},
+    {"DeviceId3"_id, display_device::ModeCatalog {{{{2560, 1440}, {29970, 1000}}}, true}}
+  };
+  const auto new_modes {display_device::win_utils::computeNewDisplayModes({{1920, 1080}}, {display_device::Rational {120, 1}}, true, "DeviceId1", {"DeviceId2"}, DEFAULT_CURRENT_MODES)};
+
+  auto expected_modes {new_modes};
+  expected_modes["DeviceId1"_id] = {{1920, 1080}, {119982, 1000}};
+
+  // Unchanged modes are not snapped, neither are the modes outside of the tolerance
+  EXPECT_EQ(display_device::win_utils::snapDisplayModes(new_modes, DEFAULT_CURRENT_MODES, catalogs), expected_modes);
+}
+
+TEST_F_S_MOCKED(SnapDisplayModes, ExactRateKept) {
+  const display_device::DeviceModeCatalogMap catalogs {
+    {"DeviceId1"_id, display_device::ModeCatalog {{{{1920, 1080}, {119982, 1000}}, {{1920, 1080}, {120, 1}}}, true}}
+  };
+  const auto new_modes {display_device::win_utils::computeNewDisplayModes({{1920, 1080}}, {display_device::Rational {120, 1}}, false, "DeviceId1", {}, DEFAULT_CURRENT_MODES)};
+  EXPECT_EQ(display_device::win_utils::snapDisplayModes(new_modes, DEFAULT_CURRENT_MODES, catalogs), new_modes);
+}
+
+TEST_F_S_MOCKED(SnapDisplayModes, IncompleteCatalog) {
+  const display_device::DeviceModeCatalogMap catalogs {
+    {"DeviceId1"_id, display_device::ModeCatalog {{{{1920, 1080}, {119982, 1000}}}}}
+  };
+  const auto new_modes {display_device::win_utils::computeNewDisplayModes({{2560, 1440}}, {display_device::Rational {120, 1}}, false, "DeviceId1", {}, DEFAULT_CURRENT_MODES)};
+  EXPECT_EQ(display_device::win_utils::snapDisplayModes(new_modes, DEFAULT_CURRENT_MODES, catalogs), new_modes);
+}
+
+TEST_F_S_MOCKED(SnapDisplayModes, UnlistedResolution) {
+  const display_device::DeviceModeCatalogMap catalogs {
+    {"DeviceId1"_id, display_device::ModeCatalog {{{{1920, 1080}, {119982, 1000}}}, true}}
+  };
+  const auto new_modes {display_device::win_utils::computeNewDisplayModes({{2560, 1440}}, {display_device::Rational {120, 1}}, false, "DeviceId1", {}, DEFAULT_CURRENT_MODES)};
+  EXPECT_EQ(display_device::win_utils::snapDisplayModes(new_modes, DEFAULT_CURRENT_MODES, catalogs), new_modes);
+}
+
+TEST_F_S_MOCKED(SnapDisplayModes, NoCatalogs) {
+  const auto new_modes {display_device::win_utils::computeNewDisplayModes({{1920, 1080}}, {display_device::Rational {120, 1}}, true, "DeviceId1", {"DeviceId2"}, DEFAULT_CURRENT_MODES)};
+  EXPECT_EQ(display_device::win_utils::snapDisplayModes(new_modes, DEFAULT_CURRENT_MODES, {}), new_modes);
+}
+
+TEST_F_S_MOCKED(ComputeModeCatalogs) {
+  const display_device::EnumeratedDeviceList devices {
+    {.m_device_id = "DeviceId1", .m_edid = ut_consts::DEFAULT_EDID_DATA},
+    {.m_device_id = "DeviceId2"},
+    {.m_device_id = "DeviceId3", .m_edid = display_device::EdidData {}}
+  };
+
+  const auto catalogs {display_device::win_utils::computeModeCatalogs(devices)};
+  ASSERT_EQ(catalogs.size(), 1);
+  EXPECT_EQ(catalogs.at("DeviceId1"_id).findNearest({2560, 1440}, {60, 1}), (display_device::ModeCatalog::Mode {{2560, 1440}, {59951, 1000}}));
+}
+
 TEST_F_S_MOCKED(ComputeNewHdrStates, PrimaryDevices) {
   auto expected_states {DEFAULT_CURRENT_HDR_STATES};
-  expected_states["DeviceId1"] = display_device::HdrState::Enabled;
-  expected_states["DeviceId2"] = display_device::HdrState::Enabled;
+  expected_states["DeviceId1"_id] = display_device::HdrState::Enabled;
+  expected_states["DeviceId2"_id] = display_device::HdrState::Enabled;
 
   EXPECT_EQ(display_device::win_utils::computeNewHdrStates(display_device::HdrState::Enabled, true, "DeviceId1", {"DeviceId2", "DeviceId3"}, DEFAULT_CURRENT_HDR_STATES), expected_states);
 }
 
 TEST_F_S_MOCKED(ComputeNewHdrStates, NonPrimaryDevices) {
   auto expected_states {DEFAULT_CURRENT_HDR_STATES};
-  expected_states["DeviceId1"] = display_device::HdrState::Enabled;
+  expected_states["DeviceId1"_id] = display_device::HdrState::Enabled;
 
   EXPECT_EQ(display_device::win_utils::computeNewHdrStates(display_device::HdrState::Enabled, false, "DeviceId1", {"DeviceId2", "DeviceId3"}, DEFAULT_CURRENT_HDR_STATES), expected_states);
   EXPECT_EQ(display_device::win_utils::computeNewHdrStates(std::nullopt, false, "DeviceId1", {"DeviceId2", "DeviceId3"}, DEFAULT_CURRENT_HDR_STATES), DEFAULT_CURRENT_HDR_STATES);
@@ -157,6 +214,41 @@ TEST_F_S_MOCKED(ComputeNewHdrStates, NoStateProvided) {
   EXPECT_EQ(display_device::win_utils::computeNewHdrStates(std::nullopt, false, "DeviceId1", {"DeviceId2", "DeviceId3"}, DEFAULT_CURRENT_HDR_STATES), DEFAULT_CURRENT_HDR_STATES);
 }
 
+TEST_F_S_MOCKED(ComputeSnapshotDiff, NoChanges) {
+  const display_device::DisplaySettingsSnapshot snapshot {DEFAULT_INITIAL_TOPOLOGY, DEFAULT_CURRENT_MODES, DEFAULT_CURRENT_HDR_STATES, "DeviceId1"};
+  EXPECT_TRUE(display_device::win_utils::computeSnapshotDiff(snapshot, snapshot).empty());
+}
+
+TEST_F_S_MOCKED(ComputeSnapshotDiff, AllChanged) {
+  const display_device::DisplaySettingsSnapshot from {DEFAULT_INITIAL_TOPOLOGY, DEFAULT_CURRENT_MODES, DEFAULT_CURRENT_HDR_STATES, "DeviceId1"};
+  const display_device::DisplaySettingsSnapshot to {
+    {{"DeviceId1"_id}, {"DeviceId4"_id}},
+    {{"DeviceId1"_id, {{1080, 720}, {120, 1}}},
+     {"DeviceId2"_id, {{1920, 1080}, {120, 1}}},
+     {"DeviceId4"_id, {{1920, 1080}, {60, 1}}}},
+    {{"DeviceId1"_id, {display_device::HdrState::Enabled}},
+     {"DeviceId2"_id, {display_device::HdrState::Disabled}}},
+    "DeviceId4"
+  };
+  const display_device::DisplaySettingsSnapshotDiff expected_diff {
+    .m_topology = display_device::ActiveTopology {{"DeviceId1"_id}, {"DeviceId4"_id}},
+    .m_modes = {{"DeviceId2"_id, {{1920, 1080}, {120, 1}}}, {"DeviceId4"_id, {{1920, 1080}, {60, 1}}}},
+    .m_removed_modes = {"DeviceId3"},
+    .m_hdr_states = {{"DeviceId1"_id, {display_device::HdrState::Enabled}}},
+    .m_removed_hdr_states = {"DeviceId3"},
+    .m_primary_device = "DeviceId4"
+  };
+
+  const auto diff {display_device::win_utils::computeSnapshotDiff(from, to)};
+  EXPECT_EQ(diff, expected_diff);
+  EXPECT_EQ(display_device::win_utils::applySnapshotDiff(from, diff), to);
+}
+
+TEST_F_S_MOCKED(ApplySnapshotDiff, EmptyDiff) {
+  const display_device::DisplaySettingsSnapshot snapshot {DEFAULT_INITIAL_TOPOLOGY, DEFAULT_CURRENT_MODES, DEFAULT_CURRENT_HDR_STATES, "DeviceId1"};
+  EXPECT_EQ(display_device::win_utils::applySnapshotDiff(snapshot, {}), snapshot);
+}
+
 TEST_F_S_MOCKED(StripInitialState, NoStripIsPerformed) {
   const display_device::SingleDisplayConfigState::Initial initial_state {DEFAULT_INITIAL_TOPOLOGY, {"DeviceId1", "DeviceId2"}};
   const display_device::EnumeratedDeviceList devices {
@@ -185,7 +277,7 @@ TEST_F_S_MOCKED(StripInitialState, OneNonPrimaryDeviceStripped) {
     {.m_device_id = "DeviceId2", .m_info = display_device::EnumeratedDevice::Info {.m_primary = true}}
   };
 
-  EXPECT_EQ(display_device::win_utils::stripInitialState(initial_state, devices), (display_device::SingleDisplayConfigState::Initial {{{"DeviceId1", "DeviceId2"}}, {"DeviceId1", "DeviceId2"}}));
+  EXPECT_EQ(display_device::win_utils::stripInitialState(initial_state, devices), (display_device::SingleDisplayConfigState::Initial {{{"DeviceId1"_id, "DeviceId2"_id}}, {"DeviceId1", "DeviceId2"}}));
 }
 
 TEST_F_S_MOCKED(StripInitialState, OnePrimaryDeviceStripped) {
@@ -195,7 +287,7 @@ TEST_F_S_MOCKED(StripInitialState, OnePrimaryDeviceStripped) {
     {.m_device_id = "DeviceId3", .m_info = display_device::EnumeratedDevice::Info {.m_primary = true}},
   };
 
-  EXPECT_EQ(display_device::win_utils::stripInitialState(initial_state, devices), (display_device::SingleDisplayConfigState::Initial {{{"DeviceId1"}, {"DeviceId3"}}, {"DeviceId1"}}));
+  EXPECT_EQ(display_device::win_utils::stripInitialState(initial_state, devices), (display_device::SingleDisplayConfigState::Initial {{{"DeviceId1"_id}, {"DeviceId3"_id}}, {"DeviceId1"}}));
 }
 
 TEST_F_S_MOCKED(StripInitialState, PrimaryDevicesCompletelyStripped) {
@@ -213,7 +305,7 @@ TEST_F_S_MOCKED(StripInitialState, PrimaryDevicesCompletelyReplaced) {
     {.m_device_id = "DeviceId3", .m_info = display_device::EnumeratedDevice::Info {.m_primary = true}}
   };
 
-  EXPECT_EQ(display_device::win_utils::stripInitialState(initial_state, devices), (display_device::SingleDisplayConfigState::Initial {{{"DeviceId3"}}, {"DeviceId3"}}));
+  EXPECT_EQ(display_device::win_utils::stripInitialState(initial_state, devices), (display_device::SingleDisplayConfigState::Initial {{{"DeviceId3"_id}}, {"DeviceId3"}}));
 }
 
 TEST_F_S_MOCKED(ComputeNewTopologyAndMetadata, EmptyDeviceId, AdditionalDevicesNotStripped) {
@@ -259,18 +351,18 @@ TEST_F_S_MOCKED(ComputeNewTopologyAndMetadata, ValidDeviceId, NoAdditionalDevice
 
   const auto &[new_topology, device_to_configure, additional_devices_to_configure] =
     display_device::win_utils::computeNewTopologyAndMetadata(DevicePrep::EnsureOnlyDisplay, device_id, initial_state);
-  EXPECT_EQ(new_topology, display_device::ActiveTopology {{"DeviceId1"}});
+  EXPECT_EQ(new_topology, display_device::ActiveTopology {{"DeviceId1"_id}});
   EXPECT_EQ(device_to_configure, device_id);
   EXPECT_EQ(additional_devices_to_configure, std::set<std::string> {});
 }
 
 TEST_F_S_MOCKED(TopologyGuardFn, Success) {
-  EXPECT_CALL(m_dd_api, setTopology(display_device::ActiveTopology {{"DeviceId1"}}))
+  EXPECT_CALL(m_dd_api, setTopology(display_device::ActiveTopology {{"DeviceId1"_id}}))
     .Times(1)
     .WillOnce(Return(true))
     .RetiresOnSaturation();
 
-  const auto guard_fn {display_device::win_utils::topologyGuardFn(m_dd_api, {{"DeviceId1"}})};
+  const auto guard_fn {display_device::win_utils::topologyGuardFn(m_dd_api, {{"DeviceId1"_id}})};
   EXPECT_NO_THROW(guard_fn());
 }
 
@@ -302,12 +394,12 @@ TEST_F_S_MOCKED(BlankHdrStates, NothingToApply) {
 
 TEST_F_S_MOCKED(BlankHdrStates, FailedToApplyInverseStates) {
   const display_device::HdrStateMap initial_states {
-    {"DeviceId1", {display_device::HdrState::Enabled}},
-    {"DeviceId2", {display_device::HdrState::Disabled}},
-    {"DeviceId3", std::nullopt}
+    {"DeviceId1"_id, {display_device::HdrState::Enabled}},
+    {"DeviceId2"_id, {display_device::HdrState::Disabled}},
+    {"DeviceId3"_id, std::nullopt}
   };
   const display_device::HdrStateMap inverse_states {
-    {"DeviceId1", {display_device::HdrState::Disabled}}
+    {"DeviceId1"_id, {display_device::HdrState::Disabled}}
   };
 
   Sequence sequence;
@@ -321,15 +413,15 @@ TEST_F_S_MOCKED(BlankHdrStates, FailedToApplyInverseStates) {
 
 TEST_F_S_MOCKED(BlankHdrStates, FailedToApplyOriginalStates) {
   const display_device::HdrStateMap initial_states {
-    {"DeviceId1", {display_device::HdrState::Enabled}},
-    {"DeviceId2", {display_device::HdrState::Disabled}},
-    {"DeviceId3", std::nullopt}
+    {"DeviceId1"_id, {display_device::HdrState::Enabled}},
+    {"DeviceId2"_id, {display_device::HdrState::Disabled}},
+    {"DeviceId3"_id, std::nullopt}
   };
   const display_device::HdrStateMap inverse_states {
-    {"DeviceId1", {display_device::HdrState::Disabled}}
+    {"DeviceId1"_id, {display_device::HdrState::Disabled}}
   };
   const display_device::HdrStateMap original_states {
-    {"DeviceId1", {display_device::HdrState::Enabled}}
+    {"DeviceId1"_id, {display_device::HdrState::Enabled}}
   };
 
   Sequence sequence;
@@ -348,15 +440,15 @@ TEST_F_S_MOCKED(BlankHdrStates, NullDelay) {
 
 TEST_F_S_MOCKED(BlankHdrStates, Success) {
   const display_device::HdrStateMap initial_states {
-    {"DeviceId1", {display_device::HdrState::Enabled}},
-    {"DeviceId2", {display_device::HdrState::Disabled}},
-    {"DeviceId3", std::nullopt}
+    {"DeviceId1"_id, {display_device::HdrState::Enabled}},
+    {"DeviceId2"_id, {display_device::HdrState::Disabled}},
+    {"DeviceId3"_id, std::nullopt}
   };
   const display_device::HdrStateMap inverse_states {
-    {"DeviceId1", {display_device::HdrState::Disabled}}
+    {"DeviceId1"_id, {display_device::HdrState::Disabled}}
   };
   const display_device::HdrStateMap original_states {
-    {"DeviceId1", {display_device::HdrState::Enabled}}
+    {"DeviceId1"_id, {display_device::HdrState::Enabled}}
   };
 
   Sequence sequence;
@@ -370,40 +462,40 @@ TEST_F_S_MOCKED(BlankHdrStates, Success) {
 }
 
 TEST_F_S_MOCKED(TopologyGuardFn, Failure) {
-  EXPECT_CALL(m_dd_api, setTopology(display_device::ActiveTopology {{"DeviceId1"}}))
+  EXPECT_CALL(m_dd_api, setTopology(display_device::ActiveTopology {{"DeviceId1"_id}}))
     .Times(1)
     .WillOnce(Return(false))
     .RetiresOnSaturation();
 
-  const auto guard_fn {display_device::win_utils::topologyGuardFn(m_dd_api, {{"DeviceId1"}})};
+  const auto guard_fn {display_device::win_utils::topologyGuardFn(m_dd_api, {{"DeviceId1"_id}})};
   EXPECT_NO_THROW(guard_fn());
 }
 
 TEST_F_S_MOCKED(ModeGuardFn, Success) {
-  EXPECT_CALL(m_dd_api, getCurrentDisplayModes(std::set<std::string> {"DeviceId1"}))
+  EXPECT_CALL(m_dd_api, getCurrentDisplayModes(display_device::DeviceIdSet {"DeviceId1"_id}))
     .Times(1)
-    .WillOnce(Return(display_device::DeviceDisplayModeMap {{"DeviceId1", {}}}))
+    .WillOnce(Return(display_device::DeviceDisplayModeMap {{"DeviceId1"_id, {}}}))
     .RetiresOnSaturation();
-  EXPECT_CALL(m_dd_api, setDisplayModes(display_device::DeviceDisplayModeMap {{"DeviceId1", {}}}))
+  EXPECT_CALL(m_dd_api, setDisplayModes(display_device::DeviceDisplayModeMap {{"DeviceId1"_id, {}}}))
     .Times(1)
     .WillOnce(Return(true))
     .RetiresOnSaturation();
 
-  const auto guard_fn {display_device::win_utils::modeGuardFn(m_dd_api, {{"DeviceId1"}})};
+  const auto guard_fn {display_device::win_utils::modeGuardFn(m_dd_api, {{"DeviceId1"_id}})};
   EXPECT_NO_THROW(guard_fn());
 }
 
 TEST_F_S_MOCKED(ModeGuardFn, Failure) {
-  EXPECT_CALL(m_dd_api, getCurrentDisplayModes(std::set<std::string> {"DeviceId1"}))
+  EXPECT_CALL(m_dd_api, getCurrentDisplayModes(display_device::DeviceIdSet {"DeviceId1"_id}))
     .Times(1)
-    .WillOnce(Return(display_device::DeviceDisplayModeMap {{"DeviceId1", {}}}))
+    .WillOnce(Return(display_device::DeviceDisplayModeMap {{"DeviceId1"_id, {}}}))
     .RetiresOnSaturation();
-  EXPECT_CALL(m_dd_api, setDisplayModes(display_device::DeviceDisplayModeMap {{"DeviceId1", {}}}))
+  EXPECT_CALL(m_dd_api, setDisplayModes(display_device::DeviceDisplayModeMap {{"DeviceId1"_id, {}}}))
     .Times(1)
     .WillOnce(Return(false))
     .RetiresOnSaturation();
 
-  const auto guard_fn {display_device::win_utils::modeGuardFn(m_dd_api, {{"DeviceId1"}})};
+  const auto guard_fn {display_device::win_utils::modeGuardFn(m_dd_api, {{"DeviceId1"_id}})};
   EXPECT_NO_THROW(guard_fn());
 }
 
@@ -417,7 +509,7 @@ TEST_F_S_MOCKED(PrimaryGuardFn, Success) {
     .WillOnce(Return(true))
     .RetiresOnSaturation();
 
-  const auto guard_fn {display_device::win_utils::primaryGuardFn(m_dd_api, display_device::ActiveTopology {{"DeviceId1"}})};
+  const auto guard_fn {display_device::win_utils::primaryGuardFn(m_dd_api, display_device::ActiveTopology {{"DeviceId1"_id}})};
   EXPECT_NO_THROW(guard_fn());
 }
 
@@ -431,34 +523,34 @@ TEST_F_S_MOCKED(PrimaryGuardFn, Failure) {
     .WillOnce(Return(false))
     .RetiresOnSaturation();
 
-  const auto guard_fn {display_device::win_utils::primaryGuardFn(m_dd_api, display_device::ActiveTopology {{"DeviceId1"}})};
+  const auto guard_fn {display_device::win_utils::primaryGuardFn(m_dd_api, display_device::ActiveTopology {{"DeviceId1"_id}})};
   EXPECT_NO_THROW(guard_fn());
 }
 
 TEST_F_S_MOCKED(HdrStateGuardFn, Success) {
-  EXPECT_CALL(m_dd_api, getCurrentHdrStates(std::set<std::string> {"DeviceId1"}))
+  EXPECT_CALL(m_dd_api, getCurrentHdrStates(display_device::DeviceIdSet {"DeviceId1"_id}))
     .Times(1)
-    .WillOnce(Return(display_device::HdrStateMap {{"DeviceId1", {}}}))
+    .WillOnce(Return(display_device::HdrStateMap {{"DeviceId1"_id, {}}}))
     .RetiresOnSaturation();
-  EXPECT_CALL(m_dd_api, setHdrStates(display_device::HdrStateMap {{"DeviceId1", {}}}))
+  EXPECT_CALL(m_dd_api, setHdrStates(display_device::HdrStateMap {{"DeviceId1"_id, {}}}))
     .Times(1)
     .WillOnce(Return(true))
     .RetiresOnSaturation();
 
-  const auto guard_fn {display_device::win_utils::hdrStateGuardFn(m_dd_api, {{"DeviceId1"}})};
+  const auto guard_fn {display_device::win_utils::hdrStateGuardFn(m_dd_api, {{"DeviceId1"_id}})};
   EXPECT_NO_THROW(guard_fn());
 }
 
 TEST_F_S_MOCKED(HdrStateGuardFn, Failure) {
-  EXPECT_CALL(m_dd_api, getCurrentHdrStates(std::set<std::string> {"DeviceId1"}))
+  EXPECT_CALL(m_dd_api, getCurrentHdrStates(display_device::DeviceIdSet {"DeviceId1"_id}))
     .Times(1)
-    .WillOnce(Return(display_device::HdrStateMap {{"DeviceId1", {}}}))
+    .WillOnce(Return(display_device::HdrStateMap {{"DeviceId1"_id, {}}}))
     .RetiresOnSaturation();
-  EXPECT_CALL(m_dd_api, setHdrStates(display_device::HdrStateMap {{"DeviceId1", {}}}))
+  EXPECT_CALL(m_dd_api, setHdrStates(display_device::HdrStateMap {{"DeviceId1"_id, {}}}))
     .Times(1)
     .WillOnce(Return(false))
     .RetiresOnSaturation();
 
-  const auto guard_fn {display_device::win_utils::hdrStateGuardFn(m_dd_api, {{"DeviceId1"}})};
+  const auto guard_fn {display_device::win_utils::hdrStateGuardFn(m_dd_api, {{"DeviceId1"_id}})};
   EXPECT_NO_THROW(guard_fn());
 }
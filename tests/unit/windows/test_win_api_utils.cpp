@@ -10,6 +10,7 @@ namespace {
   using ::testing::InSequence;
   using ::testing::Return;
   using ::testing::StrictMock;
+  using namespace display_device::literals;
 
   // Test fixture(s) for this file
   class WinApiUtilsMocked: public BaseTest {
@@ -128,10 +129,10 @@ namespace {
   const display_device::PathSourceIndexDataMap EXPECTED_SOURCE_INDEX_DATA {
     // Contains the expected data if generated from PATHS_WITH_SOURCE_IDS and some
     // sensibly chosen device paths and device ids.
-    {"DeviceId1", {{{0, 2}, {1, 0}}, {1, 1}, {1}}},
-    {"DeviceId2", {{{0, 1}, {1, 4}}, {2, 2}, {0}}},
-    {"DeviceId3", {{{4, 3}}, {3, 3}, std::nullopt}},
-    {"DeviceId4", {{{0, 5}, {1, 6}}, {1, 1}, std::nullopt}}
+    {"DeviceId1"_id, {{{0, 2}, {1, 0}}, {1, 1}, {1}}},
+    {"DeviceId2"_id, {{{0, 1}, {1, 4}}, {2, 2}, {0}}},
+    {"DeviceId3"_id, {{{4, 3}}, {3, 3}, std::nullopt}},
+    {"DeviceId4"_id, {{{0, 5}, {1, 6}}, {1, 1}, std::nullopt}}
   };
 
   // Helper functions
@@ -522,7 +523,7 @@ TEST_F_S_MOCKED(CollectSourceDataForMatchingPaths, TransientPathIssues) {
     .WillOnce(Return("DeviceId4"));
 
   display_device::PathSourceIndexDataMap expected_data {EXPECTED_SOURCE_INDEX_DATA};
-  expected_data.erase(expected_data.find("DeviceId3"));
+  expected_data.erase(expected_data.find("DeviceId3"_id));
 
   EXPECT_EQ(display_device::win_utils::collectSourceDataForMatchingPaths(m_layer, PATHS_WITH_SOURCE_IDS), expected_data);
 }
@@ -666,7 +667,7 @@ TEST_F_S_MOCKED(CollectSourceDataForMatchingPaths, EmptyList) {
 }
 
 TEST_F_S_MOCKED(MakePathsForNewTopology) {
-  const display_device::ActiveTopology new_topology {{"DeviceId1"}, {"DeviceId2"}, {"DeviceId3", "DeviceId4"}};
+  const display_device::ActiveTopology new_topology {{"DeviceId1"_id}, {"DeviceId2"_id}, {"DeviceId3"_id, "DeviceId4"_id}};
   const std::vector<DISPLAYCONFIG_PATH_INFO> paths {PATHS_WITH_SOURCE_IDS};
 
   std::vector<DISPLAYCONFIG_PATH_INFO> expected_paths {{paths.at(0), paths.at(1), paths.at(3), paths.at(5)}};
@@ -681,7 +682,7 @@ TEST_F_S_MOCKED(MakePathsForNewTopology) {
 }
 
 TEST_F_S_MOCKED(MakePathsForNewTopology, DevicesFromSameAdapterInAGroup) {
-  const display_device::ActiveTopology new_topology {{"DeviceId1", "DeviceId4"}};
+  const display_device::ActiveTopology new_topology {{"DeviceId1"_id, "DeviceId4"_id}};
   const std::vector<DISPLAYCONFIG_PATH_INFO> paths {PATHS_WITH_SOURCE_IDS};
 
   std::vector<DISPLAYCONFIG_PATH_INFO> expected_paths {paths.at(0), paths.at(6)};
@@ -694,7 +695,7 @@ TEST_F_S_MOCKED(MakePathsForNewTopology, DevicesFromSameAdapterInAGroup) {
 }
 
 TEST_F_S_MOCKED(MakePathsForNewTopology, UnknownDeviceInNewTopology) {
-  const display_device::ActiveTopology new_topology {{"DeviceIdX", "DeviceId4"}};
+  const display_device::ActiveTopology new_topology {{"DeviceIdX"_id, "DeviceId4"_id}};
 
   const std::vector<DISPLAYCONFIG_PATH_INFO> expected_paths {};
   EXPECT_EQ(display_device::win_utils::makePathsForNewTopology(new_topology, EXPECTED_SOURCE_INDEX_DATA, PATHS_WITH_SOURCE_IDS), expected_paths);
@@ -704,7 +705,7 @@ TEST_F_S_MOCKED(MakePathsForNewTopology, MissingPathsForDuplicatedDisplays) {
   // There must be N-1 (up to a GPU limit) amount of source ids (for each path/deviceId combination) available.
   // For the same adapter, only devices with matching ids can be grouped (duplicated).
   // In this case, have only 0 and 1 ids. You may also notice that 0 != 1, and thus we cannot group them.
-  const display_device::ActiveTopology new_topology {{"DeviceId1", "DeviceId2"}};
+  const display_device::ActiveTopology new_topology {{"DeviceId1"_id, "DeviceId2"_id}};
   std::vector<DISPLAYCONFIG_PATH_INFO> paths {};
 
   paths.push_back(AVAILABLE_AND_ACTIVE_PATH);
@@ -716,8 +717,8 @@ TEST_F_S_MOCKED(MakePathsForNewTopology, MissingPathsForDuplicatedDisplays) {
   paths.back().sourceInfo.id = 1;
 
   const display_device::PathSourceIndexDataMap path_source_data {
-    {"DeviceId1", {{{0, 0}}, {1, 1}, {0}}},
-    {"DeviceId2", {{{1, 1}}, {1, 1}, std::nullopt}}
+    {"DeviceId1"_id, {{{0, 0}}, {1, 1}, {0}}},
+    {"DeviceId2"_id, {{{1, 1}}, {1, 1}, std::nullopt}}
   };
 
   const std::vector<DISPLAYCONFIG_PATH_INFO> expected_paths {};
@@ -727,7 +728,7 @@ TEST_F_S_MOCKED(MakePathsForNewTopology, MissingPathsForDuplicatedDisplays) {
 TEST_F_S_MOCKED(MakePathsForNewTopology, GpuLimit, DuplicatedDisplays) {
   // We can only render 1 source, however since they are duplicated, source is reused
   // and can be rendered to different devices.
-  const display_device::ActiveTopology new_topology {{"DeviceId1", "DeviceId2"}};
+  const display_device::ActiveTopology new_topology {{"DeviceId1"_id, "DeviceId2"_id}};
   std::vector<DISPLAYCONFIG_PATH_INFO> paths {};
 
   paths.push_back(AVAILABLE_AND_ACTIVE_PATH);
@@ -739,8 +740,8 @@ TEST_F_S_MOCKED(MakePathsForNewTopology, GpuLimit, DuplicatedDisplays) {
   paths.back().sourceInfo.id = 0;
 
   const display_device::PathSourceIndexDataMap path_source_data {
-    {"DeviceId1", {{{0, 0}}, {1, 1}, {0}}},
-    {"DeviceId2", {{{0, 1}}, {1, 1}, std::nullopt}}
+    {"DeviceId1"_id, {{{0, 0}}, {1, 1}, {0}}},
+    {"DeviceId2"_id, {{{0, 1}}, {1, 1}, std::nullopt}}
   };
 
   std::vector<DISPLAYCONFIG_PATH_INFO> expected_paths {paths.at(0), paths.at(1)};
@@ -754,7 +755,7 @@ TEST_F_S_MOCKED(MakePathsForNewTopology, GpuLimit, DuplicatedDisplays) {
 
 TEST_F_S_MOCKED(MakePathsForNewTopology, GpuLimit, ExtendedDisplays) {
   // We can only render 1 source and since want extended displays, we must have 2 and that's impossible.
-  const display_device::ActiveTopology new_topology {{"DeviceId1"}, {"DeviceId2"}};
+  const display_device::ActiveTopology new_topology {{"DeviceId1"_id}, {"DeviceId2"_id}};
   std::vector<DISPLAYCONFIG_PATH_INFO> paths {};
 
   paths.push_back(AVAILABLE_AND_ACTIVE_PATH);
@@ -766,8 +767,8 @@ TEST_F_S_MOCKED(MakePathsForNewTopology, GpuLimit, ExtendedDisplays) {
   paths.back().sourceInfo.id = 0;
 
   const display_device::PathSourceIndexDataMap path_source_data {
-    {"DeviceId1", {{{0, 0}}, {1, 1}, {0}}},
-    {"DeviceId2", {{{0, 1}}, {1, 1}, std::nullopt}}
+    {"DeviceId1"_id, {{{0, 0}}, {1, 1}, {0}}},
+    {"DeviceId2"_id, {{{0, 1}}, {1, 1}, std::nullopt}}
   };
 
   const std::vector<DISPLAYCONFIG_PATH_INFO> expected_paths {};
@@ -775,7 +776,7 @@ TEST_F_S_MOCKED(MakePathsForNewTopology, GpuLimit, ExtendedDisplays) {
 }
 
 TEST_F_S_MOCKED(MakePathsForNewTopology, IndexOutOfRange) {
-  const display_device::ActiveTopology new_topology {{"DeviceId1", "DeviceId4"}};
+  const display_device::ActiveTopology new_topology {{"DeviceId1"_id, "DeviceId4"_id}};
 
   const std::vector<DISPLAYCONFIG_PATH_INFO> expected_paths {};
   EXPECT_EQ(display_device::win_utils::makePathsForNewTopology(new_topology, EXPECTED_SOURCE_INDEX_DATA, {}), expected_paths);
@@ -812,7 +813,7 @@ TEST_F_S_MOCKED(GetAllDeviceIdsAndMatchingDuplicates) {
     setupExpectCallForValidPaths(4, sequence);
   }
 
-  EXPECT_EQ(display_device::win_utils::getAllDeviceIdsAndMatchingDuplicates(m_layer, {"DeviceId1", "DeviceId2"}), (std::set<std::string> {"DeviceId1", "DeviceId2", "DeviceId3"}));
+  EXPECT_EQ(display_device::win_utils::getAllDeviceIdsAndMatchingDuplicates(m_layer, {"DeviceId1"_id, "DeviceId2"_id}), (display_device::DeviceIdSet {"DeviceId1"_id, "DeviceId2"_id, "DeviceId3"_id}));
 }
 
 TEST_F_S_MOCKED(GetAllDeviceIdsAndMatchingDuplicates, FailedToQueryDevices) {
@@ -820,7 +821,7 @@ TEST_F_S_MOCKED(GetAllDeviceIdsAndMatchingDuplicates, FailedToQueryDevices) {
     .Times(1)
     .WillOnce(Return(ut_consts::PAM_NULL));
 
-  EXPECT_EQ(display_device::win_utils::getAllDeviceIdsAndMatchingDuplicates(m_layer, {"DeviceId2"}), std::set<std::string> {});
+  EXPECT_EQ(display_device::win_utils::getAllDeviceIdsAndMatchingDuplicates(m_layer, {"DeviceId2"_id}), display_device::DeviceIdSet {});
 }
 
 TEST_F_S_MOCKED(GetAllDeviceIdsAndMatchingDuplicates, EmptyDeviceIdInProvidedList) {
@@ -830,7 +831,7 @@ TEST_F_S_MOCKED(GetAllDeviceIdsAndMatchingDuplicates, EmptyDeviceIdInProvidedLis
     .Times(1)
     .WillOnce(Return(ut_consts::PAM_4_ACTIVE_WITH_2_DUPLICATES));
 
-  EXPECT_EQ(display_device::win_utils::getAllDeviceIdsAndMatchingDuplicates(m_layer, {""}), std::set<std::string> {});
+  EXPECT_EQ(display_device::win_utils::getAllDeviceIdsAndMatchingDuplicates(m_layer, {display_device::DeviceId {}}), display_device::DeviceIdSet {});
 }
 
 TEST_F_S_MOCKED(GetAllDeviceIdsAndMatchingDuplicates, FailedToFindActivePath) {
@@ -841,7 +842,7 @@ TEST_F_S_MOCKED(GetAllDeviceIdsAndMatchingDuplicates, FailedToFindActivePath) {
     .Times(4)
     .WillOnce(Return(""));
 
-  EXPECT_EQ(display_device::win_utils::getAllDeviceIdsAndMatchingDuplicates(m_layer, {"DeviceId2"}), std::set<std::string> {});
+  EXPECT_EQ(display_device::win_utils::getAllDeviceIdsAndMatchingDuplicates(m_layer, {"DeviceId2"_id}), display_device::DeviceIdSet {});
 }
 
 TEST_F_S_MOCKED(GetAllDeviceIdsAndMatchingDuplicates, NoSourceModeFound) {
@@ -854,7 +855,7 @@ TEST_F_S_MOCKED(GetAllDeviceIdsAndMatchingDuplicates, NoSourceModeFound) {
     .WillOnce(Return(pam_no_modes));
   setupExpectCallForValidPaths(2, sequence);
 
-  EXPECT_EQ(display_device::win_utils::getAllDeviceIdsAndMatchingDuplicates(m_layer, {"DeviceId2"}), std::set<std::string> {});
+  EXPECT_EQ(display_device::win_utils::getAllDeviceIdsAndMatchingDuplicates(m_layer, {"DeviceId2"_id}), display_device::DeviceIdSet {});
 }
 
 TEST_F_S_MOCKED(GetAllDeviceIdsAndMatchingDuplicates, IncompleteListOfSources) {
@@ -872,7 +873,7 @@ TEST_F_S_MOCKED(GetAllDeviceIdsAndMatchingDuplicates, IncompleteListOfSources) {
     .RetiresOnSaturation();
   setupExpectCallForValidPaths(1, sequence);
 
-  EXPECT_EQ(display_device::win_utils::getAllDeviceIdsAndMatchingDuplicates(m_layer, {"DeviceId1"}), std::set<std::string> {});
+  EXPECT_EQ(display_device::win_utils::getAllDeviceIdsAndMatchingDuplicates(m_layer, {"DeviceId1"_id}), display_device::DeviceIdSet {});
 }
 
 TEST_F_S_MOCKED(FuzzyCompareRefreshRates) {
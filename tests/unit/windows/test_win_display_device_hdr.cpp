@@ -13,6 +13,7 @@ namespace {
   using ::testing::InSequence;
   using ::testing::Return;
   using ::testing::StrictMock;
+  using namespace display_device::literals;
 
   // Test fixture(s) for this file
   class WinDisplayDeviceHdr: public BaseTest {
@@ -53,7 +54,7 @@ namespace {
 #define TEST_F_S_MOCKED(...) DD_MAKE_TEST(TEST_F, WinDisplayDeviceHdrMocked, __VA_ARGS__)
 
   // Helper functions
-  display_device::ActiveTopology makeExtendedTopology(const std::vector<std::string> &device_ids) {
+  display_device::ActiveTopology makeExtendedTopology(const std::vector<display_device::DeviceId> &device_ids) {
     display_device::ActiveTopology topology;
     for (const auto &device_id : device_ids) {
       topology.push_back({device_id});
@@ -115,11 +116,11 @@ TEST_F_S_MOCKED(GetHdrStates) {
     .RetiresOnSaturation();
 
   const display_device::HdrStateMap expected_states {
-    {"DeviceId1", std::make_optional(display_device::HdrState::Disabled)},
-    {"DeviceId2", std::nullopt},
-    {"DeviceId3", std::make_optional(display_device::HdrState::Enabled)}
+    {"DeviceId1"_id, std::make_optional(display_device::HdrState::Disabled)},
+    {"DeviceId2"_id, std::nullopt},
+    {"DeviceId3"_id, std::make_optional(display_device::HdrState::Enabled)}
   };
-  EXPECT_EQ(m_win_dd.getCurrentHdrStates({"DeviceId1", "DeviceId2", "DeviceId3"}), expected_states);
+  EXPECT_EQ(m_win_dd.getCurrentHdrStates({"DeviceId1"_id, "DeviceId2"_id, "DeviceId3"_id}), expected_states);
 }
 
 TEST_F_S_MOCKED(GetHdrStates, EmptyIdList) {
@@ -131,7 +132,7 @@ TEST_F_S_MOCKED(GetHdrStates, FailedToGetDisplayData) {
     .Times(1)
     .WillOnce(Return(ut_consts::PAM_NULL));
 
-  EXPECT_EQ(m_win_dd.getCurrentHdrStates({"DeviceId1"}), display_device::HdrStateMap {});
+  EXPECT_EQ(m_win_dd.getCurrentHdrStates({"DeviceId1"_id}), display_device::HdrStateMap {});
 }
 
 TEST_F_S_MOCKED(GetHdrStates, FailedToGetActivePath) {
@@ -139,7 +140,7 @@ TEST_F_S_MOCKED(GetHdrStates, FailedToGetActivePath) {
     .Times(1)
     .WillOnce(Return(ut_consts::PAM_EMPTY));
 
-  EXPECT_EQ(m_win_dd.getCurrentHdrStates({"DeviceId1"}), display_device::HdrStateMap {});
+  EXPECT_EQ(m_win_dd.getCurrentHdrStates({"DeviceId1"_id}), display_device::HdrStateMap {});
 }
 
 TEST_F_S_MOCKED(SetHdrStates) {
@@ -166,18 +167,18 @@ TEST_F_S_MOCKED(SetHdrStates) {
     .RetiresOnSaturation();
 
   const display_device::HdrStateMap new_states {
-    {"DeviceId1", std::make_optional(display_device::HdrState::Enabled)},
-    {"DeviceId2", std::nullopt},
-    {"DeviceId3", std::make_optional(display_device::HdrState::Enabled)}
+    {"DeviceId1"_id, std::make_optional(display_device::HdrState::Enabled)},
+    {"DeviceId2"_id, std::nullopt},
+    {"DeviceId3"_id, std::make_optional(display_device::HdrState::Enabled)}
   };
   EXPECT_TRUE(m_win_dd.setHdrStates(new_states));
 }
 
 TEST_F_S_MOCKED(SetHdrStates, AllDevicesWithOptStates) {
   const display_device::HdrStateMap new_states {
-    {"DeviceId1", std::nullopt},
-    {"DeviceId2", std::nullopt},
-    {"DeviceId3", std::nullopt}
+    {"DeviceId1"_id, std::nullopt},
+    {"DeviceId2"_id, std::nullopt},
+    {"DeviceId3"_id, std::nullopt}
   };
   EXPECT_TRUE(m_win_dd.setHdrStates(new_states));
 }
@@ -196,9 +197,9 @@ TEST_F_S_MOCKED(SetHdrStates, FailedToGetHdrState) {
     .RetiresOnSaturation();
 
   const display_device::HdrStateMap new_states {
-    {"DeviceId1", std::make_optional(display_device::HdrState::Enabled)},
-    {"DeviceId2", std::nullopt},
-    {"DeviceId3", std::make_optional(display_device::HdrState::Enabled)}
+    {"DeviceId1"_id, std::make_optional(display_device::HdrState::Enabled)},
+    {"DeviceId2"_id, std::nullopt},
+    {"DeviceId3"_id, std::make_optional(display_device::HdrState::Enabled)}
   };
   EXPECT_FALSE(m_win_dd.setHdrStates(new_states));
 }
@@ -249,10 +250,10 @@ TEST_F_S_MOCKED(SetHdrStates, FailedToSetHdrState, LastDevice) {
   }
 
   const display_device::HdrStateMap new_states {
-    {"DeviceId1", std::make_optional(display_device::HdrState::Enabled)},
-    {"DeviceId2", std::nullopt},
-    {"DeviceId3", std::make_optional(display_device::HdrState::Disabled)},
-    {"DeviceId4", std::make_optional(display_device::HdrState::Enabled)}
+    {"DeviceId1"_id, std::make_optional(display_device::HdrState::Enabled)},
+    {"DeviceId2"_id, std::nullopt},
+    {"DeviceId3"_id, std::make_optional(display_device::HdrState::Disabled)},
+    {"DeviceId4"_id, std::make_optional(display_device::HdrState::Enabled)}
   };
   EXPECT_FALSE(m_win_dd.setHdrStates(new_states));
 }
@@ -333,10 +334,10 @@ TEST_F_S_MOCKED(SetHdrStates, FailedToSetHdrState, LastDevice, NoEarlyExitInReco
   }
 
   const display_device::HdrStateMap new_states {
-    {"DeviceId1", std::make_optional(display_device::HdrState::Enabled)},
-    {"DeviceId2", std::make_optional(display_device::HdrState::Enabled)},
-    {"DeviceId3", std::make_optional(display_device::HdrState::Enabled)},
-    {"DeviceId4", std::make_optional(display_device::HdrState::Enabled)}
+    {"DeviceId1"_id, std::make_optional(display_device::HdrState::Enabled)},
+    {"DeviceId2"_id, std::make_optional(display_device::HdrState::Enabled)},
+    {"DeviceId3"_id, std::make_optional(display_device::HdrState::Enabled)},
+    {"DeviceId4"_id, std::make_optional(display_device::HdrState::Enabled)}
   };
   EXPECT_FALSE(m_win_dd.setHdrStates(new_states));
 }
@@ -350,7 +351,7 @@ TEST_F_S_MOCKED(SetHdrStates, FailedToGetDisplayData) {
     .Times(1)
     .WillOnce(Return(ut_consts::PAM_NULL));
 
-  EXPECT_FALSE(m_win_dd.setHdrStates({{"DeviceId1", std::make_optional(display_device::HdrState::Disabled)}}));
+  EXPECT_FALSE(m_win_dd.setHdrStates({{"DeviceId1"_id, std::make_optional(display_device::HdrState::Disabled)}}));
 }
 
 TEST_F_S_MOCKED(SetHdrStates, FailedToGetActivePath) {
@@ -358,5 +359,5 @@ TEST_F_S_MOCKED(SetHdrStates, FailedToGetActivePath) {
     .Times(1)
     .WillOnce(Return(ut_consts::PAM_EMPTY));
 
-  EXPECT_FALSE(m_win_dd.setHdrStates({{"DeviceId1", std::make_optional(display_device::HdrState::Disabled)}}));
+  EXPECT_FALSE(m_win_dd.setHdrStates({{"DeviceId1"_id, std::make_optional(display_device::HdrState::Disabled)}}));
 }
@@ -17,6 +17,7 @@ namespace {
   using ::testing::InSequence;
   using ::testing::Return;
   using ::testing::StrictMock;
+  using namespace display_device::literals;
 
   // Test fixture(s) for this file
   class WinDisplayDeviceModes: public BaseTest {
@@ -122,7 +123,7 @@ namespace {
         continue;
       }
 
-      auto path_index {std::stoi(device_id.substr(device_id.size() - 1, 1)) - 1};
+      auto path_index {std::stoi(device_id.str().substr(device_id.str().size() - 1, 1)) - 1};
       input->m_paths.at(path_index).targetInfo.refreshRate = {mode.m_refresh_rate.m_numerator, mode.m_refresh_rate.m_denominator};
       input->m_modes.at(input->m_paths.at(path_index).sourceInfo.sourceModeInfoIdx).sourceMode.width = mode.m_resolution.m_width;
       input->m_modes.at(input->m_paths.at(path_index).sourceInfo.sourceModeInfoIdx).sourceMode.height = mode.m_resolution.m_height;
@@ -149,7 +150,7 @@ TEST_F_S(GetCurrentDisplayModes) {
 
   // Can't really compare anything else without knowing system specs
   const auto mode_keys_view {std::ranges::views::keys(current_modes)};
-  const std::set<std::string> mode_keys {std::begin(mode_keys_view), std::end(mode_keys_view)};
+  const display_device::DeviceIdSet mode_keys {std::begin(mode_keys_view), std::end(mode_keys_view)};
   EXPECT_EQ(flattened_topology, mode_keys);
 }
 
@@ -239,12 +240,12 @@ TEST_F_S_MOCKED(GetCurrentDisplayModes) {
   InSequence sequence;
   setupExpectedGetCurrentDisplayModesCall(sequence);
 
-  const auto current_modes {m_win_dd.getCurrentDisplayModes({"DeviceId1", "DeviceId2", "DeviceId3", "DeviceId4"})};
+  const auto current_modes {m_win_dd.getCurrentDisplayModes({"DeviceId1"_id, "DeviceId2"_id, "DeviceId3"_id, "DeviceId4"_id})};
   const display_device::DeviceDisplayModeMap expected_modes {
-    {"DeviceId1", {1920, 1080, {120, 1}}},
-    {"DeviceId2", {1920, 2160, {119995, 1000}}},
-    {"DeviceId3", {1920, 2160, {60, 1}}},
-    {"DeviceId4", {3840, 2160, {90, 1}}},
+    {"DeviceId1"_id, {1920, 1080, {120, 1}}},
+    {"DeviceId2"_id, {1920, 2160, {119995, 1000}}},
+    {"DeviceId3"_id, {1920, 2160, {60, 1}}},
+    {"DeviceId4"_id, {3840, 2160, {90, 1}}},
   };
   EXPECT_EQ(current_modes, expected_modes);
 }
@@ -259,7 +260,7 @@ TEST_F_S_MOCKED(GetCurrentDisplayModes, NoDisplayData) {
     .Times(1)
     .WillOnce(Return(ut_consts::PAM_NULL));
 
-  const auto current_modes {m_win_dd.getCurrentDisplayModes({"DeviceId1"})};
+  const auto current_modes {m_win_dd.getCurrentDisplayModes({"DeviceId1"_id})};
   EXPECT_TRUE(current_modes.empty());
 }
 
@@ -268,7 +269,7 @@ TEST_F_S_MOCKED(GetCurrentDisplayModes, EmptyDeviceId) {
     .Times(1)
     .WillOnce(Return(ut_consts::PAM_4_ACTIVE_WITH_2_DUPLICATES));
 
-  const auto current_modes {m_win_dd.getCurrentDisplayModes({"", "DeviceId2"})};
+  const auto current_modes {m_win_dd.getCurrentDisplayModes({display_device::DeviceId {}, "DeviceId2"_id})};
   EXPECT_TRUE(current_modes.empty());
 }
 
@@ -277,7 +278,7 @@ TEST_F_S_MOCKED(GetCurrentDisplayModes, FailedToGetActivePath) {
     .Times(1)
     .WillOnce(Return(ut_consts::PAM_EMPTY));
 
-  const auto current_modes {m_win_dd.getCurrentDisplayModes({"DeviceId1"})};
+  const auto current_modes {m_win_dd.getCurrentDisplayModes({"DeviceId1"_id})};
   EXPECT_TRUE(current_modes.empty());
 }
 
@@ -298,16 +299,16 @@ TEST_F_S_MOCKED(GetCurrentDisplayModes, FailedToGetSourceMode) {
     .Times(1)
     .WillOnce(Return(pam_no_modes));
 
-  const auto current_modes {m_win_dd.getCurrentDisplayModes({"DeviceId1"})};
+  const auto current_modes {m_win_dd.getCurrentDisplayModes({"DeviceId1"_id})};
   EXPECT_TRUE(current_modes.empty());
 }
 
 TEST_F_S_MOCKED(SetDisplayModes, Relaxed) {
   const display_device::DeviceDisplayModeMap new_modes {
-    {"DeviceId1", {1920, 1080, {120, 1}}},
-    {"DeviceId2", {1920, 1000, {144, 1}}},
-    {"DeviceId3", {1000, 1000, {90, 1}}},
-    {"DeviceId4", {1000, 2160, {90, 10}}},
+    {"DeviceId1"_id, {1920, 1080, {120, 1}}},
+    {"DeviceId2"_id, {1920, 1000, {144, 1}}},
+    {"DeviceId3"_id, {1000, 1000, {90, 1}}},
+    {"DeviceId4"_id, {1000, 2160, {90, 10}}},
   };
 
   const auto pam_initial {ut_consts::PAM_4_ACTIVE_WITH_2_DUPLICATES};
@@ -339,10 +340,10 @@ TEST_F_S_MOCKED(SetDisplayModes, Relaxed) {
 
 TEST_F_S_MOCKED(SetDisplayModes, Strict) {
   const display_device::DeviceDisplayModeMap new_modes {
-    {"DeviceId1", {1920, 1080, {120, 10}}},
-    {"DeviceId2", {1000, 2160, {119995, 100}}},
-    {"DeviceId3", {1000, 1000, {90, 1}}},
-    {"DeviceId4", {3840, 2160, {90, 1}}},
+    {"DeviceId1"_id, {1920, 1080, {120, 10}}},
+    {"DeviceId2"_id, {1000, 2160, {119995, 100}}},
+    {"DeviceId3"_id, {1000, 1000, {90, 1}}},
+    {"DeviceId4"_id, {3840, 2160, {90, 1}}},
   };
 
   const auto pam_initial {ut_consts::PAM_4_ACTIVE_WITH_2_DUPLICATES};
@@ -396,10 +397,10 @@ TEST_F_S_MOCKED(SetDisplayModes, Strict) {
 
 TEST_F_S_MOCKED(SetDisplayModes, NoChanges) {
   const display_device::DeviceDisplayModeMap new_modes {
-    {"DeviceId1", {1920, 1080, {120, 1}}},
-    {"DeviceId2", {1920, 2160, {119995, 1000}}},
-    {"DeviceId3", {1920, 2160, {60, 1}}},
-    {"DeviceId4", {3840, 2160, {90, 1}}},
+    {"DeviceId1"_id, {1920, 1080, {120, 1}}},
+    {"DeviceId2"_id, {1920, 2160, {119995, 1000}}},
+    {"DeviceId3"_id, {1920, 2160, {60, 1}}},
+    {"DeviceId4"_id, {3840, 2160, {90, 1}}},
   };
 
   InSequence sequence;
@@ -431,14 +432,14 @@ TEST_F_S_MOCKED(SetDisplayModes, FailedToGetDuplicateDevices) {
     .WillOnce(Return(ut_consts::PAM_NULL))
     .RetiresOnSaturation();
 
-  EXPECT_FALSE(m_win_dd.setDisplayModes({{"DeviceId1", {}}}));
+  EXPECT_FALSE(m_win_dd.setDisplayModes({{"DeviceId1"_id, {}}}));
 }
 
 TEST_F_S_MOCKED(SetDisplayModes, MissingDuplicateDisplayModes) {
   InSequence sequence;
   setupExpectedGetAllDeviceIdsCall(sequence, {2});
 
-  EXPECT_FALSE(m_win_dd.setDisplayModes({{"DeviceId2", {}}}));
+  EXPECT_FALSE(m_win_dd.setDisplayModes({{"DeviceId2"_id, {}}}));
 }
 
 TEST_F_S_MOCKED(SetDisplayModes, FailedToGetOriginalData) {
@@ -449,7 +450,7 @@ TEST_F_S_MOCKED(SetDisplayModes, FailedToGetOriginalData) {
     .WillOnce(Return(ut_consts::PAM_NULL))
     .RetiresOnSaturation();
 
-  EXPECT_FALSE(m_win_dd.setDisplayModes({{"DeviceId1", {}}}));
+  EXPECT_FALSE(m_win_dd.setDisplayModes({{"DeviceId1"_id, {}}}));
 }
 
 TEST_F_S_MOCKED(SetDisplayModes, DoSetModes, FailedToGetDisplayConfig) {
@@ -464,7 +465,7 @@ TEST_F_S_MOCKED(SetDisplayModes, DoSetModes, FailedToGetDisplayConfig) {
     .WillOnce(Return(ut_consts::PAM_NULL))
     .RetiresOnSaturation();
 
-  EXPECT_FALSE(m_win_dd.setDisplayModes({{"DeviceId1", {}}}));
+  EXPECT_FALSE(m_win_dd.setDisplayModes({{"DeviceId1"_id, {}}}));
 }
 
 TEST_F_S_MOCKED(SetDisplayModes, DoSetModes, EmptyListFromGetDisplayConfig) {
@@ -479,7 +480,7 @@ TEST_F_S_MOCKED(SetDisplayModes, DoSetModes, EmptyListFromGetDisplayConfig) {
     .WillOnce(Return(ut_consts::PAM_EMPTY))
     .RetiresOnSaturation();
 
-  EXPECT_FALSE(m_win_dd.setDisplayModes({{"DeviceId1", {}}}));
+  EXPECT_FALSE(m_win_dd.setDisplayModes({{"DeviceId1"_id, {}}}));
 }
 
 TEST_F_S_MOCKED(SetDisplayModes, DoSetModes, FailedToGetActivePath) {
@@ -498,7 +499,7 @@ TEST_F_S_MOCKED(SetDisplayModes, DoSetModes, FailedToGetActivePath) {
     .WillOnce(Return(""))
     .RetiresOnSaturation();
 
-  EXPECT_FALSE(m_win_dd.setDisplayModes({{"DeviceId1", {}}}));
+  EXPECT_FALSE(m_win_dd.setDisplayModes({{"DeviceId1"_id, {}}}));
 }
 
 TEST_F_S_MOCKED(SetDisplayModes, DoSetModes, FailedToGetSourceMode) {
@@ -517,15 +518,15 @@ TEST_F_S_MOCKED(SetDisplayModes, DoSetModes, FailedToGetSourceMode) {
     .RetiresOnSaturation();
   setupExpectedGetActivePathCall(1, sequence);
 
-  EXPECT_FALSE(m_win_dd.setDisplayModes({{"DeviceId1", {}}}));
+  EXPECT_FALSE(m_win_dd.setDisplayModes({{"DeviceId1"_id, {}}}));
 }
 
 TEST_F_S_MOCKED(SetDisplayModes, Relaxed, FailedToSetDisplayConfig) {
   const display_device::DeviceDisplayModeMap new_modes {
-    {"DeviceId1", {1920, 1080, {120, 1}}},
-    {"DeviceId2", {1920, 1000, {144, 1}}},
-    {"DeviceId3", {1000, 1000, {90, 1}}},
-    {"DeviceId4", {1000, 2160, {90, 10}}},
+    {"DeviceId1"_id, {1920, 1080, {120, 1}}},
+    {"DeviceId2"_id, {1920, 1000, {144, 1}}},
+    {"DeviceId3"_id, {1000, 1000, {90, 1}}},
+    {"DeviceId4"_id, {1000, 2160, {90, 10}}},
   };
 
   const auto pam_initial {ut_consts::PAM_4_ACTIVE_WITH_2_DUPLICATES};
@@ -560,10 +561,10 @@ TEST_F_S_MOCKED(SetDisplayModes, Relaxed, FailedToSetDisplayConfig) {
 
 TEST_F_S_MOCKED(SetDisplayModes, Relaxed, FailedToGetCurrentDisplayModes) {
   const display_device::DeviceDisplayModeMap new_modes {
-    {"DeviceId1", {1920, 1080, {120, 1}}},
-    {"DeviceId2", {1920, 1000, {144, 1}}},
-    {"DeviceId3", {1000, 1000, {90, 1}}},
-    {"DeviceId4", {1000, 2160, {90, 10}}},
+    {"DeviceId1"_id, {1920, 1080, {120, 1}}},
+    {"DeviceId2"_id, {1920, 1000, {144, 1}}},
+    {"DeviceId3"_id, {1000, 1000, {90, 1}}},
+    {"DeviceId4"_id, {1000, 2160, {90, 10}}},
   };
 
   const auto pam_initial {ut_consts::PAM_4_ACTIVE_WITH_2_DUPLICATES};
@@ -602,10 +603,10 @@ TEST_F_S_MOCKED(SetDisplayModes, Relaxed, FailedToGetCurrentDisplayModes) {
 
 TEST_F_S_MOCKED(SetDisplayModes, Strict, FailedToSetDisplayConfig) {
   const display_device::DeviceDisplayModeMap new_modes {
-    {"DeviceId1", {1920, 1080, {120, 10}}},
-    {"DeviceId2", {1000, 2160, {119995, 100}}},
-    {"DeviceId3", {1000, 1000, {90, 1}}},
-    {"DeviceId4", {3840, 2160, {90, 1}}},
+    {"DeviceId1"_id, {1920, 1080, {120, 10}}},
+    {"DeviceId2"_id, {1000, 2160, {119995, 100}}},
+    {"DeviceId3"_id, {1000, 1000, {90, 1}}},
+    {"DeviceId4"_id, {3840, 2160, {90, 1}}},
   };
 
   const auto pam_initial {ut_consts::PAM_4_ACTIVE_WITH_2_DUPLICATES};
@@ -666,10 +667,10 @@ TEST_F_S_MOCKED(SetDisplayModes, Strict, FailedToSetDisplayConfig) {
 
 TEST_F_S_MOCKED(SetDisplayModes, Strict, FailedToGetCurrentDisplayModes) {
   const display_device::DeviceDisplayModeMap new_modes {
-    {"DeviceId1", {1920, 1080, {120, 10}}},
-    {"DeviceId2", {1000, 2160, {119995, 100}}},
-    {"DeviceId3", {1000, 1000, {90, 1}}},
-    {"DeviceId4", {3840, 2160, {90, 1}}},
+    {"DeviceId1"_id, {1920, 1080, {120, 10}}},
+    {"DeviceId2"_id, {1000, 2160, {119995, 100}}},
+    {"DeviceId3"_id, {1000, 1000, {90, 1}}},
+    {"DeviceId4"_id, {3840, 2160, {90, 1}}},
   };
 
   const auto pam_initial {ut_consts::PAM_4_ACTIVE_WITH_2_DUPLICATES};
@@ -730,10 +731,10 @@ TEST_F_S_MOCKED(SetDisplayModes, Strict, FailedToGetCurrentDisplayModes) {
 
 TEST_F_S_MOCKED(SetDisplayModes, Strict, ModesDidNotChange) {
   const display_device::DeviceDisplayModeMap new_modes {
-    {"DeviceId1", {1920, 1080, {120, 10}}},
-    {"DeviceId2", {1000, 2160, {119995, 100}}},
-    {"DeviceId3", {1000, 1000, {90, 1}}},
-    {"DeviceId4", {3840, 2160, {90, 1}}},
+    {"DeviceId1"_id, {1920, 1080, {120, 10}}},
+    {"DeviceId2"_id, {1000, 2160, {119995, 100}}},
+    {"DeviceId3"_id, {1000, 1000, {90, 1}}},
+    {"DeviceId4"_id, {3840, 2160, {90, 1}}},
   };
 
   const auto pam_initial {ut_consts::PAM_4_ACTIVE_WITH_2_DUPLICATES};
@@ -14,6 +14,7 @@ namespace {
   using ::testing::InSequence;
   using ::testing::Return;
   using ::testing::StrictMock;
+  using namespace display_device::literals;
 
   // Test fixture(s) for this file
   class WinDisplayDeviceTopology: public BaseTest {
@@ -80,11 +81,11 @@ TEST_F_S(GetCurrentTopology) {
     GTEST_SKIP_("No active devices are available in the system.");
   }
 
-  std::set<std::string> expected_devices;
+  display_device::DeviceIdSet expected_devices;
   for (const auto &path : active_devices->m_paths) {
     const auto device_id {m_layer->getDeviceId(path)};
     EXPECT_FALSE(device_id.empty());
-    EXPECT_TRUE(expected_devices.insert(device_id).second);
+    EXPECT_TRUE(expected_devices.insert(display_device::DeviceId {device_id}).second);
   }
 
   // It is enough to check whether the topology contains expected ids - others test cases check the structure.
@@ -153,7 +154,7 @@ TEST_F_S_MOCKED(GetCurrentTopology, ExtendedDisplaysOnly) {
   InSequence sequence;
   setupExpectCallFor3ActivePathsAndModes(display_device::QueryType::Active, sequence);
 
-  const display_device::ActiveTopology expected_topology {{"DeviceId1"}, {"DeviceId2"}, {"DeviceId3"}};
+  const display_device::ActiveTopology expected_topology {{"DeviceId1"_id}, {"DeviceId2"_id}, {"DeviceId3"_id}};
   EXPECT_EQ(m_win_dd.getCurrentTopology(), expected_topology);
 }
 
@@ -174,7 +175,7 @@ TEST_F_S_MOCKED(GetCurrentTopology, ExtendedAndDuplicatedDisplays) {
     .Times(1)
     .WillOnce(Return(ut_consts::PAM_4_ACTIVE_WITH_2_DUPLICATES));
 
-  const display_device::ActiveTopology expected_topology {{"DeviceId1"}, {"DeviceId2", "DeviceId3"}, {"DeviceId4"}};
+  const display_device::ActiveTopology expected_topology {{"DeviceId1"_id}, {"DeviceId2"_id, "DeviceId3"_id}, {"DeviceId4"_id}};
   EXPECT_EQ(m_win_dd.getCurrentTopology(), expected_topology);
 }
 
@@ -214,7 +215,7 @@ TEST_F_S_MOCKED(GetCurrentTopology, TransientDisplayIssues) {
     .Times(1)
     .WillOnce(Return(ut_consts::PAM_3_ACTIVE));
 
-  const display_device::ActiveTopology expected_topology {{"DeviceId1"}, {"DeviceId3"}};
+  const display_device::ActiveTopology expected_topology {{"DeviceId1"_id}, {"DeviceId3"_id}};
   EXPECT_EQ(m_win_dd.getCurrentTopology(), expected_topology);
 }
 
@@ -239,29 +240,32 @@ TEST_F_S_MOCKED(GetCurrentTopology, NullDeviceList) {
 TEST_F_S_MOCKED(IsTopologyValid) {
   EXPECT_EQ(m_win_dd.isTopologyValid({/* no groups */}), false);
   EXPECT_EQ(m_win_dd.isTopologyValid({{/* empty group */}}), false);
-  EXPECT_EQ(m_win_dd.isTopologyValid({{"ID_1"}}), true);
-  EXPECT_EQ(m_win_dd.isTopologyValid({{"ID_1"}, {"ID_2"}}), true);
-  EXPECT_EQ(m_win_dd.isTopologyValid({{"ID_1", "ID_2"}}), true);
-  EXPECT_EQ(m_win_dd.isTopologyValid({{"ID_1", "ID_1"}}), false);
-  EXPECT_EQ(m_win_dd.isTopologyValid({{"ID_1"}, {"ID_1"}}), false);
-  EXPECT_EQ(m_win_dd.isTopologyValid({{"ID_1", "ID_2", "ID_3"}}), false);
-  EXPECT_EQ(m_win_dd.isTopologyValid({{"ID_1"}, {"ID_2"}, {"ID_3"}, {"ID_4"}, {"ID_5"}}), true);
+  EXPECT_EQ(m_win_dd.isTopologyValid({{"ID_1"_id}}), true);
+  EXPECT_EQ(m_win_dd.isTopologyValid({{"ID_1"_id}, {"ID_2"_id}}), true);
+  EXPECT_EQ(m_win_dd.isTopologyValid({{"ID_1"_id, "ID_2"_id}}), true);
+  EXPECT_EQ(m_win_dd.isTopologyValid({{"ID_1"_id, "ID_1"_id}}), false);
+  EXPECT_EQ(m_win_dd.isTopologyValid({{"ID_1"_id}, {"ID_1"_id}}), false);
+  EXPECT_EQ(m_win_dd.isTopologyValid({{"ID_1"_id, "ID_2"_id, "ID_3"_id}}), false);
+  EXPECT_EQ(m_win_dd.isTopologyValid({{"ID_1"_id}, {"ID_2"_id}, {"ID_3"_id}, {"ID_4"_id}, {"ID_5"_id}}), true);
 }
 
 TEST_F_S_MOCKED(isTopologyTheSame) {
   EXPECT_EQ(m_win_dd.isTopologyTheSame({/* no groups */}, {/* no groups */}), true);
   EXPECT_EQ(m_win_dd.isTopologyTheSame({{/* empty group */}}, {{/* empty group */}}), true);
   EXPECT_EQ(m_win_dd.isTopologyTheSame({{/* empty group */}}, {{/* empty group */}, {/* empty group */}}), false);
-  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"}}, {{"ID_1"}}), true);
-  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"}}, {{"ID_1"}, {"ID_2"}}), false);
-  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"}, {"ID_2"}}, {{"ID_1"}, {"ID_2"}}), true);
-  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"}, {"ID_2"}}, {{"ID_2"}, {"ID_1"}}), true);
-  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"}, {"ID_2"}}, {{"ID_1", "ID_2"}}), false);
-  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1", "ID_2"}}, {{"ID_1", "ID_2"}}), true);
-  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1", "ID_2"}}, {{"ID_2", "ID_1"}}), true);
-  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1", "ID_2"}}, {{"ID_2", "ID_1"}, {"ID_3"}}), false);
-  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1", "ID_2"}, {"ID_3"}}, {{"ID_2", "ID_1"}, {"ID_3"}}), true);
-  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_3"}, {"ID_1", "ID_2"}}, {{"ID_2", "ID_1"}, {"ID_3"}}), true);
+  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"_id}}, {{"ID_1"_id}}), true);
+  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"_id}}, {{"ID_1"_id}, {"ID_2"_id}}), false);
+  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"_id}, {"ID_2"_id}}, {{"ID_1"_id}, {"ID_2"_id}}), true);
+  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"_id}, {"ID_2"_id}}, {{"ID_2"_id}, {"ID_1"_id}}), true);
+  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"_id}, {"ID_2"_id}}, {{"ID_1"_id, "ID_2"_id}}), false);
+  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"_id, "ID_2"_id}}, {{"ID_1"_id, "ID_2"_id}}), true);
+  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"_id, "ID_2"_id}}, {{"ID_2"_id, "ID_1"_id}}), true);
+  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"_id, "ID_2"_id}}, {{"ID_2"_id, "ID_1"_id}, {"ID_3"_id}}), false);
+  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"_id, "ID_2"_id}, {"ID_3"_id}}, {{"ID_2"_id, "ID_1"_id}, {"ID_3"_id}}), true);
+  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_3"_id}, {"ID_1"_id, "ID_2"_id}}, {{"ID_2"_id, "ID_1"_id}, {"ID_3"_id}}), true);
+  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"_id, "ID_2"_id, "ID_3"_id}}, {{"ID_3"_id, "ID_2"_id, "ID_1"_id}}), true);
+  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"_id, "ID_2"_id, "ID_3"_id}}, {{"ID_1"_id, "ID_2"_id}}), false);
+  EXPECT_EQ(m_win_dd.isTopologyTheSame({{"ID_1"_id, "ID_2"_id, "ID_3"_id}}, {{"ID_1"_id, "ID_2"_id}, {"ID_3"_id}}), false);
 }
 
 TEST_F_S_MOCKED(SetCurrentTopology) {
@@ -299,7 +303,7 @@ TEST_F_S_MOCKED(SetCurrentTopology) {
     .WillOnce(Return("DisplayName1"))
     .RetiresOnSaturation();
 
-  EXPECT_TRUE(m_win_dd.setTopology({{"DeviceId1"}}));
+  EXPECT_TRUE(m_win_dd.setTopology({{"DeviceId1"_id}}));
 }
 
 TEST_F_S_MOCKED(SetCurrentTopology, InvalidTopologyProvided) {
@@ -311,14 +315,14 @@ TEST_F_S_MOCKED(SetCurrentTopology, FailedToGetCurrentTopology) {
     .Times(1)
     .WillOnce(Return(ut_consts::PAM_NULL));
 
-  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceId1"}}));
+  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceId1"_id}}));
 }
 
 TEST_F_S_MOCKED(SetCurrentTopology, CurrentTopologyIsTheSame) {
   InSequence sequence;
   setupExpectCallFor3ActivePathsAndModes(display_device::QueryType::Active, sequence);
 
-  const display_device::ActiveTopology current_topology {{"DeviceId1"}, {"DeviceId2"}, {"DeviceId3"}};
+  const display_device::ActiveTopology current_topology {{"DeviceId1"_id}, {"DeviceId2"_id}, {"DeviceId3"_id}};
   EXPECT_TRUE(m_win_dd.setTopology(current_topology));
 }
 
@@ -329,7 +333,7 @@ TEST_F_S_MOCKED(SetCurrentTopology, FailedToQueryForAllDevices) {
     .Times(1)
     .WillOnce(Return(ut_consts::PAM_NULL));
 
-  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceId1"}}));
+  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceId1"_id}}));
 }
 
 TEST_F_S_MOCKED(SetCurrentTopology, DevicePathsAreNoLongerAvailable) {
@@ -339,7 +343,7 @@ TEST_F_S_MOCKED(SetCurrentTopology, DevicePathsAreNoLongerAvailable) {
     .Times(1)
     .WillOnce(Return(ut_consts::PAM_EMPTY));
 
-  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceId1"}}));
+  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceId1"_id}}));
 }
 
 TEST_F_S_MOCKED(SetCurrentTopology, FailedToMakePathSourceData) {
@@ -347,7 +351,7 @@ TEST_F_S_MOCKED(SetCurrentTopology, FailedToMakePathSourceData) {
   setupExpectCallFor3ActivePathsAndModes(display_device::QueryType::Active, sequence);
   setupExpectCallFor3ActivePathsAndModes(display_device::QueryType::All, sequence);
 
-  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceIdUnknown"}}));
+  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceIdUnknown"_id}}));
 }
 
 TEST_F_S_MOCKED(SetCurrentTopology, WindowsDoesNotKnowAboutTheTopology, FailedToSetTopology) {
@@ -373,7 +377,7 @@ TEST_F_S_MOCKED(SetCurrentTopology, WindowsDoesNotKnowAboutTheTopology, FailedTo
     .Times(1)
     .WillRepeatedly(Return("ErrorDesc"));
 
-  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceId1"}}));
+  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceId1"_id}}));
 }
 
 TEST_F_S_MOCKED(SetCurrentTopology, FailedToSetTopology, NoRecovery) {
@@ -390,7 +394,7 @@ TEST_F_S_MOCKED(SetCurrentTopology, FailedToSetTopology, NoRecovery) {
     .Times(1)
     .WillRepeatedly(Return("ErrorDesc"));
 
-  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceId1"}}));
+  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceId1"_id}}));
 }
 
 TEST_F_S_MOCKED(SetCurrentTopology, TopologyWasSetAccordingToWinApi, CouldNotGetCurrentTopologyToVerify) {
@@ -414,7 +418,7 @@ TEST_F_S_MOCKED(SetCurrentTopology, TopologyWasSetAccordingToWinApi, CouldNotGet
     .Times(1)
     .WillOnce(Return(ERROR_SUCCESS));
 
-  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceId1"}}));
+  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceId1"_id}}));
 }
 
 TEST_F_S_MOCKED(SetCurrentTopology, TopologyWasSetAccordingToWinApi, WinApiLied) {
@@ -436,5 +440,5 @@ TEST_F_S_MOCKED(SetCurrentTopology, TopologyWasSetAccordingToWinApi, WinApiLied)
     .Times(1)
     .WillOnce(Return(ERROR_SUCCESS));
 
-  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceId1"}}));
+  EXPECT_FALSE(m_win_dd.setTopology({{"DeviceId1"_id}}));
 }
@@ -90,9 +90,3 @@ bool operator==(const DISPLAYCONFIG_MODE_INFO &lhs, const DISPLAYCONFIG_MODE_INF
   }
   return false;
 }
-
-namespace display_device {
-  bool operator==(const PathSourceIndexData &lhs, const PathSourceIndexData &rhs) {
-    return lhs.m_source_id_to_path_index == rhs.m_source_id_to_path_index && lhs.m_adapter_id == rhs.m_adapter_id && lhs.m_active_source == rhs.m_active_source;
-  }
-}  // namespace display_device
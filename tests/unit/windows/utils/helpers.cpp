@@ -4,7 +4,7 @@
 // local includes
 #include "display_device/windows/json.h"
 
-std::optional<std::vector<std::string>> getAvailableDevices(display_device::WinApiLayer &layer, const bool only_valid_output) {
+std::optional<std::vector<display_device::DeviceId>> getAvailableDevices(display_device::WinApiLayer &layer, const bool only_valid_output) {
   const auto all_devices {layer.queryDisplayConfig(display_device::QueryType::All)};
   if (!all_devices) {
     return std::nullopt;
@@ -22,7 +22,12 @@ std::optional<std::vector<std::string>> getAvailableDevices(display_device::WinA
     }
   }
 
-  return std::vector<std::string> {device_ids.begin(), device_ids.end()};
+  std::vector<display_device::DeviceId> result;
+  result.reserve(device_ids.size());
+  for (const auto &device_id : device_ids) {
+    result.emplace_back(device_id);
+  }
+  return result;
 }
 
 std::optional<std::vector<std::uint8_t>> serializeState(const std::optional<display_device::SingleDisplayConfigState> &state) {
@@ -32,7 +37,7 @@ std::optional<std::vector<std::uint8_t>> serializeState(const std::optional<disp
     }
 
     bool is_ok {false};
-    const auto data_string {toJson(*state, 2, &is_ok)};
+    const auto data_string {toVersionedJson(*state, 2, &is_ok)};
     if (is_ok) {
       return std::vector<std::uint8_t> {std::begin(data_string), std::end(data_string)};
     }
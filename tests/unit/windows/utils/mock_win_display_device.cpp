@@ -5,18 +5,20 @@
 #include "helpers.h"
 
 namespace ut_consts {
+  using namespace display_device::literals;
+
   const std::optional<display_device::SingleDisplayConfigState> SDCS_NULL {std::nullopt};
   const std::optional<display_device::SingleDisplayConfigState> SDCS_EMPTY {display_device::SingleDisplayConfigState {}};
   const std::optional<display_device::SingleDisplayConfigState> SDCS_FULL {[]() {
     const display_device::SingleDisplayConfigState state {
-      {{{"DeviceId1"}},
+      {{{"DeviceId1"_id}},
        {"DeviceId1"}},
       {display_device::SingleDisplayConfigState::Modified {
-        {{"DeviceId1"}, {"DeviceId3"}},
-        {{"DeviceId1", {{1920, 1080}, {120, 1}}},
-         {"DeviceId3", {{1920, 1080}, {60, 1}}}},
-        {{"DeviceId1", {display_device::HdrState::Disabled}},
-         {"DeviceId3", display_device::HdrState::Enabled}},
+        {{"DeviceId1"_id}, {"DeviceId3"_id}},
+        {{"DeviceId1"_id, {{1920, 1080}, {120, 1}}},
+         {"DeviceId3"_id, {{1920, 1080}, {60, 1}}}},
+        {{"DeviceId1"_id, {display_device::HdrState::Disabled}},
+         {"DeviceId3"_id, display_device::HdrState::Enabled}},
         {"DeviceId1"},
       }}
     };
@@ -25,10 +27,10 @@ namespace ut_consts {
   }()};
   const std::optional<display_device::SingleDisplayConfigState> SDCS_NO_MODIFICATIONS {[]() {
     const display_device::SingleDisplayConfigState state {
-      {{{"DeviceId1"}},
+      {{{"DeviceId1"_id}},
        {"DeviceId1"}},
       {display_device::SingleDisplayConfigState::Modified {
-        {{"DeviceId1"}, {"DeviceId3"}}
+        {{"DeviceId1"_id}, {"DeviceId3"_id}}
       }}
     };
 